@@ -6,18 +6,650 @@
 
 #include "types.h"
 #include "defs.h"
+#include "param.h"
+#include "mmu.h"
+#include "proc.h"
+#include "spinlock.h"
+#include "pktbuf.h"
 #include "arp_frame.h"
+#include "arpctl.h"
 #include "nic.h"
 
-static int block_until_arp_reply(struct ethr_hdr *arpReply) {
-  /**
-   *TODO: repeated sleep. wake up on each network interrupt.
-   *      check for ARP reply for this request.
-   *      If received, unblock. else, sleep again.
-   */
+//ARP cache. Entries come from a fixed pool of ARP_CACHE_SIZE and hang
+//off a hash of the IP address; lookups by (interface, IP) are O(1).
+#define ARP_HASH_SIZE       64    //power of 2
+
+//Aging, in timer ticks. arp_timer() runs every NIC_TIMER_TICKS.
+#define ARP_REACHABLE_TICKS 3000  //a reply keeps an entry reachable this long
+#define ARP_REFRESH_TICKS   500   //between refresh requests of a stale entry
+#define ARP_REFRESH_TRIES   3     //unanswered refreshes before it fails
+#define ARP_FAILED_TICKS    2000  //a failed entry answers lookups negatively this long
+
+//Resolutions in flight. Callers after the same (interface, IP) share a
+//slot and sleep on it until a reply comes or arp_tick() gives up.
+#define ARP_PENDING_MAX     16
+#define ARP_RETRANS_TICKS   10    //first retransmit, doubled after each
+#define ARP_RESOLVE_TRIES   4     //requests sent before giving up
+
+//Frames arp_output() holds while their neighbors resolve, for all of
+//them together. ARP_QUEUE_MAX per neighbor is in arpctl.h
+#define ARP_QUEUE_BUFS      32
+
+struct arp_entry {
+  struct arp_entry *next;   //hash chain, or free list
+  uint32_t ip;              //network byte order
+  uint8_t mac[6];
+  uint8_t state;            //ARP_* from arpctl.h
+  uint8_t tries;            //refresh requests sent since the last reply
+  struct nic_device *nd;
+  uint changed;             //ticks at the last state change
+  uint sent;                //ticks at the last refresh request
+};
+
+static struct {
+  struct spinlock lock;
+  struct arp_entry entries[ARP_CACHE_SIZE];
+  struct arp_entry *hash[ARP_HASH_SIZE];
+  struct arp_entry *free;
+} arpcache;
+
+struct arp_pending {
+  struct nic_device *nd;    //0 if the slot is free
+  uint32_t ip;
+  uint8_t mac[6];
+  int status;               //0 in flight, 1 resolved, <0 failed
+  int waiters;
+  int tries;                //requests sent so far
+  uint timeout;             //ticks at which to retransmit or give up
+  struct pktbuf *qhead, *qtail;   //frames waiting for the reply
+  int qlen;
+};
+
+static struct {
+  struct spinlock lock;
+  struct arp_pending slots[ARP_PENDING_MAX];
+  int active;               //slots in use, so arp_tick() can skip the scan
+} arpwait;
+
+static struct pktpool arpq_pool;
+
+static uint arp_hash(uint32_t ip) {
+  return (ip ^ (ip >> 8) ^ (ip >> 16) ^ (ip >> 24)) & (ARP_HASH_SIZE - 1);
+}
+
+void arp_init(void) {
+  uint mtu = NIC_DEF_MTU;
+
+  initlock(&arpcache.lock, "arpcache");
+  initlock(&arpwait.lock, "arpwait");
+  //devices are registered by now. Size the queue for the largest MTU
+  //they have rather than NIC_MAX_MTU, which would waste most of each buffer
+  for(int i = 0; i < nic_ndevices; i++)
+    if(nic_devices[i].mtu > mtu)
+      mtu = nic_devices[i].mtu;
+  if(pktpool_init(&arpq_pool, "arpq", ARP_QUEUE_BUFS, ETHR_HDR_LEN + mtu) < 0)
+    panic("arp_init: no memory for the pending queue");
+  for(int i = 0; i < ARP_CACHE_SIZE; i++) {
+    arpcache.entries[i].next = arpcache.free;
+    arpcache.free = &arpcache.entries[i];
+  }
+}
+
+// Caller holds arpcache.lock
+static struct arp_entry* arp_find(struct nic_device *nd, uint32_t ip) {
+  struct arp_entry *e;
+
+  for(e = arpcache.hash[arp_hash(ip)]; e; e = e->next)
+    if(e->ip == ip && e->nd == nd)
+      return e;
   return 0;
 }
 
+// Unlink e from its hash chain and free it. Caller holds arpcache.lock
+static void arp_remove(struct arp_entry *e) {
+  struct arp_entry **pp;
+
+  for(pp = &arpcache.hash[arp_hash(e->ip)]; *pp; pp = &(*pp)->next) {
+    if(*pp == e) {
+      *pp = e->next;
+      break;
+    }
+  }
+  e->state = ARP_FREE;
+  e->next = arpcache.free;
+  arpcache.free = e;
+}
+
+/**
+ * A fresh entry for (nd, ip). When the pool is used up the entry that
+ * changed state longest ago is recycled, failed and stale ones first.
+ * Caller holds arpcache.lock
+ */
+static struct arp_entry* arp_alloc(struct nic_device *nd, uint32_t ip) {
+  struct arp_entry *e, *victim = 0;
+
+  if(arpcache.free == 0) {
+    for(int i = 0; i < ARP_CACHE_SIZE; i++) {
+      e = &arpcache.entries[i];
+      if(victim == 0 || (e->state != ARP_REACHABLE && victim->state == ARP_REACHABLE) ||
+         ((e->state == ARP_REACHABLE) == (victim->state == ARP_REACHABLE) &&
+          ticks - e->changed > ticks - victim->changed))
+        victim = e;
+    }
+    arp_remove(victim);
+  }
+  e = arpcache.free;
+  arpcache.free = e->next;
+  e->nd = nd;
+  e->ip = ip;
+  e->tries = 0;
+  e->sent = ticks;
+  e->next = arpcache.hash[arp_hash(ip)];
+  arpcache.hash[arp_hash(ip)] = e;
+  return e;
+}
+
+/**
+ * Record that ip is at mac on nd. Without create only an entry we
+ * already have is refreshed, so overheard traffic doesn't fill the cache.
+ */
+static void arp_cache_set(struct nic_device *nd, uint32_t ip, uint8_t *mac, int create) {
+  struct arp_entry *e;
+
+  acquire(&arpcache.lock);
+  if((e = arp_find(nd, ip)) == 0) {
+    if(!create) {
+      release(&arpcache.lock);
+      return;
+    }
+    e = arp_alloc(nd, ip);
+  }
+  memmove(e->mac, mac, 6);
+  e->state = ARP_REACHABLE;
+  e->tries = 0;
+  e->changed = ticks;
+  release(&arpcache.lock);
+}
+
+/**
+ * Record that ip on nd didn't answer, so lookups fail fast for a while.
+ */
+static void arp_cache_fail(struct nic_device *nd, uint32_t ip) {
+  struct arp_entry *e;
+
+  acquire(&arpcache.lock);
+  if((e = arp_find(nd, ip)) == 0)
+    e = arp_alloc(nd, ip);
+  if(e->state != ARP_REACHABLE) {
+    e->state = ARP_FAILED;
+    e->changed = ticks;
+  }
+  release(&arpcache.lock);
+}
+
+/**
+ * Cache lookup. Reachable and stale entries fill in mac and return 0,
+ * a failed one returns -2 so callers skip the wire, a miss returns -1.
+ */
+int arp_cache_lookup(struct nic_device *nd, uint32_t ip, uint8_t *mac) {
+  struct arp_entry *e;
+  int r = -1;
+
+  acquire(&arpcache.lock);
+  if((e = arp_find(nd, ip)) != 0) {
+    if(e->state == ARP_FAILED) {
+      r = -2;
+    } else {
+      memmove(mac, e->mac, 6);
+      r = 0;
+    }
+  }
+  release(&arpcache.lock);
+  return r;
+}
+
+/**
+ * Request for ip. dmac is where to send it, 0 broadcasts it; refreshes
+ * ask the neighbor we know directly.
+ */
+static int arp_send_request(struct nic_device *nd, uint32_t ip, uint8_t *dmac) {
+  struct ethr_hdr eth;
+
+  create_eth_arp_frame_ip(nd->mac_addr, nd->ipaddr, ip, &eth);
+  if(dmac)
+    memmove(eth.dmac, dmac, 6);
+  //sizeof(eth)-2 to remove padding
+  return nd->send_packet(nd->driver, (uint8_t*)&eth, sizeof(eth)-2);
+}
+
+/**
+ * Aging, called from the NIC poll thread every NIC_TIMER_TICKS.
+ * Reachable entries that weren't confirmed for ARP_REACHABLE_TICKS go
+ * stale and get refreshed in the background; stale ones that stay
+ * unanswered fail, and failed ones are dropped.
+ */
+void arp_timer(void) {
+  struct { struct nic_device *nd; uint32_t ip; uint8_t mac[6]; } refresh[16];
+  int nrefresh = 0;
+
+  acquire(&arpcache.lock);
+  for(int i = 0; i < ARP_CACHE_SIZE; i++) {
+    struct arp_entry *e = &arpcache.entries[i];
+    switch(e->state) {
+    case ARP_REACHABLE:
+      if(ticks - e->changed < ARP_REACHABLE_TICKS)
+        continue;
+      e->state = ARP_STALE;
+      e->changed = ticks;
+      break;
+    case ARP_STALE:
+      if(ticks - e->sent < ARP_REFRESH_TICKS)
+        continue;
+      if(e->tries >= ARP_REFRESH_TRIES) {
+        e->state = ARP_FAILED;
+        e->changed = ticks;
+        continue;
+      }
+      break;
+    case ARP_FAILED:
+      if(ticks - e->changed >= ARP_FAILED_TICKS)
+        arp_remove(e);
+      continue;
+    default:
+      continue;
+    }
+    //stale, time for a refresh. what doesn't fit goes out next time
+    if(nrefresh == NELEM(refresh))
+      continue;
+    e->tries++;
+    e->sent = ticks;
+    refresh[nrefresh].nd = e->nd;
+    refresh[nrefresh].ip = e->ip;
+    memmove(refresh[nrefresh].mac, e->mac, 6);
+    nrefresh++;
+  }
+  release(&arpcache.lock);
+
+  for(int i = 0; i < nrefresh; i++)
+    arp_send_request(refresh[i].nd, refresh[i].ip, refresh[i].mac);
+}
+
+/**
+ * Copy up to n entries into ents for arpdump(). Returns how many.
+ */
+int arp_cache_dump(struct arpent *ents, int n) {
+  int count = 0;
+
+  acquire(&arpcache.lock);
+  for(int i = 0; i < ARP_CACHE_SIZE && count < n; i++) {
+    struct arp_entry *e = &arpcache.entries[i];
+    if(e->state == ARP_FREE)
+      continue;
+    ents[count].ip = e->ip;
+    memmove(ents[count].mac, e->mac, 6);
+    ents[count].state = e->state;
+    ents[count].ifindex = e->nd->index;
+    ents[count].age = ticks - e->changed;
+    count++;
+  }
+  release(&arpcache.lock);
+  return count;
+}
+
+// Drop every entry
+void arp_cache_flush(void) {
+  acquire(&arpcache.lock);
+  for(int i = 0; i < ARP_CACHE_SIZE; i++)
+    if(arpcache.entries[i].state != ARP_FREE)
+      arp_remove(&arpcache.entries[i]);
+  release(&arpcache.lock);
+}
+
+/**
+ * Slot for resolving ip on nd, a new one if nobody is at it yet, in
+ * which case *created is set. 0 if all slots are busy.
+ * Caller holds arpwait.lock
+ */
+static struct arp_pending* arp_pending_get(struct nic_device *nd, uint32_t ip, int *created) {
+  struct arp_pending *p, *freep = 0;
+
+  *created = 0;
+  for(p = arpwait.slots; p < &arpwait.slots[ARP_PENDING_MAX]; p++) {
+    if(p->nd == nd && p->ip == ip && p->status == 0)
+      return p;
+    if(p->nd == 0 && freep == 0)
+      freep = p;
+  }
+  if((p = freep) == 0)
+    return 0;
+  p->nd = nd;
+  p->ip = ip;
+  p->status = 0;
+  p->waiters = 0;
+  p->tries = 1;     //the creator sends the first request
+  p->timeout = ticks + ARP_RETRANS_TICKS;
+  p->qhead = p->qtail = 0;
+  p->qlen = 0;
+  arpwait.active++;
+  *created = 1;
+  return p;
+}
+
+// Give a slot back, waking callers waiting for one. Caller holds arpwait.lock
+static void arp_pending_free(struct arp_pending *p) {
+  p->nd = 0;
+  arpwait.active--;
+  wakeup(&arpwait.active);
+}
+
+/**
+ * Finish a resolution. Waiters are woken, and the queued frames are
+ * handed back through *q for the caller to send or free once it drops
+ * the lock. The slot is reused once no waiter refers to it.
+ * Caller holds arpwait.lock
+ */
+static void arp_pending_end(struct arp_pending *p, int status, struct pktbuf **q) {
+  p->status = status;
+  wakeup(p);
+  *q = p->qhead;
+  if(status < 0)
+    p->nd->arpq_drops += p->qlen;
+  p->qhead = p->qtail = 0;
+  p->qlen = 0;
+  if(p->waiters == 0)
+    arp_pending_free(p);
+}
+
+static void arp_queue_free(struct pktbuf *q) {
+  struct pktbuf *next;
+
+  for(; q; q = next) {
+    next = q->next;
+    pktbuf_free(q);
+  }
+}
+
+/**
+ * Send the frames that waited for mac in one burst, filling in their
+ * destination, and free them.
+ */
+static void arp_queue_flush(struct nic_device *nd, uint8_t *mac, struct pktbuf *q) {
+  uint8_t *pkts[ARP_QUEUE_MAX];
+  uint16_t lengths[ARP_QUEUE_MAX];
+  struct pktbuf *pb;
+  int n = 0;
+
+  for(pb = q; pb && n < ARP_QUEUE_MAX; pb = pb->next) {
+    memmove(pb->data, mac, 6);
+    pkts[n] = pb->data;
+    lengths[n++] = pb->len;
+  }
+  if(n)
+    nd->arpq_drops += n - nic_send_batch(nd, pkts, lengths, n);
+  arp_queue_free(q);
+}
+
+/**
+ * Send the first request for a slot arp_pending_get() just created.
+ * If it can't go out, the resolution ends right away.
+ */
+static void arp_pending_start(struct arp_pending *p, struct nic_device *nd, uint32_t ip) {
+  struct pktbuf *q = 0;
+
+  if(arp_send_request(nd, ip, 0) == 0)
+    return;
+  //unless someone waits on the slot it may have been finished and reused
+  acquire(&arpwait.lock);
+  if(p->nd == nd && p->ip == ip && p->status == 0)
+    arp_pending_end(p, -1, &q);
+  release(&arpwait.lock);
+  arp_queue_free(q);
+}
+
+/**
+ * Wait for ip on nd to answer. Concurrent callers for the same address
+ * share one slot, so only one request is on the wire at a time; the
+ * first caller sends it and arp_tick() retransmits. With every slot
+ * busy we wait for one to free up.
+ * Returns 0 with mac filled in, -1 if the request couldn't be sent or
+ * we were killed, -2 if nobody answered.
+ */
+static int arp_resolve(struct nic_device *nd, uint32_t ip, uint8_t *mac) {
+  struct arp_pending *p;
+  int r, created;
+
+  acquire(&arpwait.lock);
+  while((p = arp_pending_get(nd, ip, &created)) == 0) {
+    if(myproc()->killed) {
+      release(&arpwait.lock);
+      return -1;
+    }
+    sleep(&arpwait.active, &arpwait.lock);
+  }
+  p->waiters++;
+  if(created) {
+    release(&arpwait.lock);
+    arp_pending_start(p, nd, ip);
+    acquire(&arpwait.lock);
+  }
+
+  while(p->status == 0) {
+    if(myproc()->killed) {
+      r = -1;
+      goto out;
+    }
+    sleep(p, &arpwait.lock);
+  }
+  if((r = p->status) > 0) {
+    memmove(mac, p->mac, 6);
+    r = 0;
+  }
+out:
+  if(--p->waiters == 0 && p->status != 0)
+    arp_pending_free(p);
+  release(&arpwait.lock);
+
+  return r;
+}
+
+/**
+ * Resolve ip on nd for the arpresolve system calls. Returns 0 with mac
+ * filled in, ARP_EUNREACH if the neighbor doesn't answer, -1 on other
+ * errors. With ARP_NONBLOCK a miss starts resolving and returns
+ * ARP_EAGAIN instead of waiting.
+ */
+int arp_lookup(struct nic_device *nd, uint32_t ip, uint8_t *mac, int flags) {
+  struct arp_pending *p;
+  int r, created;
+
+  if((r = arp_cache_lookup(nd, ip, mac)) == 0)
+    return 0;
+  if(r == -2)
+    return ARP_EUNREACH;
+
+  if((flags & ARP_NONBLOCK) == 0) {
+    r = arp_resolve(nd, ip, mac);
+    return r == -2 ? ARP_EUNREACH : r;
+  }
+
+  acquire(&arpwait.lock);
+  p = arp_pending_get(nd, ip, &created);
+  release(&arpwait.lock);
+  if(p == 0)
+    return -1;
+  if(created)
+    arp_pending_start(p, nd, ip);
+  return ARP_EAGAIN;
+}
+
+/**
+ * Transmit a frame to ip on nd without blocking. frame is a whole
+ * Ethernet frame; its destination address is filled in here. If ip
+ * isn't resolved yet the frame is copied onto that neighbor's queue
+ * and goes out when the reply arrives; a full queue drops its oldest.
+ * Returns 0 if sent or queued, -1 if dropped.
+ */
+int arp_output(struct nic_device *nd, uint32_t ip, uint8_t *frame, uint16_t length) {
+  struct arp_pending *p;
+  struct pktbuf *pb, *old = 0;
+  uint8_t mac[6];
+  int r, created;
+
+  if(length < ETHR_HDR_LEN)
+    return -1;
+  if((r = arp_cache_lookup(nd, ip, mac)) == 0) {
+    memmove(frame, mac, 6);
+    return nd->send_packet(nd->driver, frame, length);
+  }
+  if(r == -2) {
+    nd->arpq_drops++;
+    return -1;
+  }
+
+  //too big for a queue buffer (MTU raised since boot), or none left
+  if(length > arpq_pool.bufsize || (pb = pktbuf_alloc(&arpq_pool)) == 0) {
+    nd->arpq_drops++;
+    return -1;
+  }
+  memmove(pb->data, frame, length);
+  pb->len = length;
+
+  acquire(&arpwait.lock);
+  if((p = arp_pending_get(nd, ip, &created)) == 0) {
+    nd->arpq_drops++;
+    release(&arpwait.lock);
+    pktbuf_free(pb);
+    return -1;
+  }
+  if(p->qtail)
+    p->qtail->next = pb;
+  else
+    p->qhead = pb;
+  p->qtail = pb;
+  if(++p->qlen > ARP_QUEUE_MAX) {
+    old = p->qhead;
+    p->qhead = old->next;
+    p->qlen--;
+    nd->arpq_drops++;
+  }
+  release(&arpwait.lock);
+  if(old)
+    pktbuf_free(old);
+
+  if(created)
+    arp_pending_start(p, nd, ip);
+  return 0;
+}
+
+/**
+ * A mapping for ip came in on nd. Wake the callers waiting for exactly
+ * that address, if any, and send what was queued for it. Returns 1 if
+ * a resolution was waiting for it.
+ */
+static int arp_resolved(struct nic_device *nd, uint32_t ip, uint8_t *mac) {
+  struct arp_pending *p;
+  struct pktbuf *q = 0;
+  int found = 0;
+
+  acquire(&arpwait.lock);
+  for(p = arpwait.slots; p < &arpwait.slots[ARP_PENDING_MAX]; p++) {
+    if(p->nd == nd && p->ip == ip && p->status == 0) {
+      memmove(p->mac, mac, 6);
+      arp_pending_end(p, 1, &q);
+      found = 1;
+      break;
+    }
+  }
+  release(&arpwait.lock);
+
+  if(q)
+    arp_queue_flush(nd, mac, q);
+  return found;
+}
+
+/**
+ * Called from the timer interrupt every tick. Retransmits the requests
+ * that are due, doubling the wait each time, and gives up on addresses
+ * that stayed silent: their waiters fail, their queued frames are
+ * dropped and the cache remembers the failure.
+ */
+void arp_tick(uint now) {
+  struct { struct nic_device *nd; uint32_t ip; struct pktbuf *q; int failed; } due[ARP_PENDING_MAX];
+  struct arp_pending *p;
+  int ndue = 0;
+
+  if(arpwait.active == 0)
+    return;
+  acquire(&arpwait.lock);
+  for(p = arpwait.slots; p < &arpwait.slots[ARP_PENDING_MAX]; p++) {
+    if(p->nd == 0 || p->status != 0 || (int)(now - p->timeout) < 0)
+      continue;
+    due[ndue].nd = p->nd;
+    due[ndue].ip = p->ip;
+    due[ndue].q = 0;
+    if((due[ndue].failed = p->tries == ARP_RESOLVE_TRIES)) {
+      arp_pending_end(p, -2, &due[ndue].q);
+    } else {
+      p->timeout = now + (ARP_RETRANS_TICKS << p->tries);
+      p->tries++;
+    }
+    ndue++;
+  }
+  release(&arpwait.lock);
+
+  for(int i = 0; i < ndue; i++) {
+    if(due[i].failed) {
+      arp_cache_fail(due[i].nd, due[i].ip);
+      arp_queue_free(due[i].q);
+    } else {
+      arp_send_request(due[i].nd, due[i].ip, 0);
+    }
+  }
+}
+
+/**
+ * Gratuitous ARP: a broadcast request for our own address, so peers
+ * update what they cached for it. Sent when the interface comes up or
+ * gets a new address.
+ */
+void arp_announce(struct nic_device *nd) {
+  if(arp_send_request(nd, nd->ipaddr, 0) < 0)
+    cprintf("arp: %s: failed to announce address\n", nd->name);
+}
+
+/**
+ * Receive path entry for ARP frames, called from nic_rx(), possibly in
+ * interrupt context. Requests for our address are answered right here.
+ */
+void arp_input(struct nic_device *nd, uint8_t *pkt, uint16_t length) {
+  struct ethr_hdr *arp = (struct ethr_hdr*)pkt;
+  struct ethr_hdr reply;
+  uint32_t tip;
+  int forus;
+
+  if(length < sizeof(struct ethr_hdr)-2)
+    return;
+  if(htons(arp->hwtype) != 1 || htons(arp->protype) != 0x0800)
+    return;
+
+  tip = arp->dip | ((uint32_t)arp->dip2 << 16);
+  forus = nd->ipaddr != 0 && tip == nd->ipaddr;
+
+  //learn the sender. anyone asking for us, or that we are resolving,
+  //will be talked to next; anything else just refreshes what we already
+  //have. probes (sip 0) and our own announcements teach nothing
+  if(arp->sip != 0 && arp->sip != nd->ipaddr) {
+    int wanted = arp_resolved(nd, arp->sip, arp->arp_smac);
+    arp_cache_set(nd, arp->sip, arp->arp_smac, wanted || forus || htons(arp->opcode) == 2);
+  }
+
+  if(htons(arp->opcode) == 1 && forus) {
+    create_eth_arp_reply(nd->mac_addr, nd->ipaddr, arp->arp_smac, arp->sip, &reply);
+    //sizeof(reply)-2 to remove padding
+    nd->send_packet(nd->driver, (uint8_t*)&reply, sizeof(reply)-2);
+  }
+}
+
 int send_arpRequest(char* interface, char* ipAddr, char* arpResp) {
   cprintf("Create arp request for ip:%s over Interface:%s\n", ipAddr, interface);
 
@@ -27,17 +659,16 @@ int send_arpRequest(char* interface, char* ipAddr, char* arpResp) {
     return -1;
   }
 
-  struct ethr_hdr eth;
-  create_eth_arp_frame(nd->mac_addr, ipAddr, &eth);
-  nd->send_packet(nd->driver, (uint8_t*)&eth, sizeof(eth)-2); //sizeof(eth)-2 to remove padding. padding was necessary for alignment.
+  uint32_t ip = get_ip(ipAddr, strlen(ipAddr));
+  uint8_t mac[6];
+  int r;
 
-  struct ethr_hdr arpResponse;
-  if(block_until_arp_reply(&arpResponse) < 0) {
-    cprintf("ERROR:send_arpRequest:Failed to recv ARP response over the NIC\n");
-    return -3;
+  if((r = arp_lookup(nd, ip, mac, 0)) < 0) {
+    cprintf("ERROR:send_arpRequest:No ARP response for %s\n", ipAddr);
+    return r == ARP_EUNREACH ? -3 : -2;
   }
 
-  unpack_mac(arpResponse.arp_dmac, arpResp);
+  unpack_mac(mac, arpResp);
   arpResp[17] = '\0';
 
   return 0;
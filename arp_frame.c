@@ -79,8 +79,11 @@ uint32_t htonl(uint32_t v) {
   return htons(v >> 16) | (htons((uint16_t) v) << 16);
 }
 
-int create_eth_arp_frame(uint8_t* smac, char* ipAddr, struct ethr_hdr *eth) {
-	cprintf("Create ARP frame\n");
+/**
+ * Broadcast ARP request for dip from sip, IPv4 addresses in network byte
+ * order. sip 0 makes it a probe from an interface with no address yet.
+ */
+int create_eth_arp_frame_ip(uint8_t* smac, uint32_t sip, uint32_t dip, struct ethr_hdr *eth) {
 	char* dmac = BROADCAST_MAC;
 
 	pack_mac(eth->dmac, dmac);
@@ -103,9 +106,22 @@ int create_eth_arp_frame(uint8_t* smac, char* ipAddr, struct ethr_hdr *eth) {
 	memmove(eth->arp_smac, smac, 6);
 	pack_mac(eth->arp_dmac, dmac); //this can potentially be igored for the request
 
-	eth->sip = get_ip("192.168.1.1", strlen("192.168.1.1"));
+	eth->sip = sip;
+
+	*(uint32_t*)(&eth->dip) = dip;
+
+	return 0;
+}
+
+/**
+ * ARP reply telling dmac/dip that sip is at smac
+ */
+int create_eth_arp_reply(uint8_t* smac, uint32_t sip, uint8_t* dmac, uint32_t dip, struct ethr_hdr *eth) {
+	create_eth_arp_frame_ip(smac, sip, dip, eth);
 
-	*(uint32_t*)(&eth->dip) = get_ip(ipAddr, strlen(ipAddr));
+	eth->opcode = htons(2);
+	memmove(eth->dmac, dmac, 6);
+	memmove(eth->arp_dmac, dmac, 6);
 
 	return 0;
 }
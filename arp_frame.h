@@ -22,8 +22,12 @@ struct ethr_hdr {
 	uint16_t padd;//This need not be here explicitly. Compiler automatically inserts padding. But since we are removing padding length from struct length while calculating length, lets keep it here explicitly.
 };
 
-int create_eth_arp_frame(uint8_t* smac, char* ipAddr, struct ethr_hdr *eth);
+int create_eth_arp_frame_ip(uint8_t* smac, uint32_t sip, uint32_t dip, struct ethr_hdr *eth);
+int create_eth_arp_reply(uint8_t* smac, uint32_t sip, uint8_t* dmac, uint32_t dip, struct ethr_hdr *eth);
+uint32_t get_ip(char* ip, uint len);
 void unpack_mac(uchar* mac, char* mac_str);
 char int_to_hex (uint n);
+uint16_t htons(uint16_t v);
+uint32_t htonl(uint32_t v);
 
 #endif
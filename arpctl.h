@@ -0,0 +1,46 @@
+#ifndef __XV6_NETSTACK_ARPCTL_H__
+#define __XV6_NETSTACK_ARPCTL_H__
+/**
+ *ARP cache entries as the arpdump system call reports them, and
+ *the arpresolve/arpresolvev/arpsend interface.
+ *shared by the kernel and user space
+ */
+
+//Entries the cache holds at most
+#define ARP_CACHE_SIZE  128
+
+//Entry states
+#define ARP_FREE        0
+#define ARP_REACHABLE   1   //confirmed by a reply within ARP_REACHABLE_TICKS
+#define ARP_STALE       2   //still used, a refresh request is out
+#define ARP_FAILED      3   //no answer, lookups fail until the entry expires
+
+struct arpent {
+  uint32_t ip;        //network byte order
+  uint8_t mac[6];
+  uint8_t state;
+  uint8_t ifindex;    //interface, eth<ifindex>
+  uint32_t age;       //ticks since the entry last changed state
+};
+
+//arpresolve/arpresolvev flags
+#define ARP_NONBLOCK    0x1 //don't wait for a reply; a miss returns ARP_EAGAIN
+
+//Results besides 0 (resolved) and -1 (bad arguments, out of resources)
+#define ARP_EAGAIN      -2  //resolution started or in flight, ask again later
+#define ARP_EUNREACH    -3  //no answer, fails fast until the cache forgets it
+
+//Addresses one arpresolvev call takes at most
+#define ARP_BATCH_MAX   64
+
+//Frames arpsend queues for one neighbor while it resolves, beyond that
+//the oldest is dropped
+#define ARP_QUEUE_MAX   8
+
+struct arpreq {
+  uint32_t ip;        //network byte order
+  uint8_t mac[6];     //filled in once resolved
+  short status;       //0, ARP_EAGAIN, ARP_EUNREACH or -1
+};
+
+#endif
@@ -0,0 +1,1406 @@
+
+_arptab:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+static void printhex(uint8_t b) {
+  char *digits = "0123456789abcdef";
+  printf(1, "%c%c", digits[b >> 4], digits[b & 0xf]);
+}
+
+int main(int argc, char *argv[]) {
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 18             	sub    $0x18,%esp
+  14:	8b 01                	mov    (%ecx),%eax
+  16:	8b 51 04             	mov    0x4(%ecx),%edx
+  int n;
+
+  if(argc == 2 && strcmp(argv[1], "-f") == 0) {
+  19:	83 f8 02             	cmp    $0x2,%eax
+  1c:	0f 84 e0 00 00 00    	je     102 <main+0x102>
+    arpflush();
+    exit();
+  }
+  if(argc != 1) {
+  22:	83 f8 01             	cmp    $0x1,%eax
+  25:	74 13                	je     3a <main+0x3a>
+    printf(2, "usage: arptab [-f]\n");
+  27:	53                   	push   %ebx
+  28:	53                   	push   %ebx
+  29:	68 2b 09 00 00       	push   $0x92b
+  2e:	6a 02                	push   $0x2
+  30:	e8 cb 05 00 00       	call   600 <printf>
+    exit();
+  35:	e8 12 04 00 00       	call   44c <exit>
+  }
+
+  if((n = arpdump(ents, ARP_CACHE_SIZE)) < 0) {
+  3a:	51                   	push   %ecx
+  3b:	51                   	push   %ecx
+  3c:	68 80 00 00 00       	push   $0x80
+  41:	68 40 0d 00 00       	push   $0xd40
+  46:	e8 d1 04 00 00       	call   51c <arpdump>
+  4b:	83 c4 10             	add    $0x10,%esp
+  4e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  51:	85 c0                	test   %eax,%eax
+  53:	0f 88 cd 00 00 00    	js     126 <main+0x126>
+    printf(2, "arptab: can't read the ARP cache\n");
+    exit();
+  }
+  printf(1, "address hwaddress iface state age(ticks)\n");
+  59:	50                   	push   %eax
+  5a:	50                   	push   %eax
+  5b:	68 b4 09 00 00       	push   $0x9b4
+  60:	6a 01                	push   $0x1
+  62:	e8 99 05 00 00       	call   600 <printf>
+  for(int i = 0; i < n; i++) {
+  67:	83 c4 10             	add    $0x10,%esp
+  6a:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  6e:	0f 84 09 01 00 00    	je     17d <main+0x17d>
+  74:	31 db                	xor    %ebx,%ebx
+  76:	31 ff                	xor    %edi,%edi
+  78:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  7f:	90                   	nop
+    uint8_t *ip = (uint8_t*)&ents[i].ip;
+    printf(1, "%d.%d.%d.%d ", ip[0], ip[1], ip[2], ip[3]);
+  80:	0f b6 83 43 0d 00 00 	movzbl 0xd43(%ebx),%eax
+  87:	83 ec 08             	sub    $0x8,%esp
+    for(int j = 0; j < 6; j++) {
+  8a:	31 f6                	xor    %esi,%esi
+    printf(1, "%d.%d.%d.%d ", ip[0], ip[1], ip[2], ip[3]);
+  8c:	50                   	push   %eax
+  8d:	0f b6 83 42 0d 00 00 	movzbl 0xd42(%ebx),%eax
+  94:	50                   	push   %eax
+  95:	0f b6 83 41 0d 00 00 	movzbl 0xd41(%ebx),%eax
+  9c:	50                   	push   %eax
+  9d:	0f b6 83 40 0d 00 00 	movzbl 0xd40(%ebx),%eax
+  a4:	50                   	push   %eax
+  a5:	68 3f 09 00 00       	push   $0x93f
+  aa:	6a 01                	push   $0x1
+  ac:	e8 4f 05 00 00       	call   600 <printf>
+  b1:	83 c4 20             	add    $0x20,%esp
+      printhex(ents[i].mac[j]);
+  b4:	0f b6 84 33 44 0d 00 	movzbl 0xd44(%ebx,%esi,1),%eax
+  bb:	00 
+  printf(1, "%c%c", digits[b >> 4], digits[b & 0xf]);
+  bc:	89 c2                	mov    %eax,%edx
+  be:	c0 e8 04             	shr    $0x4,%al
+  c1:	83 e2 0f             	and    $0xf,%edx
+  c4:	0f b6 c0             	movzbl %al,%eax
+  c7:	0f be 92 4c 09 00 00 	movsbl 0x94c(%edx),%edx
+  ce:	0f be 80 4c 09 00 00 	movsbl 0x94c(%eax),%eax
+  d5:	52                   	push   %edx
+  d6:	50                   	push   %eax
+  d7:	68 5d 09 00 00       	push   $0x95d
+  dc:	6a 01                	push   $0x1
+  de:	e8 1d 05 00 00       	call   600 <printf>
+      if(j < 5)
+  e3:	83 c4 10             	add    $0x10,%esp
+  e6:	83 fe 05             	cmp    $0x5,%esi
+  e9:	74 55                	je     140 <main+0x140>
+        printf(1, ":");
+  eb:	83 ec 08             	sub    $0x8,%esp
+    for(int j = 0; j < 6; j++) {
+  ee:	83 c6 01             	add    $0x1,%esi
+        printf(1, ":");
+  f1:	68 70 09 00 00       	push   $0x970
+  f6:	6a 01                	push   $0x1
+  f8:	e8 03 05 00 00       	call   600 <printf>
+    for(int j = 0; j < 6; j++) {
+  fd:	83 c4 10             	add    $0x10,%esp
+ 100:	eb b2                	jmp    b4 <main+0xb4>
+  if(argc == 2 && strcmp(argv[1], "-f") == 0) {
+ 102:	56                   	push   %esi
+ 103:	56                   	push   %esi
+ 104:	68 28 09 00 00       	push   $0x928
+ 109:	ff 72 04             	push   0x4(%edx)
+ 10c:	e8 df 02 00 00       	call   3f0 <strcmp>
+ 111:	83 c4 10             	add    $0x10,%esp
+ 114:	85 c0                	test   %eax,%eax
+ 116:	0f 85 0b ff ff ff    	jne    27 <main+0x27>
+    arpflush();
+ 11c:	e8 03 04 00 00       	call   524 <arpflush>
+    exit();
+ 121:	e8 26 03 00 00       	call   44c <exit>
+    printf(2, "arptab: can't read the ARP cache\n");
+ 126:	52                   	push   %edx
+ 127:	52                   	push   %edx
+ 128:	68 90 09 00 00       	push   $0x990
+ 12d:	6a 02                	push   $0x2
+ 12f:	e8 cc 04 00 00       	call   600 <printf>
+    exit();
+ 134:	e8 13 03 00 00       	call   44c <exit>
+ 139:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    }
+    printf(1, " eth%d %s %d\n", ents[i].ifindex, states[ents[i].state], ents[i].age);
+ 140:	0f b6 83 4a 0d 00 00 	movzbl 0xd4a(%ebx),%eax
+ 147:	83 ec 0c             	sub    $0xc,%esp
+  for(int i = 0; i < n; i++) {
+ 14a:	83 c7 01             	add    $0x1,%edi
+ 14d:	83 c3 10             	add    $0x10,%ebx
+    printf(1, " eth%d %s %d\n", ents[i].ifindex, states[ents[i].state], ents[i].age);
+ 150:	ff b3 3c 0d 00 00    	push   0xd3c(%ebx)
+ 156:	ff 34 85 e0 09 00 00 	push   0x9e0(,%eax,4)
+ 15d:	0f b6 83 3b 0d 00 00 	movzbl 0xd3b(%ebx),%eax
+ 164:	50                   	push   %eax
+ 165:	68 62 09 00 00       	push   $0x962
+ 16a:	6a 01                	push   $0x1
+ 16c:	e8 8f 04 00 00       	call   600 <printf>
+  for(int i = 0; i < n; i++) {
+ 171:	83 c4 20             	add    $0x20,%esp
+ 174:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+ 177:	0f 85 03 ff ff ff    	jne    80 <main+0x80>
+  }
+  exit();
+ 17d:	e8 ca 02 00 00       	call   44c <exit>
+ 182:	66 90                	xchg   %ax,%ax
+ 184:	66 90                	xchg   %ax,%ax
+ 186:	66 90                	xchg   %ax,%ax
+ 188:	66 90                	xchg   %ax,%ax
+ 18a:	66 90                	xchg   %ax,%ax
+ 18c:	66 90                	xchg   %ax,%ax
+ 18e:	66 90                	xchg   %ax,%ax
+
+00000190 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 190:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 191:	31 c0                	xor    %eax,%eax
+{
+ 193:	89 e5                	mov    %esp,%ebp
+ 195:	53                   	push   %ebx
+ 196:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 199:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 19c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 1a0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 1a4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 1a7:	83 c0 01             	add    $0x1,%eax
+ 1aa:	84 d2                	test   %dl,%dl
+ 1ac:	75 f2                	jne    1a0 <strcpy+0x10>
+    ;
+  return os;
+}
+ 1ae:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1b1:	89 c8                	mov    %ecx,%eax
+ 1b3:	c9                   	leave
+ 1b4:	c3                   	ret
+ 1b5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000001c0 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 1c0:	55                   	push   %ebp
+ 1c1:	89 e5                	mov    %esp,%ebp
+ 1c3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 1c6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 1c9:	74 15                	je     1e0 <strlen+0x20>
+ 1cb:	31 c0                	xor    %eax,%eax
+ 1cd:	8d 76 00             	lea    0x0(%esi),%esi
+ 1d0:	83 c0 01             	add    $0x1,%eax
+ 1d3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 1d7:	89 c1                	mov    %eax,%ecx
+ 1d9:	75 f5                	jne    1d0 <strlen+0x10>
+    ;
+  return n;
+}
+ 1db:	89 c8                	mov    %ecx,%eax
+ 1dd:	5d                   	pop    %ebp
+ 1de:	c3                   	ret
+ 1df:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 1e0:	31 c9                	xor    %ecx,%ecx
+}
+ 1e2:	5d                   	pop    %ebp
+ 1e3:	89 c8                	mov    %ecx,%eax
+ 1e5:	c3                   	ret
+ 1e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000001f0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 1f0:	55                   	push   %ebp
+ 1f1:	89 e5                	mov    %esp,%ebp
+ 1f3:	57                   	push   %edi
+ 1f4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 1f7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 1fa:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1fd:	89 d7                	mov    %edx,%edi
+ 1ff:	fc                   	cld
+ 200:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 202:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 205:	89 d0                	mov    %edx,%eax
+ 207:	c9                   	leave
+ 208:	c3                   	ret
+ 209:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000210 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 210:	55                   	push   %ebp
+ 211:	89 e5                	mov    %esp,%ebp
+ 213:	8b 45 08             	mov    0x8(%ebp),%eax
+ 216:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 21a:	0f b6 10             	movzbl (%eax),%edx
+ 21d:	84 d2                	test   %dl,%dl
+ 21f:	75 12                	jne    233 <strchr+0x23>
+ 221:	eb 1d                	jmp    240 <strchr+0x30>
+ 223:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 227:	90                   	nop
+ 228:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 22c:	83 c0 01             	add    $0x1,%eax
+ 22f:	84 d2                	test   %dl,%dl
+ 231:	74 0d                	je     240 <strchr+0x30>
+    if(*s == c)
+ 233:	38 d1                	cmp    %dl,%cl
+ 235:	75 f1                	jne    228 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 237:	5d                   	pop    %ebp
+ 238:	c3                   	ret
+ 239:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 240:	31 c0                	xor    %eax,%eax
+}
+ 242:	5d                   	pop    %ebp
+ 243:	c3                   	ret
+ 244:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 24b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 24f:	90                   	nop
+
+00000250 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 250:	55                   	push   %ebp
+ 251:	89 e5                	mov    %esp,%ebp
+ 253:	57                   	push   %edi
+ 254:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 255:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 258:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 259:	31 db                	xor    %ebx,%ebx
+{
+ 25b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 25e:	eb 27                	jmp    287 <gets+0x37>
+    cc = read(0, &c, 1);
+ 260:	83 ec 04             	sub    $0x4,%esp
+ 263:	6a 01                	push   $0x1
+ 265:	56                   	push   %esi
+ 266:	6a 00                	push   $0x0
+ 268:	e8 f7 01 00 00       	call   464 <read>
+    if(cc < 1)
+ 26d:	83 c4 10             	add    $0x10,%esp
+ 270:	85 c0                	test   %eax,%eax
+ 272:	7e 1d                	jle    291 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 274:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 278:	8b 55 08             	mov    0x8(%ebp),%edx
+ 27b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 27f:	3c 0a                	cmp    $0xa,%al
+ 281:	74 10                	je     293 <gets+0x43>
+ 283:	3c 0d                	cmp    $0xd,%al
+ 285:	74 0c                	je     293 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 287:	89 df                	mov    %ebx,%edi
+ 289:	83 c3 01             	add    $0x1,%ebx
+ 28c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 28f:	7c cf                	jl     260 <gets+0x10>
+ 291:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 293:	8b 45 08             	mov    0x8(%ebp),%eax
+ 296:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 29a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 29d:	5b                   	pop    %ebx
+ 29e:	5e                   	pop    %esi
+ 29f:	5f                   	pop    %edi
+ 2a0:	5d                   	pop    %ebp
+ 2a1:	c3                   	ret
+ 2a2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000002b0 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 2b0:	55                   	push   %ebp
+ 2b1:	89 e5                	mov    %esp,%ebp
+ 2b3:	56                   	push   %esi
+ 2b4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 2b5:	83 ec 08             	sub    $0x8,%esp
+ 2b8:	6a 00                	push   $0x0
+ 2ba:	ff 75 08             	push   0x8(%ebp)
+ 2bd:	e8 ca 01 00 00       	call   48c <open>
+  if(fd < 0)
+ 2c2:	83 c4 10             	add    $0x10,%esp
+ 2c5:	85 c0                	test   %eax,%eax
+ 2c7:	78 27                	js     2f0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 2c9:	83 ec 08             	sub    $0x8,%esp
+ 2cc:	ff 75 0c             	push   0xc(%ebp)
+ 2cf:	89 c3                	mov    %eax,%ebx
+ 2d1:	50                   	push   %eax
+ 2d2:	e8 cd 01 00 00       	call   4a4 <fstat>
+  close(fd);
+ 2d7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 2da:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 2dc:	e8 93 01 00 00       	call   474 <close>
+  return r;
+ 2e1:	83 c4 10             	add    $0x10,%esp
+}
+ 2e4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 2e7:	89 f0                	mov    %esi,%eax
+ 2e9:	5b                   	pop    %ebx
+ 2ea:	5e                   	pop    %esi
+ 2eb:	5d                   	pop    %ebp
+ 2ec:	c3                   	ret
+ 2ed:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 2f0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 2f5:	eb ed                	jmp    2e4 <stat+0x34>
+ 2f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2fe:	66 90                	xchg   %ax,%ax
+
+00000300 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 300:	55                   	push   %ebp
+ 301:	89 e5                	mov    %esp,%ebp
+ 303:	57                   	push   %edi
+ 304:	56                   	push   %esi
+ 305:	8b 45 10             	mov    0x10(%ebp),%eax
+ 308:	8b 55 08             	mov    0x8(%ebp),%edx
+ 30b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 30e:	85 c0                	test   %eax,%eax
+ 310:	7e 13                	jle    325 <memmove+0x25>
+ 312:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 314:	89 d7                	mov    %edx,%edi
+ 316:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 31d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 320:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 321:	39 f8                	cmp    %edi,%eax
+ 323:	75 fb                	jne    320 <memmove+0x20>
+  return vdst;
+}
+ 325:	5e                   	pop    %esi
+ 326:	89 d0                	mov    %edx,%eax
+ 328:	5f                   	pop    %edi
+ 329:	5d                   	pop    %ebp
+ 32a:	c3                   	ret
+ 32b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 32f:	90                   	nop
+
+00000330 <parseip>:
+
+// a.b.c.d to network byte order. -1 if malformed
+int
+parseip(char *s, uint *addr)
+{
+ 330:	55                   	push   %ebp
+ 331:	89 e5                	mov    %esp,%ebp
+ 333:	57                   	push   %edi
+  uint8_t *b = (uint8_t*)addr;
+  int v;
+
+  for(int i = 0; i < 4; i++) {
+ 334:	31 ff                	xor    %edi,%edi
+{
+ 336:	56                   	push   %esi
+ 337:	53                   	push   %ebx
+ 338:	8b 55 08             	mov    0x8(%ebp),%edx
+    if(*s < '0' || *s > '9')
+ 33b:	0f be 02             	movsbl (%edx),%eax
+ 33e:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 341:	80 f9 09             	cmp    $0x9,%cl
+ 344:	77 59                	ja     39f <parseip+0x6f>
+      return -1;
+    for(v = 0; *s >= '0' && *s <= '9'; s++)
+ 346:	31 c9                	xor    %ecx,%ecx
+ 348:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 34f:	90                   	nop
+      v = v * 10 + *s - '0';
+ 350:	89 d6                	mov    %edx,%esi
+ 352:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    for(v = 0; *s >= '0' && *s <= '9'; s++)
+ 355:	83 c2 01             	add    $0x1,%edx
+      v = v * 10 + *s - '0';
+ 358:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+    for(v = 0; *s >= '0' && *s <= '9'; s++)
+ 35c:	0f be 02             	movsbl (%edx),%eax
+ 35f:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 362:	80 fb 09             	cmp    $0x9,%bl
+ 365:	76 e9                	jbe    350 <parseip+0x20>
+    if(v > 255 || *s != (i < 3 ? '.' : '\0'))
+ 367:	81 f9 ff 00 00 00    	cmp    $0xff,%ecx
+ 36d:	7f 30                	jg     39f <parseip+0x6f>
+ 36f:	83 ff 03             	cmp    $0x3,%edi
+ 372:	74 1c                	je     390 <parseip+0x60>
+ 374:	83 f8 2e             	cmp    $0x2e,%eax
+ 377:	75 26                	jne    39f <parseip+0x6f>
+      return -1;
+    b[i] = v;
+ 379:	8b 45 0c             	mov    0xc(%ebp),%eax
+    s++;
+ 37c:	8d 56 02             	lea    0x2(%esi),%edx
+    b[i] = v;
+ 37f:	88 0c 38             	mov    %cl,(%eax,%edi,1)
+  for(int i = 0; i < 4; i++) {
+ 382:	83 c7 01             	add    $0x1,%edi
+ 385:	eb b4                	jmp    33b <parseip+0xb>
+ 387:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 38e:	66 90                	xchg   %ax,%ax
+    if(v > 255 || *s != (i < 3 ? '.' : '\0'))
+ 390:	85 c0                	test   %eax,%eax
+ 392:	75 0b                	jne    39f <parseip+0x6f>
+    b[i] = v;
+ 394:	8b 7d 0c             	mov    0xc(%ebp),%edi
+ 397:	88 4f 03             	mov    %cl,0x3(%edi)
+  }
+  return 0;
+}
+ 39a:	5b                   	pop    %ebx
+ 39b:	5e                   	pop    %esi
+ 39c:	5f                   	pop    %edi
+ 39d:	5d                   	pop    %ebp
+ 39e:	c3                   	ret
+ 39f:	5b                   	pop    %ebx
+      return -1;
+ 3a0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+ 3a5:	5e                   	pop    %esi
+ 3a6:	5f                   	pop    %edi
+ 3a7:	5d                   	pop    %ebp
+ 3a8:	c3                   	ret
+ 3a9:	66 90                	xchg   %ax,%ax
+ 3ab:	66 90                	xchg   %ax,%ax
+ 3ad:	66 90                	xchg   %ax,%ax
+ 3af:	90                   	nop
+
+000003b0 <atoi>:
+#include "types.h"
+#include "util.h"
+
+int
+atoi(const char *s)
+{
+ 3b0:	55                   	push   %ebp
+ 3b1:	89 e5                	mov    %esp,%ebp
+ 3b3:	53                   	push   %ebx
+ 3b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 3b7:	0f be 02             	movsbl (%edx),%eax
+ 3ba:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 3bd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 3c0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 3c5:	77 1e                	ja     3e5 <atoi+0x35>
+ 3c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ce:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 3d0:	83 c2 01             	add    $0x1,%edx
+ 3d3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 3d6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 3da:	0f be 02             	movsbl (%edx),%eax
+ 3dd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 3e0:	80 fb 09             	cmp    $0x9,%bl
+ 3e3:	76 eb                	jbe    3d0 <atoi+0x20>
+  return n;
+}
+ 3e5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3e8:	89 c8                	mov    %ecx,%eax
+ 3ea:	c9                   	leave
+ 3eb:	c3                   	ret
+ 3ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003f0 <strcmp>:
+
+
+int
+strcmp(const char *p, const char *q)
+{
+ 3f0:	55                   	push   %ebp
+ 3f1:	89 e5                	mov    %esp,%ebp
+ 3f3:	53                   	push   %ebx
+ 3f4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3f7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 3fa:	0f b6 02             	movzbl (%edx),%eax
+ 3fd:	84 c0                	test   %al,%al
+ 3ff:	75 17                	jne    418 <strcmp+0x28>
+ 401:	eb 3a                	jmp    43d <strcmp+0x4d>
+ 403:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 407:	90                   	nop
+ 408:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 40c:	83 c2 01             	add    $0x1,%edx
+ 40f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 412:	84 c0                	test   %al,%al
+ 414:	74 1a                	je     430 <strcmp+0x40>
+    p++, q++;
+ 416:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 418:	0f b6 19             	movzbl (%ecx),%ebx
+ 41b:	38 c3                	cmp    %al,%bl
+ 41d:	74 e9                	je     408 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 41f:	29 d8                	sub    %ebx,%eax
+}
+ 421:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 424:	c9                   	leave
+ 425:	c3                   	ret
+ 426:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 42d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 430:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 434:	31 c0                	xor    %eax,%eax
+ 436:	29 d8                	sub    %ebx,%eax
+}
+ 438:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 43b:	c9                   	leave
+ 43c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 43d:	0f b6 19             	movzbl (%ecx),%ebx
+ 440:	31 c0                	xor    %eax,%eax
+ 442:	eb db                	jmp    41f <strcmp+0x2f>
+
+00000444 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 444:	b8 01 00 00 00       	mov    $0x1,%eax
+ 449:	cd 40                	int    $0x40
+ 44b:	c3                   	ret
+
+0000044c <exit>:
+SYSCALL(exit)
+ 44c:	b8 02 00 00 00       	mov    $0x2,%eax
+ 451:	cd 40                	int    $0x40
+ 453:	c3                   	ret
+
+00000454 <wait>:
+SYSCALL(wait)
+ 454:	b8 03 00 00 00       	mov    $0x3,%eax
+ 459:	cd 40                	int    $0x40
+ 45b:	c3                   	ret
+
+0000045c <pipe>:
+SYSCALL(pipe)
+ 45c:	b8 04 00 00 00       	mov    $0x4,%eax
+ 461:	cd 40                	int    $0x40
+ 463:	c3                   	ret
+
+00000464 <read>:
+SYSCALL(read)
+ 464:	b8 05 00 00 00       	mov    $0x5,%eax
+ 469:	cd 40                	int    $0x40
+ 46b:	c3                   	ret
+
+0000046c <write>:
+SYSCALL(write)
+ 46c:	b8 10 00 00 00       	mov    $0x10,%eax
+ 471:	cd 40                	int    $0x40
+ 473:	c3                   	ret
+
+00000474 <close>:
+SYSCALL(close)
+ 474:	b8 15 00 00 00       	mov    $0x15,%eax
+ 479:	cd 40                	int    $0x40
+ 47b:	c3                   	ret
+
+0000047c <kill>:
+SYSCALL(kill)
+ 47c:	b8 06 00 00 00       	mov    $0x6,%eax
+ 481:	cd 40                	int    $0x40
+ 483:	c3                   	ret
+
+00000484 <exec>:
+SYSCALL(exec)
+ 484:	b8 07 00 00 00       	mov    $0x7,%eax
+ 489:	cd 40                	int    $0x40
+ 48b:	c3                   	ret
+
+0000048c <open>:
+SYSCALL(open)
+ 48c:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 491:	cd 40                	int    $0x40
+ 493:	c3                   	ret
+
+00000494 <mknod>:
+SYSCALL(mknod)
+ 494:	b8 11 00 00 00       	mov    $0x11,%eax
+ 499:	cd 40                	int    $0x40
+ 49b:	c3                   	ret
+
+0000049c <unlink>:
+SYSCALL(unlink)
+ 49c:	b8 12 00 00 00       	mov    $0x12,%eax
+ 4a1:	cd 40                	int    $0x40
+ 4a3:	c3                   	ret
+
+000004a4 <fstat>:
+SYSCALL(fstat)
+ 4a4:	b8 08 00 00 00       	mov    $0x8,%eax
+ 4a9:	cd 40                	int    $0x40
+ 4ab:	c3                   	ret
+
+000004ac <link>:
+SYSCALL(link)
+ 4ac:	b8 13 00 00 00       	mov    $0x13,%eax
+ 4b1:	cd 40                	int    $0x40
+ 4b3:	c3                   	ret
+
+000004b4 <mkdir>:
+SYSCALL(mkdir)
+ 4b4:	b8 14 00 00 00       	mov    $0x14,%eax
+ 4b9:	cd 40                	int    $0x40
+ 4bb:	c3                   	ret
+
+000004bc <chdir>:
+SYSCALL(chdir)
+ 4bc:	b8 09 00 00 00       	mov    $0x9,%eax
+ 4c1:	cd 40                	int    $0x40
+ 4c3:	c3                   	ret
+
+000004c4 <dup>:
+SYSCALL(dup)
+ 4c4:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 4c9:	cd 40                	int    $0x40
+ 4cb:	c3                   	ret
+
+000004cc <getpid>:
+SYSCALL(getpid)
+ 4cc:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 4d1:	cd 40                	int    $0x40
+ 4d3:	c3                   	ret
+
+000004d4 <sbrk>:
+SYSCALL(sbrk)
+ 4d4:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 4d9:	cd 40                	int    $0x40
+ 4db:	c3                   	ret
+
+000004dc <sleep>:
+SYSCALL(sleep)
+ 4dc:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 4e1:	cd 40                	int    $0x40
+ 4e3:	c3                   	ret
+
+000004e4 <uptime>:
+SYSCALL(uptime)
+ 4e4:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 4e9:	cd 40                	int    $0x40
+ 4eb:	c3                   	ret
+
+000004ec <arp>:
+SYSCALL(arp)
+ 4ec:	b8 16 00 00 00       	mov    $0x16,%eax
+ 4f1:	cd 40                	int    $0x40
+ 4f3:	c3                   	ret
+
+000004f4 <nicget>:
+SYSCALL(nicget)
+ 4f4:	b8 17 00 00 00       	mov    $0x17,%eax
+ 4f9:	cd 40                	int    $0x40
+ 4fb:	c3                   	ret
+
+000004fc <nicset>:
+SYSCALL(nicset)
+ 4fc:	b8 18 00 00 00       	mov    $0x18,%eax
+ 501:	cd 40                	int    $0x40
+ 503:	c3                   	ret
+
+00000504 <nicstats>:
+SYSCALL(nicstats)
+ 504:	b8 19 00 00 00       	mov    $0x19,%eax
+ 509:	cd 40                	int    $0x40
+ 50b:	c3                   	ret
+
+0000050c <nicsend>:
+SYSCALL(nicsend)
+ 50c:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 511:	cd 40                	int    $0x40
+ 513:	c3                   	ret
+
+00000514 <nicrecv>:
+SYSCALL(nicrecv)
+ 514:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 519:	cd 40                	int    $0x40
+ 51b:	c3                   	ret
+
+0000051c <arpdump>:
+SYSCALL(arpdump)
+ 51c:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 521:	cd 40                	int    $0x40
+ 523:	c3                   	ret
+
+00000524 <arpflush>:
+SYSCALL(arpflush)
+ 524:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 529:	cd 40                	int    $0x40
+ 52b:	c3                   	ret
+
+0000052c <nicgetip>:
+SYSCALL(nicgetip)
+ 52c:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 531:	cd 40                	int    $0x40
+ 533:	c3                   	ret
+
+00000534 <nicsetip>:
+SYSCALL(nicsetip)
+ 534:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 539:	cd 40                	int    $0x40
+ 53b:	c3                   	ret
+
+0000053c <arpresolve>:
+SYSCALL(arpresolve)
+ 53c:	b8 20 00 00 00       	mov    $0x20,%eax
+ 541:	cd 40                	int    $0x40
+ 543:	c3                   	ret
+
+00000544 <arpresolvev>:
+SYSCALL(arpresolvev)
+ 544:	b8 21 00 00 00       	mov    $0x21,%eax
+ 549:	cd 40                	int    $0x40
+ 54b:	c3                   	ret
+
+0000054c <arpsend>:
+SYSCALL(arpsend)
+ 54c:	b8 22 00 00 00       	mov    $0x22,%eax
+ 551:	cd 40                	int    $0x40
+ 553:	c3                   	ret
+ 554:	66 90                	xchg   %ax,%ax
+ 556:	66 90                	xchg   %ax,%ax
+ 558:	66 90                	xchg   %ax,%ax
+ 55a:	66 90                	xchg   %ax,%ax
+ 55c:	66 90                	xchg   %ax,%ax
+ 55e:	66 90                	xchg   %ax,%ax
+
+00000560 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 560:	55                   	push   %ebp
+ 561:	89 e5                	mov    %esp,%ebp
+ 563:	57                   	push   %edi
+ 564:	56                   	push   %esi
+ 565:	53                   	push   %ebx
+ 566:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 568:	89 d1                	mov    %edx,%ecx
+{
+ 56a:	83 ec 3c             	sub    $0x3c,%esp
+ 56d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 570:	85 d2                	test   %edx,%edx
+ 572:	0f 89 80 00 00 00    	jns    5f8 <printint+0x98>
+ 578:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 57c:	74 7a                	je     5f8 <printint+0x98>
+    x = -xx;
+ 57e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 580:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 585:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 588:	31 f6                	xor    %esi,%esi
+ 58a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 590:	89 c8                	mov    %ecx,%eax
+ 592:	31 d2                	xor    %edx,%edx
+ 594:	89 f7                	mov    %esi,%edi
+ 596:	f7 f3                	div    %ebx
+ 598:	8d 76 01             	lea    0x1(%esi),%esi
+ 59b:	0f b6 92 50 0a 00 00 	movzbl 0xa50(%edx),%edx
+ 5a2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 5a6:	89 ca                	mov    %ecx,%edx
+ 5a8:	89 c1                	mov    %eax,%ecx
+ 5aa:	39 da                	cmp    %ebx,%edx
+ 5ac:	73 e2                	jae    590 <printint+0x30>
+  if(neg)
+ 5ae:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 5b1:	85 c0                	test   %eax,%eax
+ 5b3:	74 07                	je     5bc <printint+0x5c>
+    buf[i++] = '-';
+ 5b5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 5ba:	89 f7                	mov    %esi,%edi
+ 5bc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 5bf:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 5c2:	01 df                	add    %ebx,%edi
+ 5c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 5c8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 5cb:	83 ec 04             	sub    $0x4,%esp
+ 5ce:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 5d1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 5d4:	6a 01                	push   $0x1
+ 5d6:	50                   	push   %eax
+ 5d7:	56                   	push   %esi
+ 5d8:	e8 8f fe ff ff       	call   46c <write>
+  while(--i >= 0)
+ 5dd:	89 f8                	mov    %edi,%eax
+ 5df:	83 c4 10             	add    $0x10,%esp
+ 5e2:	83 ef 01             	sub    $0x1,%edi
+ 5e5:	39 d8                	cmp    %ebx,%eax
+ 5e7:	75 df                	jne    5c8 <printint+0x68>
+}
+ 5e9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5ec:	5b                   	pop    %ebx
+ 5ed:	5e                   	pop    %esi
+ 5ee:	5f                   	pop    %edi
+ 5ef:	5d                   	pop    %ebp
+ 5f0:	c3                   	ret
+ 5f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 5f8:	31 c0                	xor    %eax,%eax
+ 5fa:	eb 89                	jmp    585 <printint+0x25>
+ 5fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000600 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 600:	55                   	push   %ebp
+ 601:	89 e5                	mov    %esp,%ebp
+ 603:	57                   	push   %edi
+ 604:	56                   	push   %esi
+ 605:	53                   	push   %ebx
+ 606:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 609:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 60c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 60f:	0f b6 1e             	movzbl (%esi),%ebx
+ 612:	83 c6 01             	add    $0x1,%esi
+ 615:	84 db                	test   %bl,%bl
+ 617:	74 67                	je     680 <printf+0x80>
+ 619:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 61c:	31 d2                	xor    %edx,%edx
+ 61e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 621:	eb 34                	jmp    657 <printf+0x57>
+ 623:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 627:	90                   	nop
+ 628:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 62b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 630:	83 f8 25             	cmp    $0x25,%eax
+ 633:	74 18                	je     64d <printf+0x4d>
+  write(fd, &c, 1);
+ 635:	83 ec 04             	sub    $0x4,%esp
+ 638:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 63b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 63e:	6a 01                	push   $0x1
+ 640:	50                   	push   %eax
+ 641:	57                   	push   %edi
+ 642:	e8 25 fe ff ff       	call   46c <write>
+ 647:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 64a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 64d:	0f b6 1e             	movzbl (%esi),%ebx
+ 650:	83 c6 01             	add    $0x1,%esi
+ 653:	84 db                	test   %bl,%bl
+ 655:	74 29                	je     680 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 657:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 65a:	85 d2                	test   %edx,%edx
+ 65c:	74 ca                	je     628 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 65e:	83 fa 25             	cmp    $0x25,%edx
+ 661:	75 ea                	jne    64d <printf+0x4d>
+      if(c == 'd'){
+ 663:	83 f8 25             	cmp    $0x25,%eax
+ 666:	0f 84 24 01 00 00    	je     790 <printf+0x190>
+ 66c:	83 e8 63             	sub    $0x63,%eax
+ 66f:	83 f8 15             	cmp    $0x15,%eax
+ 672:	77 1c                	ja     690 <printf+0x90>
+ 674:	ff 24 85 f8 09 00 00 	jmp    *0x9f8(,%eax,4)
+ 67b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 67f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 680:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 683:	5b                   	pop    %ebx
+ 684:	5e                   	pop    %esi
+ 685:	5f                   	pop    %edi
+ 686:	5d                   	pop    %ebp
+ 687:	c3                   	ret
+ 688:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 68f:	90                   	nop
+  write(fd, &c, 1);
+ 690:	83 ec 04             	sub    $0x4,%esp
+ 693:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 696:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 69a:	6a 01                	push   $0x1
+ 69c:	52                   	push   %edx
+ 69d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 6a0:	57                   	push   %edi
+ 6a1:	e8 c6 fd ff ff       	call   46c <write>
+ 6a6:	83 c4 0c             	add    $0xc,%esp
+ 6a9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 6ac:	6a 01                	push   $0x1
+ 6ae:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 6b1:	52                   	push   %edx
+ 6b2:	57                   	push   %edi
+ 6b3:	e8 b4 fd ff ff       	call   46c <write>
+        putc(fd, c);
+ 6b8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6bb:	31 d2                	xor    %edx,%edx
+ 6bd:	eb 8e                	jmp    64d <printf+0x4d>
+ 6bf:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 6c0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 6c3:	83 ec 0c             	sub    $0xc,%esp
+ 6c6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 6cb:	8b 13                	mov    (%ebx),%edx
+ 6cd:	6a 00                	push   $0x0
+ 6cf:	89 f8                	mov    %edi,%eax
+        ap++;
+ 6d1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 6d4:	e8 87 fe ff ff       	call   560 <printint>
+        ap++;
+ 6d9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 6dc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6df:	31 d2                	xor    %edx,%edx
+ 6e1:	e9 67 ff ff ff       	jmp    64d <printf+0x4d>
+ 6e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6ed:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 6f0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 6f3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 6f5:	83 c0 04             	add    $0x4,%eax
+ 6f8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 6fb:	85 db                	test   %ebx,%ebx
+ 6fd:	0f 84 9d 00 00 00    	je     7a0 <printf+0x1a0>
+        while(*s != 0){
+ 703:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 706:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 708:	84 c0                	test   %al,%al
+ 70a:	0f 84 3d ff ff ff    	je     64d <printf+0x4d>
+ 710:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 713:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 716:	89 de                	mov    %ebx,%esi
+ 718:	89 d3                	mov    %edx,%ebx
+ 71a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 720:	83 ec 04             	sub    $0x4,%esp
+ 723:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 726:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 729:	6a 01                	push   $0x1
+ 72b:	53                   	push   %ebx
+ 72c:	57                   	push   %edi
+ 72d:	e8 3a fd ff ff       	call   46c <write>
+        while(*s != 0){
+ 732:	0f b6 06             	movzbl (%esi),%eax
+ 735:	83 c4 10             	add    $0x10,%esp
+ 738:	84 c0                	test   %al,%al
+ 73a:	75 e4                	jne    720 <printf+0x120>
+      state = 0;
+ 73c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 73f:	31 d2                	xor    %edx,%edx
+ 741:	e9 07 ff ff ff       	jmp    64d <printf+0x4d>
+ 746:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 74d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 750:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 753:	83 ec 0c             	sub    $0xc,%esp
+ 756:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 75b:	8b 13                	mov    (%ebx),%edx
+ 75d:	6a 01                	push   $0x1
+ 75f:	e9 6b ff ff ff       	jmp    6cf <printf+0xcf>
+ 764:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 768:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 76b:	83 ec 04             	sub    $0x4,%esp
+ 76e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 771:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 773:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 776:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 779:	6a 01                	push   $0x1
+ 77b:	52                   	push   %edx
+ 77c:	57                   	push   %edi
+ 77d:	e8 ea fc ff ff       	call   46c <write>
+        ap++;
+ 782:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 785:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 788:	31 d2                	xor    %edx,%edx
+ 78a:	e9 be fe ff ff       	jmp    64d <printf+0x4d>
+ 78f:	90                   	nop
+  write(fd, &c, 1);
+ 790:	83 ec 04             	sub    $0x4,%esp
+ 793:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 796:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 799:	6a 01                	push   $0x1
+ 79b:	e9 11 ff ff ff       	jmp    6b1 <printf+0xb1>
+ 7a0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 7a5:	bb f0 09 00 00       	mov    $0x9f0,%ebx
+ 7aa:	e9 61 ff ff ff       	jmp    710 <printf+0x110>
+ 7af:	90                   	nop
+
+000007b0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 7b0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7b1:	a1 40 15 00 00       	mov    0x1540,%eax
+{
+ 7b6:	89 e5                	mov    %esp,%ebp
+ 7b8:	57                   	push   %edi
+ 7b9:	56                   	push   %esi
+ 7ba:	53                   	push   %ebx
+ 7bb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 7be:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7c8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7ca:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7cc:	39 ca                	cmp    %ecx,%edx
+ 7ce:	73 30                	jae    800 <free+0x50>
+ 7d0:	39 c1                	cmp    %eax,%ecx
+ 7d2:	72 04                	jb     7d8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7d4:	39 c2                	cmp    %eax,%edx
+ 7d6:	72 f0                	jb     7c8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 7d8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 7db:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 7de:	39 f8                	cmp    %edi,%eax
+ 7e0:	74 2e                	je     810 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 7e2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 7e5:	8b 42 04             	mov    0x4(%edx),%eax
+ 7e8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 7eb:	39 f1                	cmp    %esi,%ecx
+ 7ed:	74 38                	je     827 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 7ef:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 7f1:	5b                   	pop    %ebx
+  freep = p;
+ 7f2:	89 15 40 15 00 00    	mov    %edx,0x1540
+}
+ 7f8:	5e                   	pop    %esi
+ 7f9:	5f                   	pop    %edi
+ 7fa:	5d                   	pop    %ebp
+ 7fb:	c3                   	ret
+ 7fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 800:	39 c1                	cmp    %eax,%ecx
+ 802:	72 d0                	jb     7d4 <free+0x24>
+ 804:	eb c2                	jmp    7c8 <free+0x18>
+ 806:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 80d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 810:	03 70 04             	add    0x4(%eax),%esi
+ 813:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 816:	8b 02                	mov    (%edx),%eax
+ 818:	8b 00                	mov    (%eax),%eax
+ 81a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 81d:	8b 42 04             	mov    0x4(%edx),%eax
+ 820:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 823:	39 f1                	cmp    %esi,%ecx
+ 825:	75 c8                	jne    7ef <free+0x3f>
+    p->s.size += bp->s.size;
+ 827:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 82a:	89 15 40 15 00 00    	mov    %edx,0x1540
+    p->s.size += bp->s.size;
+ 830:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 833:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 836:	89 0a                	mov    %ecx,(%edx)
+}
+ 838:	5b                   	pop    %ebx
+ 839:	5e                   	pop    %esi
+ 83a:	5f                   	pop    %edi
+ 83b:	5d                   	pop    %ebp
+ 83c:	c3                   	ret
+ 83d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000840 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 840:	55                   	push   %ebp
+ 841:	89 e5                	mov    %esp,%ebp
+ 843:	57                   	push   %edi
+ 844:	56                   	push   %esi
+ 845:	53                   	push   %ebx
+ 846:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 849:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 84c:	8b 15 40 15 00 00    	mov    0x1540,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 852:	8d 78 07             	lea    0x7(%eax),%edi
+ 855:	c1 ef 03             	shr    $0x3,%edi
+ 858:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 85b:	85 d2                	test   %edx,%edx
+ 85d:	0f 84 8d 00 00 00    	je     8f0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 863:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 865:	8b 48 04             	mov    0x4(%eax),%ecx
+ 868:	39 f9                	cmp    %edi,%ecx
+ 86a:	73 64                	jae    8d0 <malloc+0x90>
+  if(nu < 4096)
+ 86c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 871:	39 df                	cmp    %ebx,%edi
+ 873:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 876:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 87d:	eb 0a                	jmp    889 <malloc+0x49>
+ 87f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 880:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 882:	8b 48 04             	mov    0x4(%eax),%ecx
+ 885:	39 f9                	cmp    %edi,%ecx
+ 887:	73 47                	jae    8d0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 889:	89 c2                	mov    %eax,%edx
+ 88b:	39 05 40 15 00 00    	cmp    %eax,0x1540
+ 891:	75 ed                	jne    880 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 893:	83 ec 0c             	sub    $0xc,%esp
+ 896:	56                   	push   %esi
+ 897:	e8 38 fc ff ff       	call   4d4 <sbrk>
+  if(p == (char*)-1)
+ 89c:	83 c4 10             	add    $0x10,%esp
+ 89f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 8a2:	74 1c                	je     8c0 <malloc+0x80>
+  hp->s.size = nu;
+ 8a4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 8a7:	83 ec 0c             	sub    $0xc,%esp
+ 8aa:	83 c0 08             	add    $0x8,%eax
+ 8ad:	50                   	push   %eax
+ 8ae:	e8 fd fe ff ff       	call   7b0 <free>
+  return freep;
+ 8b3:	8b 15 40 15 00 00    	mov    0x1540,%edx
+      if((p = morecore(nunits)) == 0)
+ 8b9:	83 c4 10             	add    $0x10,%esp
+ 8bc:	85 d2                	test   %edx,%edx
+ 8be:	75 c0                	jne    880 <malloc+0x40>
+        return 0;
+  }
+}
+ 8c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 8c3:	31 c0                	xor    %eax,%eax
+}
+ 8c5:	5b                   	pop    %ebx
+ 8c6:	5e                   	pop    %esi
+ 8c7:	5f                   	pop    %edi
+ 8c8:	5d                   	pop    %ebp
+ 8c9:	c3                   	ret
+ 8ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 8d0:	39 cf                	cmp    %ecx,%edi
+ 8d2:	74 4c                	je     920 <malloc+0xe0>
+        p->s.size -= nunits;
+ 8d4:	29 f9                	sub    %edi,%ecx
+ 8d6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 8d9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 8dc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 8df:	89 15 40 15 00 00    	mov    %edx,0x1540
+}
+ 8e5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 8e8:	83 c0 08             	add    $0x8,%eax
+}
+ 8eb:	5b                   	pop    %ebx
+ 8ec:	5e                   	pop    %esi
+ 8ed:	5f                   	pop    %edi
+ 8ee:	5d                   	pop    %ebp
+ 8ef:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 8f0:	c7 05 40 15 00 00 44 	movl   $0x1544,0x1540
+ 8f7:	15 00 00 
+    base.s.size = 0;
+ 8fa:	b8 44 15 00 00       	mov    $0x1544,%eax
+    base.s.ptr = freep = prevp = &base;
+ 8ff:	c7 05 44 15 00 00 44 	movl   $0x1544,0x1544
+ 906:	15 00 00 
+    base.s.size = 0;
+ 909:	c7 05 48 15 00 00 00 	movl   $0x0,0x1548
+ 910:	00 00 00 
+    if(p->s.size >= nunits){
+ 913:	e9 54 ff ff ff       	jmp    86c <malloc+0x2c>
+ 918:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 91f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 920:	8b 08                	mov    (%eax),%ecx
+ 922:	89 0a                	mov    %ecx,(%edx)
+ 924:	eb b9                	jmp    8df <malloc+0x9f>
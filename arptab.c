@@ -0,0 +1,51 @@
+/**
+ *show or flush the kernel ARP cache
+ *usage: arptab [-f]
+ */
+#include "types.h"
+#include "user.h"
+#include "arpctl.h"
+
+static char *states[] = {
+  [ARP_FREE]      "free",
+  [ARP_REACHABLE] "reachable",
+  [ARP_STALE]     "stale",
+  [ARP_FAILED]    "failed",
+};
+
+static struct arpent ents[ARP_CACHE_SIZE];
+
+static void printhex(uint8_t b) {
+  char *digits = "0123456789abcdef";
+  printf(1, "%c%c", digits[b >> 4], digits[b & 0xf]);
+}
+
+int main(int argc, char *argv[]) {
+  int n;
+
+  if(argc == 2 && strcmp(argv[1], "-f") == 0) {
+    arpflush();
+    exit();
+  }
+  if(argc != 1) {
+    printf(2, "usage: arptab [-f]\n");
+    exit();
+  }
+
+  if((n = arpdump(ents, ARP_CACHE_SIZE)) < 0) {
+    printf(2, "arptab: can't read the ARP cache\n");
+    exit();
+  }
+  printf(1, "address hwaddress iface state age(ticks)\n");
+  for(int i = 0; i < n; i++) {
+    uint8_t *ip = (uint8_t*)&ents[i].ip;
+    printf(1, "%d.%d.%d.%d ", ip[0], ip[1], ip[2], ip[3]);
+    for(int j = 0; j < 6; j++) {
+      printhex(ents[i].mac[j]);
+      if(j < 5)
+        printf(1, ":");
+    }
+    printf(1, " eth%d %s %d\n", ents[i].ifindex, states[ents[i].state], ents[i].age);
+  }
+  exit();
+}
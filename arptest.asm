@@ -0,0 +1,1620 @@
+
+_arptest:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+    check("direct send", arpsend(interface, ip, frame, FRAME_LEN) == 0 && drops(interface) == before);
+  else
+    check("send to failed", arpsend(interface, ip, frame, FRAME_LEN) < 0 && drops(interface) - before == 1);
+}
+
+int main(int argc, char *argv[]) {
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 28             	sub    $0x28,%esp
+  14:	8b 01                	mov    (%ecx),%eax
+  16:	8b 59 04             	mov    0x4(%ecx),%ebx
+  uint addr;
+
+  if(argc == 3) {
+  19:	83 f8 03             	cmp    $0x3,%eax
+  1c:	74 44                	je     62 <main+0x62>
+    }
+    queuetest(argv[1], addr);
+    printf(1, "arptest: %s\n", failed ? "FAILED" : "passed");
+    exit();
+  }
+  if(argc != 1) {
+  1e:	83 f8 01             	cmp    $0x1,%eax
+  21:	74 13                	je     36 <main+0x36>
+    printf(2, "usage: arptest [interface a.b.c.d]\n");
+  23:	52                   	push   %edx
+  24:	52                   	push   %edx
+  25:	68 90 0b 00 00       	push   $0xb90
+  2a:	6a 02                	push   $0x2
+  2c:	e8 7f 07 00 00       	call   7b0 <printf>
+    exit();
+  31:	e8 c6 05 00 00       	call   5fc <exit>
+  }
+
+  int MAC_SIZE = 18;
+  char* ip = "192.168.2.1";
+  char* mac = malloc(MAC_SIZE);
+  36:	83 ec 0c             	sub    $0xc,%esp
+  39:	6a 12                	push   $0x12
+  3b:	e8 b0 09 00 00       	call   9f0 <malloc>
+  if(arp("eth0", ip, mac, MAC_SIZE) < 0) {
+  40:	6a 12                	push   $0x12
+  42:	50                   	push   %eax
+  43:	68 67 0b 00 00       	push   $0xb67
+  48:	68 73 0b 00 00       	push   $0xb73
+  4d:	e8 4a 06 00 00       	call   69c <arp>
+  52:	83 c4 20             	add    $0x20,%esp
+  55:	85 c0                	test   %eax,%eax
+  57:	0f 88 96 01 00 00    	js     1f3 <main+0x1f3>
+    printf(1, "ARP for IP:%s Failed.\n", ip);
+  }
+  exit();
+  5d:	e8 9a 05 00 00       	call   5fc <exit>
+    if(parseip(argv[2], &addr) < 0) {
+  62:	8d 45 d8             	lea    -0x28(%ebp),%eax
+  65:	57                   	push   %edi
+  66:	57                   	push   %edi
+  67:	50                   	push   %eax
+  68:	ff 73 08             	push   0x8(%ebx)
+  6b:	e8 70 04 00 00       	call   4e0 <parseip>
+  70:	83 c4 10             	add    $0x10,%esp
+  73:	85 c0                	test   %eax,%eax
+  75:	0f 88 63 01 00 00    	js     1de <main+0x1de>
+    queuetest(argv[1], addr);
+  7b:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  7e:	8b 7b 04             	mov    0x4(%ebx),%edi
+  int r, sent = 0;
+  81:	31 f6                	xor    %esi,%esi
+  83:	bb 0a 00 00 00       	mov    $0xa,%ebx
+    queuetest(argv[1], addr);
+  88:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  arpflush();
+  8b:	e8 44 06 00 00       	call   6d4 <arpflush>
+  frame[12] = 0x88;
+  90:	0f b7 05 b4 0b 00 00 	movzwl 0xbb4,%eax
+  uint n = 0;
+  97:	31 d2                	xor    %edx,%edx
+  99:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  frame[12] = 0x88;
+  9c:	66 a3 6c 0f 00 00    	mov    %ax,0xf6c
+  nicget(interface, NICCTL_ARPQ_DROPS, &n);
+  a2:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  a5:	51                   	push   %ecx
+  a6:	50                   	push   %eax
+  a7:	6a 16                	push   $0x16
+  a9:	57                   	push   %edi
+  aa:	e8 f5 05 00 00       	call   6a4 <nicget>
+  return n;
+  af:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  b2:	83 c4 10             	add    $0x10,%esp
+  b5:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  for(int i = 0; i < ARP_QUEUE_MAX + 2; i++)
+  b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  bf:	90                   	nop
+    if(arpsend(interface, ip, frame, FRAME_LEN) == 0)
+  c0:	6a 40                	push   $0x40
+  c2:	68 60 0f 00 00       	push   $0xf60
+  c7:	ff 75 d4             	push   -0x2c(%ebp)
+  ca:	57                   	push   %edi
+  cb:	e8 2c 06 00 00       	call   6fc <arpsend>
+  d0:	83 c4 10             	add    $0x10,%esp
+      sent++;
+  d3:	83 f8 01             	cmp    $0x1,%eax
+  d6:	83 d6 00             	adc    $0x0,%esi
+  for(int i = 0; i < ARP_QUEUE_MAX + 2; i++)
+  d9:	83 eb 01             	sub    $0x1,%ebx
+  dc:	75 e2                	jne    c0 <main+0xc0>
+  check("queue", sent == ARP_QUEUE_MAX + 2);
+  de:	31 d2                	xor    %edx,%edx
+  e0:	83 fe 0a             	cmp    $0xa,%esi
+  e3:	b8 12 0b 00 00       	mov    $0xb12,%eax
+  e8:	0f 94 c2             	sete   %dl
+  eb:	e8 00 02 00 00       	call   2f0 <check>
+  uint n = 0;
+  f0:	31 c0                	xor    %eax,%eax
+  f2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  nicget(interface, NICCTL_ARPQ_DROPS, &n);
+  f5:	50                   	push   %eax
+  f6:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  f9:	50                   	push   %eax
+  fa:	6a 16                	push   $0x16
+  fc:	57                   	push   %edi
+  fd:	e8 a2 05 00 00       	call   6a4 <nicget>
+  check("overflow", drops(interface) - before == 2);
+ 102:	8b 55 d0             	mov    -0x30(%ebp),%edx
+ 105:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 108:	29 d0                	sub    %edx,%eax
+ 10a:	31 d2                	xor    %edx,%edx
+ 10c:	83 f8 02             	cmp    $0x2,%eax
+ 10f:	b8 18 0b 00 00       	mov    $0xb18,%eax
+ 114:	0f 94 c2             	sete   %dl
+ 117:	e8 d4 01 00 00       	call   2f0 <check>
+  uint n = 0;
+ 11c:	31 c0                	xor    %eax,%eax
+  nicget(interface, NICCTL_ARPQ_DROPS, &n);
+ 11e:	83 c4 0c             	add    $0xc,%esp
+  uint n = 0;
+ 121:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  nicget(interface, NICCTL_ARPQ_DROPS, &n);
+ 124:	8d 45 e0             	lea    -0x20(%ebp),%eax
+ 127:	50                   	push   %eax
+ 128:	6a 16                	push   $0x16
+ 12a:	57                   	push   %edi
+ 12b:	e8 74 05 00 00       	call   6a4 <nicget>
+  r = arpresolve(interface, ip, mac, 0);
+ 130:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  return n;
+ 133:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  r = arpresolve(interface, ip, mac, 0);
+ 136:	6a 00                	push   $0x0
+ 138:	50                   	push   %eax
+ 139:	ff 75 d4             	push   -0x2c(%ebp)
+ 13c:	57                   	push   %edi
+ 13d:	e8 aa 05 00 00       	call   6ec <arpresolve>
+  if(r == 0)
+ 142:	83 c4 20             	add    $0x20,%esp
+ 145:	85 c0                	test   %eax,%eax
+ 147:	0f 84 c0 00 00 00    	je     20d <main+0x20d>
+  else if(r == ARP_EUNREACH)
+ 14d:	83 f8 fd             	cmp    $0xfffffffd,%eax
+ 150:	0f 84 39 01 00 00    	je     28f <main+0x28f>
+  printf(1, "arptest: %s %s\n", what, ok ? "ok" : "FAILED");
+ 156:	68 eb 0a 00 00       	push   $0xaeb
+  nicget(interface, NICCTL_ARPQ_DROPS, &n);
+ 15b:	8d 75 dc             	lea    -0x24(%ebp),%esi
+  printf(1, "arptest: %s %s\n", what, ok ? "ok" : "FAILED");
+ 15e:	68 37 0b 00 00       	push   $0xb37
+ 163:	68 db 0a 00 00       	push   $0xadb
+ 168:	6a 01                	push   $0x1
+ 16a:	e8 41 06 00 00       	call   7b0 <printf>
+  uint n = 0;
+ 16f:	31 c0                	xor    %eax,%eax
+  nicget(interface, NICCTL_ARPQ_DROPS, &n);
+ 171:	83 c4 0c             	add    $0xc,%esp
+    failed = 1;
+ 174:	c7 05 40 0f 00 00 01 	movl   $0x1,0xf40
+ 17b:	00 00 00 
+  uint n = 0;
+ 17e:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  nicget(interface, NICCTL_ARPQ_DROPS, &n);
+ 181:	56                   	push   %esi
+ 182:	6a 16                	push   $0x16
+ 184:	57                   	push   %edi
+ 185:	e8 1a 05 00 00       	call   6a4 <nicget>
+  return n;
+ 18a:	83 c4 10             	add    $0x10,%esp
+ 18d:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+    check("send to failed", arpsend(interface, ip, frame, FRAME_LEN) < 0 && drops(interface) - before == 1);
+ 190:	6a 40                	push   $0x40
+ 192:	68 60 0f 00 00       	push   $0xf60
+ 197:	ff 75 d4             	push   -0x2c(%ebp)
+ 19a:	57                   	push   %edi
+ 19b:	e8 5c 05 00 00       	call   6fc <arpsend>
+ 1a0:	83 c4 10             	add    $0x10,%esp
+ 1a3:	31 d2                	xor    %edx,%edx
+ 1a5:	85 c0                	test   %eax,%eax
+ 1a7:	0f 88 18 01 00 00    	js     2c5 <main+0x2c5>
+ 1ad:	b8 4b 0b 00 00       	mov    $0xb4b,%eax
+ 1b2:	e8 39 01 00 00       	call   2f0 <check>
+    printf(1, "arptest: %s\n", failed ? "FAILED" : "passed");
+ 1b7:	83 3d 40 0f 00 00 00 	cmpl   $0x0,0xf40
+ 1be:	ba eb 0a 00 00       	mov    $0xaeb,%edx
+ 1c3:	b8 f2 0a 00 00       	mov    $0xaf2,%eax
+ 1c8:	51                   	push   %ecx
+ 1c9:	0f 45 c2             	cmovne %edx,%eax
+ 1cc:	50                   	push   %eax
+ 1cd:	68 5a 0b 00 00       	push   $0xb5a
+ 1d2:	6a 01                	push   $0x1
+ 1d4:	e8 d7 05 00 00       	call   7b0 <printf>
+    exit();
+ 1d9:	e8 1e 04 00 00       	call   5fc <exit>
+      printf(2, "arptest: bad address %s\n", argv[2]);
+ 1de:	56                   	push   %esi
+ 1df:	ff 73 08             	push   0x8(%ebx)
+ 1e2:	68 f9 0a 00 00       	push   $0xaf9
+ 1e7:	6a 02                	push   $0x2
+ 1e9:	e8 c2 05 00 00       	call   7b0 <printf>
+      exit();
+ 1ee:	e8 09 04 00 00       	call   5fc <exit>
+    printf(1, "ARP for IP:%s Failed.\n", ip);
+ 1f3:	50                   	push   %eax
+ 1f4:	68 67 0b 00 00       	push   $0xb67
+ 1f9:	68 78 0b 00 00       	push   $0xb78
+ 1fe:	6a 01                	push   $0x1
+ 200:	e8 ab 05 00 00       	call   7b0 <printf>
+ 205:	83 c4 10             	add    $0x10,%esp
+ 208:	e9 50 fe ff ff       	jmp    5d <main+0x5d>
+  uint n = 0;
+ 20d:	31 f6                	xor    %esi,%esi
+ 20f:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 212:	89 75 dc             	mov    %esi,-0x24(%ebp)
+  nicget(interface, NICCTL_ARPQ_DROPS, &n);
+ 215:	8d 75 dc             	lea    -0x24(%ebp),%esi
+ 218:	50                   	push   %eax
+ 219:	56                   	push   %esi
+ 21a:	6a 16                	push   $0x16
+ 21c:	57                   	push   %edi
+ 21d:	e8 82 04 00 00       	call   6a4 <nicget>
+    check("flush", drops(interface) == before);
+ 222:	31 d2                	xor    %edx,%edx
+ 224:	3b 5d dc             	cmp    -0x24(%ebp),%ebx
+ 227:	b8 21 0b 00 00       	mov    $0xb21,%eax
+ 22c:	0f 94 c2             	sete   %dl
+ 22f:	e8 bc 00 00 00       	call   2f0 <check>
+  nicget(interface, NICCTL_ARPQ_DROPS, &n);
+ 234:	83 c4 0c             	add    $0xc,%esp
+  uint n = 0;
+ 237:	31 c0                	xor    %eax,%eax
+ 239:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  nicget(interface, NICCTL_ARPQ_DROPS, &n);
+ 23c:	56                   	push   %esi
+ 23d:	6a 16                	push   $0x16
+ 23f:	57                   	push   %edi
+ 240:	e8 5f 04 00 00       	call   6a4 <nicget>
+  return n;
+ 245:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+    check("direct send", arpsend(interface, ip, frame, FRAME_LEN) == 0 && drops(interface) == before);
+ 248:	6a 40                	push   $0x40
+ 24a:	68 60 0f 00 00       	push   $0xf60
+ 24f:	ff 75 d4             	push   -0x2c(%ebp)
+ 252:	57                   	push   %edi
+ 253:	e8 a4 04 00 00       	call   6fc <arpsend>
+ 258:	83 c4 20             	add    $0x20,%esp
+ 25b:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+ 25e:	85 c0                	test   %eax,%eax
+ 260:	74 11                	je     273 <main+0x273>
+ 262:	89 ca                	mov    %ecx,%edx
+ 264:	b8 3f 0b 00 00       	mov    $0xb3f,%eax
+ 269:	e8 82 00 00 00       	call   2f0 <check>
+ 26e:	e9 44 ff ff ff       	jmp    1b7 <main+0x1b7>
+  uint n = 0;
+ 273:	31 c0                	xor    %eax,%eax
+ 275:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  nicget(interface, NICCTL_ARPQ_DROPS, &n);
+ 278:	50                   	push   %eax
+ 279:	56                   	push   %esi
+ 27a:	6a 16                	push   $0x16
+ 27c:	57                   	push   %edi
+ 27d:	e8 22 04 00 00       	call   6a4 <nicget>
+    check("direct send", arpsend(interface, ip, frame, FRAME_LEN) == 0 && drops(interface) == before);
+ 282:	31 c9                	xor    %ecx,%ecx
+ 284:	83 c4 10             	add    $0x10,%esp
+ 287:	3b 5d dc             	cmp    -0x24(%ebp),%ebx
+ 28a:	0f 94 c1             	sete   %cl
+ 28d:	eb d3                	jmp    262 <main+0x262>
+  uint n = 0;
+ 28f:	31 d2                	xor    %edx,%edx
+  nicget(interface, NICCTL_ARPQ_DROPS, &n);
+ 291:	8d 75 dc             	lea    -0x24(%ebp),%esi
+  uint n = 0;
+ 294:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  nicget(interface, NICCTL_ARPQ_DROPS, &n);
+ 297:	51                   	push   %ecx
+ 298:	56                   	push   %esi
+ 299:	6a 16                	push   $0x16
+ 29b:	57                   	push   %edi
+ 29c:	e8 03 04 00 00       	call   6a4 <nicget>
+    check("drop on failure", drops(interface) - before == ARP_QUEUE_MAX);
+ 2a1:	8b 45 dc             	mov    -0x24(%ebp),%eax
+ 2a4:	31 d2                	xor    %edx,%edx
+ 2a6:	29 d8                	sub    %ebx,%eax
+ 2a8:	83 f8 08             	cmp    $0x8,%eax
+ 2ab:	b8 27 0b 00 00       	mov    $0xb27,%eax
+ 2b0:	0f 94 c2             	sete   %dl
+  uint n = 0;
+ 2b3:	31 db                	xor    %ebx,%ebx
+    check("drop on failure", drops(interface) - before == ARP_QUEUE_MAX);
+ 2b5:	e8 36 00 00 00       	call   2f0 <check>
+  uint n = 0;
+ 2ba:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+  nicget(interface, NICCTL_ARPQ_DROPS, &n);
+ 2bd:	83 c4 0c             	add    $0xc,%esp
+ 2c0:	e9 bc fe ff ff       	jmp    181 <main+0x181>
+  uint n = 0;
+ 2c5:	31 c0                	xor    %eax,%eax
+ 2c7:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  nicget(interface, NICCTL_ARPQ_DROPS, &n);
+ 2ca:	50                   	push   %eax
+ 2cb:	56                   	push   %esi
+ 2cc:	6a 16                	push   $0x16
+ 2ce:	57                   	push   %edi
+ 2cf:	e8 d0 03 00 00       	call   6a4 <nicget>
+    check("send to failed", arpsend(interface, ip, frame, FRAME_LEN) < 0 && drops(interface) - before == 1);
+ 2d4:	8b 45 dc             	mov    -0x24(%ebp),%eax
+ 2d7:	31 d2                	xor    %edx,%edx
+ 2d9:	83 c4 10             	add    $0x10,%esp
+ 2dc:	29 d8                	sub    %ebx,%eax
+ 2de:	83 e8 01             	sub    $0x1,%eax
+ 2e1:	0f 94 c2             	sete   %dl
+ 2e4:	e9 c4 fe ff ff       	jmp    1ad <main+0x1ad>
+ 2e9:	66 90                	xchg   %ax,%ax
+ 2eb:	66 90                	xchg   %ax,%ax
+ 2ed:	66 90                	xchg   %ax,%ax
+ 2ef:	90                   	nop
+
+000002f0 <check>:
+static void check(char *what, int ok) {
+ 2f0:	55                   	push   %ebp
+ 2f1:	89 e5                	mov    %esp,%ebp
+ 2f3:	83 ec 08             	sub    $0x8,%esp
+  printf(1, "arptest: %s %s\n", what, ok ? "ok" : "FAILED");
+ 2f6:	85 d2                	test   %edx,%edx
+ 2f8:	74 17                	je     311 <check+0x21>
+ 2fa:	68 d8 0a 00 00       	push   $0xad8
+ 2ff:	50                   	push   %eax
+ 300:	68 db 0a 00 00       	push   $0xadb
+ 305:	6a 01                	push   $0x1
+ 307:	e8 a4 04 00 00       	call   7b0 <printf>
+ 30c:	83 c4 10             	add    $0x10,%esp
+}
+ 30f:	c9                   	leave
+ 310:	c3                   	ret
+  printf(1, "arptest: %s %s\n", what, ok ? "ok" : "FAILED");
+ 311:	68 eb 0a 00 00       	push   $0xaeb
+ 316:	50                   	push   %eax
+ 317:	68 db 0a 00 00       	push   $0xadb
+ 31c:	6a 01                	push   $0x1
+ 31e:	e8 8d 04 00 00       	call   7b0 <printf>
+    failed = 1;
+ 323:	83 c4 10             	add    $0x10,%esp
+ 326:	c7 05 40 0f 00 00 01 	movl   $0x1,0xf40
+ 32d:	00 00 00 
+}
+ 330:	c9                   	leave
+ 331:	c3                   	ret
+ 332:	66 90                	xchg   %ax,%ax
+ 334:	66 90                	xchg   %ax,%ax
+ 336:	66 90                	xchg   %ax,%ax
+ 338:	66 90                	xchg   %ax,%ax
+ 33a:	66 90                	xchg   %ax,%ax
+ 33c:	66 90                	xchg   %ax,%ax
+ 33e:	66 90                	xchg   %ax,%ax
+
+00000340 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 340:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 341:	31 c0                	xor    %eax,%eax
+{
+ 343:	89 e5                	mov    %esp,%ebp
+ 345:	53                   	push   %ebx
+ 346:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 349:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 34c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 350:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 354:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 357:	83 c0 01             	add    $0x1,%eax
+ 35a:	84 d2                	test   %dl,%dl
+ 35c:	75 f2                	jne    350 <strcpy+0x10>
+    ;
+  return os;
+}
+ 35e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 361:	89 c8                	mov    %ecx,%eax
+ 363:	c9                   	leave
+ 364:	c3                   	ret
+ 365:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 36c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000370 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 370:	55                   	push   %ebp
+ 371:	89 e5                	mov    %esp,%ebp
+ 373:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 376:	80 3a 00             	cmpb   $0x0,(%edx)
+ 379:	74 15                	je     390 <strlen+0x20>
+ 37b:	31 c0                	xor    %eax,%eax
+ 37d:	8d 76 00             	lea    0x0(%esi),%esi
+ 380:	83 c0 01             	add    $0x1,%eax
+ 383:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 387:	89 c1                	mov    %eax,%ecx
+ 389:	75 f5                	jne    380 <strlen+0x10>
+    ;
+  return n;
+}
+ 38b:	89 c8                	mov    %ecx,%eax
+ 38d:	5d                   	pop    %ebp
+ 38e:	c3                   	ret
+ 38f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 390:	31 c9                	xor    %ecx,%ecx
+}
+ 392:	5d                   	pop    %ebp
+ 393:	89 c8                	mov    %ecx,%eax
+ 395:	c3                   	ret
+ 396:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 39d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000003a0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 3a0:	55                   	push   %ebp
+ 3a1:	89 e5                	mov    %esp,%ebp
+ 3a3:	57                   	push   %edi
+ 3a4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 3a7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 3aa:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3ad:	89 d7                	mov    %edx,%edi
+ 3af:	fc                   	cld
+ 3b0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 3b2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 3b5:	89 d0                	mov    %edx,%eax
+ 3b7:	c9                   	leave
+ 3b8:	c3                   	ret
+ 3b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000003c0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 3c0:	55                   	push   %ebp
+ 3c1:	89 e5                	mov    %esp,%ebp
+ 3c3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3c6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 3ca:	0f b6 10             	movzbl (%eax),%edx
+ 3cd:	84 d2                	test   %dl,%dl
+ 3cf:	75 12                	jne    3e3 <strchr+0x23>
+ 3d1:	eb 1d                	jmp    3f0 <strchr+0x30>
+ 3d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3d7:	90                   	nop
+ 3d8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 3dc:	83 c0 01             	add    $0x1,%eax
+ 3df:	84 d2                	test   %dl,%dl
+ 3e1:	74 0d                	je     3f0 <strchr+0x30>
+    if(*s == c)
+ 3e3:	38 d1                	cmp    %dl,%cl
+ 3e5:	75 f1                	jne    3d8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 3e7:	5d                   	pop    %ebp
+ 3e8:	c3                   	ret
+ 3e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 3f0:	31 c0                	xor    %eax,%eax
+}
+ 3f2:	5d                   	pop    %ebp
+ 3f3:	c3                   	ret
+ 3f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3ff:	90                   	nop
+
+00000400 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 400:	55                   	push   %ebp
+ 401:	89 e5                	mov    %esp,%ebp
+ 403:	57                   	push   %edi
+ 404:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 405:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 408:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 409:	31 db                	xor    %ebx,%ebx
+{
+ 40b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 40e:	eb 27                	jmp    437 <gets+0x37>
+    cc = read(0, &c, 1);
+ 410:	83 ec 04             	sub    $0x4,%esp
+ 413:	6a 01                	push   $0x1
+ 415:	56                   	push   %esi
+ 416:	6a 00                	push   $0x0
+ 418:	e8 f7 01 00 00       	call   614 <read>
+    if(cc < 1)
+ 41d:	83 c4 10             	add    $0x10,%esp
+ 420:	85 c0                	test   %eax,%eax
+ 422:	7e 1d                	jle    441 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 424:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 428:	8b 55 08             	mov    0x8(%ebp),%edx
+ 42b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 42f:	3c 0a                	cmp    $0xa,%al
+ 431:	74 10                	je     443 <gets+0x43>
+ 433:	3c 0d                	cmp    $0xd,%al
+ 435:	74 0c                	je     443 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 437:	89 df                	mov    %ebx,%edi
+ 439:	83 c3 01             	add    $0x1,%ebx
+ 43c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 43f:	7c cf                	jl     410 <gets+0x10>
+ 441:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 443:	8b 45 08             	mov    0x8(%ebp),%eax
+ 446:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 44a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 44d:	5b                   	pop    %ebx
+ 44e:	5e                   	pop    %esi
+ 44f:	5f                   	pop    %edi
+ 450:	5d                   	pop    %ebp
+ 451:	c3                   	ret
+ 452:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 459:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000460 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 460:	55                   	push   %ebp
+ 461:	89 e5                	mov    %esp,%ebp
+ 463:	56                   	push   %esi
+ 464:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 465:	83 ec 08             	sub    $0x8,%esp
+ 468:	6a 00                	push   $0x0
+ 46a:	ff 75 08             	push   0x8(%ebp)
+ 46d:	e8 ca 01 00 00       	call   63c <open>
+  if(fd < 0)
+ 472:	83 c4 10             	add    $0x10,%esp
+ 475:	85 c0                	test   %eax,%eax
+ 477:	78 27                	js     4a0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 479:	83 ec 08             	sub    $0x8,%esp
+ 47c:	ff 75 0c             	push   0xc(%ebp)
+ 47f:	89 c3                	mov    %eax,%ebx
+ 481:	50                   	push   %eax
+ 482:	e8 cd 01 00 00       	call   654 <fstat>
+  close(fd);
+ 487:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 48a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 48c:	e8 93 01 00 00       	call   624 <close>
+  return r;
+ 491:	83 c4 10             	add    $0x10,%esp
+}
+ 494:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 497:	89 f0                	mov    %esi,%eax
+ 499:	5b                   	pop    %ebx
+ 49a:	5e                   	pop    %esi
+ 49b:	5d                   	pop    %ebp
+ 49c:	c3                   	ret
+ 49d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 4a0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 4a5:	eb ed                	jmp    494 <stat+0x34>
+ 4a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4ae:	66 90                	xchg   %ax,%ax
+
+000004b0 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 4b0:	55                   	push   %ebp
+ 4b1:	89 e5                	mov    %esp,%ebp
+ 4b3:	57                   	push   %edi
+ 4b4:	56                   	push   %esi
+ 4b5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 4b8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 4bb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 4be:	85 c0                	test   %eax,%eax
+ 4c0:	7e 13                	jle    4d5 <memmove+0x25>
+ 4c2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 4c4:	89 d7                	mov    %edx,%edi
+ 4c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4cd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 4d0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 4d1:	39 f8                	cmp    %edi,%eax
+ 4d3:	75 fb                	jne    4d0 <memmove+0x20>
+  return vdst;
+}
+ 4d5:	5e                   	pop    %esi
+ 4d6:	89 d0                	mov    %edx,%eax
+ 4d8:	5f                   	pop    %edi
+ 4d9:	5d                   	pop    %ebp
+ 4da:	c3                   	ret
+ 4db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4df:	90                   	nop
+
+000004e0 <parseip>:
+
+// a.b.c.d to network byte order. -1 if malformed
+int
+parseip(char *s, uint *addr)
+{
+ 4e0:	55                   	push   %ebp
+ 4e1:	89 e5                	mov    %esp,%ebp
+ 4e3:	57                   	push   %edi
+  uint8_t *b = (uint8_t*)addr;
+  int v;
+
+  for(int i = 0; i < 4; i++) {
+ 4e4:	31 ff                	xor    %edi,%edi
+{
+ 4e6:	56                   	push   %esi
+ 4e7:	53                   	push   %ebx
+ 4e8:	8b 55 08             	mov    0x8(%ebp),%edx
+    if(*s < '0' || *s > '9')
+ 4eb:	0f be 02             	movsbl (%edx),%eax
+ 4ee:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 4f1:	80 f9 09             	cmp    $0x9,%cl
+ 4f4:	77 59                	ja     54f <parseip+0x6f>
+      return -1;
+    for(v = 0; *s >= '0' && *s <= '9'; s++)
+ 4f6:	31 c9                	xor    %ecx,%ecx
+ 4f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4ff:	90                   	nop
+      v = v * 10 + *s - '0';
+ 500:	89 d6                	mov    %edx,%esi
+ 502:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    for(v = 0; *s >= '0' && *s <= '9'; s++)
+ 505:	83 c2 01             	add    $0x1,%edx
+      v = v * 10 + *s - '0';
+ 508:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+    for(v = 0; *s >= '0' && *s <= '9'; s++)
+ 50c:	0f be 02             	movsbl (%edx),%eax
+ 50f:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 512:	80 fb 09             	cmp    $0x9,%bl
+ 515:	76 e9                	jbe    500 <parseip+0x20>
+    if(v > 255 || *s != (i < 3 ? '.' : '\0'))
+ 517:	81 f9 ff 00 00 00    	cmp    $0xff,%ecx
+ 51d:	7f 30                	jg     54f <parseip+0x6f>
+ 51f:	83 ff 03             	cmp    $0x3,%edi
+ 522:	74 1c                	je     540 <parseip+0x60>
+ 524:	83 f8 2e             	cmp    $0x2e,%eax
+ 527:	75 26                	jne    54f <parseip+0x6f>
+      return -1;
+    b[i] = v;
+ 529:	8b 45 0c             	mov    0xc(%ebp),%eax
+    s++;
+ 52c:	8d 56 02             	lea    0x2(%esi),%edx
+    b[i] = v;
+ 52f:	88 0c 38             	mov    %cl,(%eax,%edi,1)
+  for(int i = 0; i < 4; i++) {
+ 532:	83 c7 01             	add    $0x1,%edi
+ 535:	eb b4                	jmp    4eb <parseip+0xb>
+ 537:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 53e:	66 90                	xchg   %ax,%ax
+    if(v > 255 || *s != (i < 3 ? '.' : '\0'))
+ 540:	85 c0                	test   %eax,%eax
+ 542:	75 0b                	jne    54f <parseip+0x6f>
+    b[i] = v;
+ 544:	8b 7d 0c             	mov    0xc(%ebp),%edi
+ 547:	88 4f 03             	mov    %cl,0x3(%edi)
+  }
+  return 0;
+}
+ 54a:	5b                   	pop    %ebx
+ 54b:	5e                   	pop    %esi
+ 54c:	5f                   	pop    %edi
+ 54d:	5d                   	pop    %ebp
+ 54e:	c3                   	ret
+ 54f:	5b                   	pop    %ebx
+      return -1;
+ 550:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+ 555:	5e                   	pop    %esi
+ 556:	5f                   	pop    %edi
+ 557:	5d                   	pop    %ebp
+ 558:	c3                   	ret
+ 559:	66 90                	xchg   %ax,%ax
+ 55b:	66 90                	xchg   %ax,%ax
+ 55d:	66 90                	xchg   %ax,%ax
+ 55f:	90                   	nop
+
+00000560 <atoi>:
+#include "types.h"
+#include "util.h"
+
+int
+atoi(const char *s)
+{
+ 560:	55                   	push   %ebp
+ 561:	89 e5                	mov    %esp,%ebp
+ 563:	53                   	push   %ebx
+ 564:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 567:	0f be 02             	movsbl (%edx),%eax
+ 56a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 56d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 570:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 575:	77 1e                	ja     595 <atoi+0x35>
+ 577:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 57e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 580:	83 c2 01             	add    $0x1,%edx
+ 583:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 586:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 58a:	0f be 02             	movsbl (%edx),%eax
+ 58d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 590:	80 fb 09             	cmp    $0x9,%bl
+ 593:	76 eb                	jbe    580 <atoi+0x20>
+  return n;
+}
+ 595:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 598:	89 c8                	mov    %ecx,%eax
+ 59a:	c9                   	leave
+ 59b:	c3                   	ret
+ 59c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000005a0 <strcmp>:
+
+
+int
+strcmp(const char *p, const char *q)
+{
+ 5a0:	55                   	push   %ebp
+ 5a1:	89 e5                	mov    %esp,%ebp
+ 5a3:	53                   	push   %ebx
+ 5a4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 5a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 5aa:	0f b6 02             	movzbl (%edx),%eax
+ 5ad:	84 c0                	test   %al,%al
+ 5af:	75 17                	jne    5c8 <strcmp+0x28>
+ 5b1:	eb 3a                	jmp    5ed <strcmp+0x4d>
+ 5b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5b7:	90                   	nop
+ 5b8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 5bc:	83 c2 01             	add    $0x1,%edx
+ 5bf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 5c2:	84 c0                	test   %al,%al
+ 5c4:	74 1a                	je     5e0 <strcmp+0x40>
+    p++, q++;
+ 5c6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 5c8:	0f b6 19             	movzbl (%ecx),%ebx
+ 5cb:	38 c3                	cmp    %al,%bl
+ 5cd:	74 e9                	je     5b8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 5cf:	29 d8                	sub    %ebx,%eax
+}
+ 5d1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 5d4:	c9                   	leave
+ 5d5:	c3                   	ret
+ 5d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5dd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 5e0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 5e4:	31 c0                	xor    %eax,%eax
+ 5e6:	29 d8                	sub    %ebx,%eax
+}
+ 5e8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 5eb:	c9                   	leave
+ 5ec:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 5ed:	0f b6 19             	movzbl (%ecx),%ebx
+ 5f0:	31 c0                	xor    %eax,%eax
+ 5f2:	eb db                	jmp    5cf <strcmp+0x2f>
+
+000005f4 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 5f4:	b8 01 00 00 00       	mov    $0x1,%eax
+ 5f9:	cd 40                	int    $0x40
+ 5fb:	c3                   	ret
+
+000005fc <exit>:
+SYSCALL(exit)
+ 5fc:	b8 02 00 00 00       	mov    $0x2,%eax
+ 601:	cd 40                	int    $0x40
+ 603:	c3                   	ret
+
+00000604 <wait>:
+SYSCALL(wait)
+ 604:	b8 03 00 00 00       	mov    $0x3,%eax
+ 609:	cd 40                	int    $0x40
+ 60b:	c3                   	ret
+
+0000060c <pipe>:
+SYSCALL(pipe)
+ 60c:	b8 04 00 00 00       	mov    $0x4,%eax
+ 611:	cd 40                	int    $0x40
+ 613:	c3                   	ret
+
+00000614 <read>:
+SYSCALL(read)
+ 614:	b8 05 00 00 00       	mov    $0x5,%eax
+ 619:	cd 40                	int    $0x40
+ 61b:	c3                   	ret
+
+0000061c <write>:
+SYSCALL(write)
+ 61c:	b8 10 00 00 00       	mov    $0x10,%eax
+ 621:	cd 40                	int    $0x40
+ 623:	c3                   	ret
+
+00000624 <close>:
+SYSCALL(close)
+ 624:	b8 15 00 00 00       	mov    $0x15,%eax
+ 629:	cd 40                	int    $0x40
+ 62b:	c3                   	ret
+
+0000062c <kill>:
+SYSCALL(kill)
+ 62c:	b8 06 00 00 00       	mov    $0x6,%eax
+ 631:	cd 40                	int    $0x40
+ 633:	c3                   	ret
+
+00000634 <exec>:
+SYSCALL(exec)
+ 634:	b8 07 00 00 00       	mov    $0x7,%eax
+ 639:	cd 40                	int    $0x40
+ 63b:	c3                   	ret
+
+0000063c <open>:
+SYSCALL(open)
+ 63c:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 641:	cd 40                	int    $0x40
+ 643:	c3                   	ret
+
+00000644 <mknod>:
+SYSCALL(mknod)
+ 644:	b8 11 00 00 00       	mov    $0x11,%eax
+ 649:	cd 40                	int    $0x40
+ 64b:	c3                   	ret
+
+0000064c <unlink>:
+SYSCALL(unlink)
+ 64c:	b8 12 00 00 00       	mov    $0x12,%eax
+ 651:	cd 40                	int    $0x40
+ 653:	c3                   	ret
+
+00000654 <fstat>:
+SYSCALL(fstat)
+ 654:	b8 08 00 00 00       	mov    $0x8,%eax
+ 659:	cd 40                	int    $0x40
+ 65b:	c3                   	ret
+
+0000065c <link>:
+SYSCALL(link)
+ 65c:	b8 13 00 00 00       	mov    $0x13,%eax
+ 661:	cd 40                	int    $0x40
+ 663:	c3                   	ret
+
+00000664 <mkdir>:
+SYSCALL(mkdir)
+ 664:	b8 14 00 00 00       	mov    $0x14,%eax
+ 669:	cd 40                	int    $0x40
+ 66b:	c3                   	ret
+
+0000066c <chdir>:
+SYSCALL(chdir)
+ 66c:	b8 09 00 00 00       	mov    $0x9,%eax
+ 671:	cd 40                	int    $0x40
+ 673:	c3                   	ret
+
+00000674 <dup>:
+SYSCALL(dup)
+ 674:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 679:	cd 40                	int    $0x40
+ 67b:	c3                   	ret
+
+0000067c <getpid>:
+SYSCALL(getpid)
+ 67c:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 681:	cd 40                	int    $0x40
+ 683:	c3                   	ret
+
+00000684 <sbrk>:
+SYSCALL(sbrk)
+ 684:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 689:	cd 40                	int    $0x40
+ 68b:	c3                   	ret
+
+0000068c <sleep>:
+SYSCALL(sleep)
+ 68c:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 691:	cd 40                	int    $0x40
+ 693:	c3                   	ret
+
+00000694 <uptime>:
+SYSCALL(uptime)
+ 694:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 699:	cd 40                	int    $0x40
+ 69b:	c3                   	ret
+
+0000069c <arp>:
+SYSCALL(arp)
+ 69c:	b8 16 00 00 00       	mov    $0x16,%eax
+ 6a1:	cd 40                	int    $0x40
+ 6a3:	c3                   	ret
+
+000006a4 <nicget>:
+SYSCALL(nicget)
+ 6a4:	b8 17 00 00 00       	mov    $0x17,%eax
+ 6a9:	cd 40                	int    $0x40
+ 6ab:	c3                   	ret
+
+000006ac <nicset>:
+SYSCALL(nicset)
+ 6ac:	b8 18 00 00 00       	mov    $0x18,%eax
+ 6b1:	cd 40                	int    $0x40
+ 6b3:	c3                   	ret
+
+000006b4 <nicstats>:
+SYSCALL(nicstats)
+ 6b4:	b8 19 00 00 00       	mov    $0x19,%eax
+ 6b9:	cd 40                	int    $0x40
+ 6bb:	c3                   	ret
+
+000006bc <nicsend>:
+SYSCALL(nicsend)
+ 6bc:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 6c1:	cd 40                	int    $0x40
+ 6c3:	c3                   	ret
+
+000006c4 <nicrecv>:
+SYSCALL(nicrecv)
+ 6c4:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 6c9:	cd 40                	int    $0x40
+ 6cb:	c3                   	ret
+
+000006cc <arpdump>:
+SYSCALL(arpdump)
+ 6cc:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 6d1:	cd 40                	int    $0x40
+ 6d3:	c3                   	ret
+
+000006d4 <arpflush>:
+SYSCALL(arpflush)
+ 6d4:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 6d9:	cd 40                	int    $0x40
+ 6db:	c3                   	ret
+
+000006dc <nicgetip>:
+SYSCALL(nicgetip)
+ 6dc:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 6e1:	cd 40                	int    $0x40
+ 6e3:	c3                   	ret
+
+000006e4 <nicsetip>:
+SYSCALL(nicsetip)
+ 6e4:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 6e9:	cd 40                	int    $0x40
+ 6eb:	c3                   	ret
+
+000006ec <arpresolve>:
+SYSCALL(arpresolve)
+ 6ec:	b8 20 00 00 00       	mov    $0x20,%eax
+ 6f1:	cd 40                	int    $0x40
+ 6f3:	c3                   	ret
+
+000006f4 <arpresolvev>:
+SYSCALL(arpresolvev)
+ 6f4:	b8 21 00 00 00       	mov    $0x21,%eax
+ 6f9:	cd 40                	int    $0x40
+ 6fb:	c3                   	ret
+
+000006fc <arpsend>:
+SYSCALL(arpsend)
+ 6fc:	b8 22 00 00 00       	mov    $0x22,%eax
+ 701:	cd 40                	int    $0x40
+ 703:	c3                   	ret
+ 704:	66 90                	xchg   %ax,%ax
+ 706:	66 90                	xchg   %ax,%ax
+ 708:	66 90                	xchg   %ax,%ax
+ 70a:	66 90                	xchg   %ax,%ax
+ 70c:	66 90                	xchg   %ax,%ax
+ 70e:	66 90                	xchg   %ax,%ax
+
+00000710 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 710:	55                   	push   %ebp
+ 711:	89 e5                	mov    %esp,%ebp
+ 713:	57                   	push   %edi
+ 714:	56                   	push   %esi
+ 715:	53                   	push   %ebx
+ 716:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 718:	89 d1                	mov    %edx,%ecx
+{
+ 71a:	83 ec 3c             	sub    $0x3c,%esp
+ 71d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 720:	85 d2                	test   %edx,%edx
+ 722:	0f 89 80 00 00 00    	jns    7a8 <printint+0x98>
+ 728:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 72c:	74 7a                	je     7a8 <printint+0x98>
+    x = -xx;
+ 72e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 730:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 735:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 738:	31 f6                	xor    %esi,%esi
+ 73a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 740:	89 c8                	mov    %ecx,%eax
+ 742:	31 d2                	xor    %edx,%edx
+ 744:	89 f7                	mov    %esi,%edi
+ 746:	f7 f3                	div    %ebx
+ 748:	8d 76 01             	lea    0x1(%esi),%esi
+ 74b:	0f b6 92 18 0c 00 00 	movzbl 0xc18(%edx),%edx
+ 752:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 756:	89 ca                	mov    %ecx,%edx
+ 758:	89 c1                	mov    %eax,%ecx
+ 75a:	39 da                	cmp    %ebx,%edx
+ 75c:	73 e2                	jae    740 <printint+0x30>
+  if(neg)
+ 75e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 761:	85 c0                	test   %eax,%eax
+ 763:	74 07                	je     76c <printint+0x5c>
+    buf[i++] = '-';
+ 765:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 76a:	89 f7                	mov    %esi,%edi
+ 76c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 76f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 772:	01 df                	add    %ebx,%edi
+ 774:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 778:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 77b:	83 ec 04             	sub    $0x4,%esp
+ 77e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 781:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 784:	6a 01                	push   $0x1
+ 786:	50                   	push   %eax
+ 787:	56                   	push   %esi
+ 788:	e8 8f fe ff ff       	call   61c <write>
+  while(--i >= 0)
+ 78d:	89 f8                	mov    %edi,%eax
+ 78f:	83 c4 10             	add    $0x10,%esp
+ 792:	83 ef 01             	sub    $0x1,%edi
+ 795:	39 d8                	cmp    %ebx,%eax
+ 797:	75 df                	jne    778 <printint+0x68>
+}
+ 799:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 79c:	5b                   	pop    %ebx
+ 79d:	5e                   	pop    %esi
+ 79e:	5f                   	pop    %edi
+ 79f:	5d                   	pop    %ebp
+ 7a0:	c3                   	ret
+ 7a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 7a8:	31 c0                	xor    %eax,%eax
+ 7aa:	eb 89                	jmp    735 <printint+0x25>
+ 7ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000007b0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 7b0:	55                   	push   %ebp
+ 7b1:	89 e5                	mov    %esp,%ebp
+ 7b3:	57                   	push   %edi
+ 7b4:	56                   	push   %esi
+ 7b5:	53                   	push   %ebx
+ 7b6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 7b9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 7bc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 7bf:	0f b6 1e             	movzbl (%esi),%ebx
+ 7c2:	83 c6 01             	add    $0x1,%esi
+ 7c5:	84 db                	test   %bl,%bl
+ 7c7:	74 67                	je     830 <printf+0x80>
+ 7c9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 7cc:	31 d2                	xor    %edx,%edx
+ 7ce:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 7d1:	eb 34                	jmp    807 <printf+0x57>
+ 7d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 7d7:	90                   	nop
+ 7d8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 7db:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 7e0:	83 f8 25             	cmp    $0x25,%eax
+ 7e3:	74 18                	je     7fd <printf+0x4d>
+  write(fd, &c, 1);
+ 7e5:	83 ec 04             	sub    $0x4,%esp
+ 7e8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 7eb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 7ee:	6a 01                	push   $0x1
+ 7f0:	50                   	push   %eax
+ 7f1:	57                   	push   %edi
+ 7f2:	e8 25 fe ff ff       	call   61c <write>
+ 7f7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 7fa:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 7fd:	0f b6 1e             	movzbl (%esi),%ebx
+ 800:	83 c6 01             	add    $0x1,%esi
+ 803:	84 db                	test   %bl,%bl
+ 805:	74 29                	je     830 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 807:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 80a:	85 d2                	test   %edx,%edx
+ 80c:	74 ca                	je     7d8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 80e:	83 fa 25             	cmp    $0x25,%edx
+ 811:	75 ea                	jne    7fd <printf+0x4d>
+      if(c == 'd'){
+ 813:	83 f8 25             	cmp    $0x25,%eax
+ 816:	0f 84 24 01 00 00    	je     940 <printf+0x190>
+ 81c:	83 e8 63             	sub    $0x63,%eax
+ 81f:	83 f8 15             	cmp    $0x15,%eax
+ 822:	77 1c                	ja     840 <printf+0x90>
+ 824:	ff 24 85 c0 0b 00 00 	jmp    *0xbc0(,%eax,4)
+ 82b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 82f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 830:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 833:	5b                   	pop    %ebx
+ 834:	5e                   	pop    %esi
+ 835:	5f                   	pop    %edi
+ 836:	5d                   	pop    %ebp
+ 837:	c3                   	ret
+ 838:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 83f:	90                   	nop
+  write(fd, &c, 1);
+ 840:	83 ec 04             	sub    $0x4,%esp
+ 843:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 846:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 84a:	6a 01                	push   $0x1
+ 84c:	52                   	push   %edx
+ 84d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 850:	57                   	push   %edi
+ 851:	e8 c6 fd ff ff       	call   61c <write>
+ 856:	83 c4 0c             	add    $0xc,%esp
+ 859:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 85c:	6a 01                	push   $0x1
+ 85e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 861:	52                   	push   %edx
+ 862:	57                   	push   %edi
+ 863:	e8 b4 fd ff ff       	call   61c <write>
+        putc(fd, c);
+ 868:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 86b:	31 d2                	xor    %edx,%edx
+ 86d:	eb 8e                	jmp    7fd <printf+0x4d>
+ 86f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 870:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 873:	83 ec 0c             	sub    $0xc,%esp
+ 876:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 87b:	8b 13                	mov    (%ebx),%edx
+ 87d:	6a 00                	push   $0x0
+ 87f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 881:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 884:	e8 87 fe ff ff       	call   710 <printint>
+        ap++;
+ 889:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 88c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 88f:	31 d2                	xor    %edx,%edx
+ 891:	e9 67 ff ff ff       	jmp    7fd <printf+0x4d>
+ 896:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 89d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 8a0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 8a3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 8a5:	83 c0 04             	add    $0x4,%eax
+ 8a8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 8ab:	85 db                	test   %ebx,%ebx
+ 8ad:	0f 84 9d 00 00 00    	je     950 <printf+0x1a0>
+        while(*s != 0){
+ 8b3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 8b6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 8b8:	84 c0                	test   %al,%al
+ 8ba:	0f 84 3d ff ff ff    	je     7fd <printf+0x4d>
+ 8c0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 8c3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 8c6:	89 de                	mov    %ebx,%esi
+ 8c8:	89 d3                	mov    %edx,%ebx
+ 8ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 8d0:	83 ec 04             	sub    $0x4,%esp
+ 8d3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 8d6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 8d9:	6a 01                	push   $0x1
+ 8db:	53                   	push   %ebx
+ 8dc:	57                   	push   %edi
+ 8dd:	e8 3a fd ff ff       	call   61c <write>
+        while(*s != 0){
+ 8e2:	0f b6 06             	movzbl (%esi),%eax
+ 8e5:	83 c4 10             	add    $0x10,%esp
+ 8e8:	84 c0                	test   %al,%al
+ 8ea:	75 e4                	jne    8d0 <printf+0x120>
+      state = 0;
+ 8ec:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 8ef:	31 d2                	xor    %edx,%edx
+ 8f1:	e9 07 ff ff ff       	jmp    7fd <printf+0x4d>
+ 8f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8fd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 900:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 903:	83 ec 0c             	sub    $0xc,%esp
+ 906:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 90b:	8b 13                	mov    (%ebx),%edx
+ 90d:	6a 01                	push   $0x1
+ 90f:	e9 6b ff ff ff       	jmp    87f <printf+0xcf>
+ 914:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 918:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 91b:	83 ec 04             	sub    $0x4,%esp
+ 91e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 921:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 923:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 926:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 929:	6a 01                	push   $0x1
+ 92b:	52                   	push   %edx
+ 92c:	57                   	push   %edi
+ 92d:	e8 ea fc ff ff       	call   61c <write>
+        ap++;
+ 932:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 935:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 938:	31 d2                	xor    %edx,%edx
+ 93a:	e9 be fe ff ff       	jmp    7fd <printf+0x4d>
+ 93f:	90                   	nop
+  write(fd, &c, 1);
+ 940:	83 ec 04             	sub    $0x4,%esp
+ 943:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 946:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 949:	6a 01                	push   $0x1
+ 94b:	e9 11 ff ff ff       	jmp    861 <printf+0xb1>
+ 950:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 955:	bb b6 0b 00 00       	mov    $0xbb6,%ebx
+ 95a:	e9 61 ff ff ff       	jmp    8c0 <printf+0x110>
+ 95f:	90                   	nop
+
+00000960 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 960:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 961:	a1 a0 0f 00 00       	mov    0xfa0,%eax
+{
+ 966:	89 e5                	mov    %esp,%ebp
+ 968:	57                   	push   %edi
+ 969:	56                   	push   %esi
+ 96a:	53                   	push   %ebx
+ 96b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 96e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 971:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 978:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 97a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 97c:	39 ca                	cmp    %ecx,%edx
+ 97e:	73 30                	jae    9b0 <free+0x50>
+ 980:	39 c1                	cmp    %eax,%ecx
+ 982:	72 04                	jb     988 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 984:	39 c2                	cmp    %eax,%edx
+ 986:	72 f0                	jb     978 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 988:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 98b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 98e:	39 f8                	cmp    %edi,%eax
+ 990:	74 2e                	je     9c0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 992:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 995:	8b 42 04             	mov    0x4(%edx),%eax
+ 998:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 99b:	39 f1                	cmp    %esi,%ecx
+ 99d:	74 38                	je     9d7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 99f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 9a1:	5b                   	pop    %ebx
+  freep = p;
+ 9a2:	89 15 a0 0f 00 00    	mov    %edx,0xfa0
+}
+ 9a8:	5e                   	pop    %esi
+ 9a9:	5f                   	pop    %edi
+ 9aa:	5d                   	pop    %ebp
+ 9ab:	c3                   	ret
+ 9ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 9b0:	39 c1                	cmp    %eax,%ecx
+ 9b2:	72 d0                	jb     984 <free+0x24>
+ 9b4:	eb c2                	jmp    978 <free+0x18>
+ 9b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9bd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 9c0:	03 70 04             	add    0x4(%eax),%esi
+ 9c3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 9c6:	8b 02                	mov    (%edx),%eax
+ 9c8:	8b 00                	mov    (%eax),%eax
+ 9ca:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 9cd:	8b 42 04             	mov    0x4(%edx),%eax
+ 9d0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 9d3:	39 f1                	cmp    %esi,%ecx
+ 9d5:	75 c8                	jne    99f <free+0x3f>
+    p->s.size += bp->s.size;
+ 9d7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 9da:	89 15 a0 0f 00 00    	mov    %edx,0xfa0
+    p->s.size += bp->s.size;
+ 9e0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 9e3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 9e6:	89 0a                	mov    %ecx,(%edx)
+}
+ 9e8:	5b                   	pop    %ebx
+ 9e9:	5e                   	pop    %esi
+ 9ea:	5f                   	pop    %edi
+ 9eb:	5d                   	pop    %ebp
+ 9ec:	c3                   	ret
+ 9ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000009f0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 9f0:	55                   	push   %ebp
+ 9f1:	89 e5                	mov    %esp,%ebp
+ 9f3:	57                   	push   %edi
+ 9f4:	56                   	push   %esi
+ 9f5:	53                   	push   %ebx
+ 9f6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 9f9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 9fc:	8b 15 a0 0f 00 00    	mov    0xfa0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ a02:	8d 78 07             	lea    0x7(%eax),%edi
+ a05:	c1 ef 03             	shr    $0x3,%edi
+ a08:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ a0b:	85 d2                	test   %edx,%edx
+ a0d:	0f 84 8d 00 00 00    	je     aa0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a13:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ a15:	8b 48 04             	mov    0x4(%eax),%ecx
+ a18:	39 f9                	cmp    %edi,%ecx
+ a1a:	73 64                	jae    a80 <malloc+0x90>
+  if(nu < 4096)
+ a1c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ a21:	39 df                	cmp    %ebx,%edi
+ a23:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ a26:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ a2d:	eb 0a                	jmp    a39 <malloc+0x49>
+ a2f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a30:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ a32:	8b 48 04             	mov    0x4(%eax),%ecx
+ a35:	39 f9                	cmp    %edi,%ecx
+ a37:	73 47                	jae    a80 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ a39:	89 c2                	mov    %eax,%edx
+ a3b:	39 05 a0 0f 00 00    	cmp    %eax,0xfa0
+ a41:	75 ed                	jne    a30 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ a43:	83 ec 0c             	sub    $0xc,%esp
+ a46:	56                   	push   %esi
+ a47:	e8 38 fc ff ff       	call   684 <sbrk>
+  if(p == (char*)-1)
+ a4c:	83 c4 10             	add    $0x10,%esp
+ a4f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ a52:	74 1c                	je     a70 <malloc+0x80>
+  hp->s.size = nu;
+ a54:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ a57:	83 ec 0c             	sub    $0xc,%esp
+ a5a:	83 c0 08             	add    $0x8,%eax
+ a5d:	50                   	push   %eax
+ a5e:	e8 fd fe ff ff       	call   960 <free>
+  return freep;
+ a63:	8b 15 a0 0f 00 00    	mov    0xfa0,%edx
+      if((p = morecore(nunits)) == 0)
+ a69:	83 c4 10             	add    $0x10,%esp
+ a6c:	85 d2                	test   %edx,%edx
+ a6e:	75 c0                	jne    a30 <malloc+0x40>
+        return 0;
+  }
+}
+ a70:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ a73:	31 c0                	xor    %eax,%eax
+}
+ a75:	5b                   	pop    %ebx
+ a76:	5e                   	pop    %esi
+ a77:	5f                   	pop    %edi
+ a78:	5d                   	pop    %ebp
+ a79:	c3                   	ret
+ a7a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ a80:	39 cf                	cmp    %ecx,%edi
+ a82:	74 4c                	je     ad0 <malloc+0xe0>
+        p->s.size -= nunits;
+ a84:	29 f9                	sub    %edi,%ecx
+ a86:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ a89:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ a8c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ a8f:	89 15 a0 0f 00 00    	mov    %edx,0xfa0
+}
+ a95:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ a98:	83 c0 08             	add    $0x8,%eax
+}
+ a9b:	5b                   	pop    %ebx
+ a9c:	5e                   	pop    %esi
+ a9d:	5f                   	pop    %edi
+ a9e:	5d                   	pop    %ebp
+ a9f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ aa0:	c7 05 a0 0f 00 00 a4 	movl   $0xfa4,0xfa0
+ aa7:	0f 00 00 
+    base.s.size = 0;
+ aaa:	b8 a4 0f 00 00       	mov    $0xfa4,%eax
+    base.s.ptr = freep = prevp = &base;
+ aaf:	c7 05 a4 0f 00 00 a4 	movl   $0xfa4,0xfa4
+ ab6:	0f 00 00 
+    base.s.size = 0;
+ ab9:	c7 05 a8 0f 00 00 00 	movl   $0x0,0xfa8
+ ac0:	00 00 00 
+    if(p->s.size >= nunits){
+ ac3:	e9 54 ff ff ff       	jmp    a1c <malloc+0x2c>
+ ac8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ acf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ ad0:	8b 08                	mov    (%eax),%ecx
+ ad2:	89 0a                	mov    %ecx,(%edx)
+ ad4:	eb b9                	jmp    a8f <malloc+0x9f>
@@ -1,11 +1,89 @@
+/**
+ *ARP tests
+ *usage: arptest [interface a.b.c.d]
+ *with no arguments, sends an ARP request for 192.168.2.1 on eth0.
+ *Otherwise runs the queue arpsend keeps while a.b.c.d resolves through
+ *overflow, then flush (or drop, if nobody answers), then a direct send.
+ *Flushes the ARP cache first.
+ */
 #include "types.h"
 #include "user.h"
+#include "arpctl.h"
+#include "nicctl.h"
+
+#define ETHR_HDR_LEN  14
+#define FRAME_LEN     64
+
+static uchar frame[FRAME_LEN];
+static int failed;
+
+static uint drops(char *interface) {
+  uint n = 0;
+
+  nicget(interface, NICCTL_ARPQ_DROPS, &n);
+  return n;
+}
+
+static void check(char *what, int ok) {
+  printf(1, "arptest: %s %s\n", what, ok ? "ok" : "FAILED");
+  if(!ok)
+    failed = 1;
+}
+
+static void queuetest(char *interface, uint ip) {
+  uint8_t mac[6];
+  uint before;
+  int r, sent = 0;
+
+  arpflush();
+  //raw ether type, so the frames are harmless wherever they end up
+  frame[12] = 0x88;
+  frame[13] = 0xB5;
+
+  before = drops(interface);
+  for(int i = 0; i < ARP_QUEUE_MAX + 2; i++)
+    if(arpsend(interface, ip, frame, FRAME_LEN) == 0)
+      sent++;
+  check("queue", sent == ARP_QUEUE_MAX + 2);
+  check("overflow", drops(interface) - before == 2);
+
+  before = drops(interface);
+  r = arpresolve(interface, ip, mac, 0);
+  if(r == 0)
+    check("flush", drops(interface) == before);
+  else if(r == ARP_EUNREACH)
+    check("drop on failure", drops(interface) - before == ARP_QUEUE_MAX);
+  else
+    check("resolve", 0);
+
+  before = drops(interface);
+  if(r == 0)
+    check("direct send", arpsend(interface, ip, frame, FRAME_LEN) == 0 && drops(interface) == before);
+  else
+    check("send to failed", arpsend(interface, ip, frame, FRAME_LEN) < 0 && drops(interface) - before == 1);
+}
+
+int main(int argc, char *argv[]) {
+  uint addr;
+
+  if(argc == 3) {
+    if(parseip(argv[2], &addr) < 0) {
+      printf(2, "arptest: bad address %s\n", argv[2]);
+      exit();
+    }
+    queuetest(argv[1], addr);
+    printf(1, "arptest: %s\n", failed ? "FAILED" : "passed");
+    exit();
+  }
+  if(argc != 1) {
+    printf(2, "usage: arptest [interface a.b.c.d]\n");
+    exit();
+  }
 
-int main(void) {
   int MAC_SIZE = 18;
   char* ip = "192.168.2.1";
   char* mac = malloc(MAC_SIZE);
-  if(arp("mynet0", ip, mac, MAC_SIZE) < 0) {
+  if(arp("eth0", ip, mac, MAC_SIZE) < 0) {
     printf(1, "ARP for IP:%s Failed.\n", ip);
   }
   exit();
@@ -2,6 +2,8 @@ struct buf;
 struct context;
 struct file;
 struct inode;
+struct nic_device;
+struct arpent;
 struct pipe;
 struct proc;
 struct rtcdate;
@@ -65,7 +67,9 @@ void            ioapicinit(void);
 
 // kalloc.c
 char*           kalloc(void);
+char*           kallocn(int);
 void            kfree(char*);
+void            kfreen(char*, int);
 void            kinit1(void*, void*);
 void            kinit2(void*, void*);
 
@@ -108,6 +112,7 @@ void            exit(void);
 int             fork(void);
 int             growproc(int);
 int             kill(int);
+int             kthread(char*, void (*)(void*), void*);
 struct cpu*     mycpu(void);
 struct proc*    myproc();
 void            pinit(void);
@@ -165,6 +170,12 @@ extern uint     ticks;
 void            tvinit(void);
 extern struct spinlock tickslock;
 
+// tsc.c
+void            tscinit(void);
+uint64_t        nsecs(void);
+void            ndelay(uint);
+void            udelay(uint);
+
 // uart.c
 void            uartinit(void);
 void            uartintr(void);
@@ -188,6 +199,20 @@ void            clearpteu(pde_t *pgdir, char *uva);
 
 //arp.c
 int send_arpRequest(char* interface, char* ipAddr, char* arpResp);
+void arp_input(struct nic_device *nd, uint8_t *pkt, uint16_t length);
+void arp_init(void);
+void arp_timer(void);
+void arp_tick(uint now);
+void arp_announce(struct nic_device *nd);
+int arp_lookup(struct nic_device *nd, uint32_t ip, uint8_t *mac, int flags);
+int arp_output(struct nic_device *nd, uint32_t ip, uint8_t *frame, uint16_t length);
+int arp_cache_lookup(struct nic_device *nd, uint32_t ip, uint8_t *mac);
+int arp_cache_dump(struct arpent *ents, int n);
+void arp_cache_flush(void);
+
+//nic.c
+int nic_intr(int irq);
+void nic_tick(uint ticks);
 
 // number of elements in fixed-size array
 #define NELEM(x) (sizeof(x)/sizeof((x)[0]))
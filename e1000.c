@@ -14,9 +14,45 @@
 #include "arp_frame.h"
 #include "nic.h"
 #include "memlayout.h"
+#include "mmu.h"
+#include "spinlock.h"
+#include "pktbuf.h"
+#include "nicstat.h"
 
-#define E1000_RBD_SLOTS			128
-#define E1000_TBD_SLOTS			128
+//Ring sizes picked at init. Multiples of 8 (RDLEN/TDLEN must be
+//128-byte aligned) up to E1000_MAX_SLOTS. Override with -D at build time.
+#ifndef E1000_RBD_SLOTS
+#define E1000_RBD_SLOTS			512
+#endif
+#ifndef E1000_TBD_SLOTS
+#define E1000_TBD_SLOTS			256
+#endif
+#define E1000_MAX_SLOTS     4096
+
+//Per frame console tracing (E1000_TRACE_TX) is off unless asked for with
+//-D; E1000_DEBUG, on by default, only covers one-off events.
+
+//Receive buffers per ring slot. The extra ones cover frames that upper
+//layers still hold while their slots have already been refilled.
+#define E1000_RX_POOL_FACTOR  2
+//MTU at init. Receive and transmit buffers are sized for it, so it is
+//also the largest MTU that can be set later. Override with -D at build
+//time, up to NIC_MAX_MTU.
+#ifndef E1000_MTU
+#define E1000_MTU     NIC_DEF_MTU
+#endif
+//Largest frame on the wire for an MTU
+#define E1000_FRAME_LEN(mtu)  ((mtu) + ETHR_HDR_LEN + ETHR_FCS_LEN)
+#if E1000_MTU < NIC_MIN_MTU || E1000_MTU > NIC_MAX_MTU
+#error "E1000_MTU out of range"
+#endif
+//Frames shorter than copybreak are copied into a small buffer and the
+//big one stays posted. The small buffer size caps the tunable.
+#define E1000_RX_SMALL_BUFSIZE  256
+#define E1000_RX_COPYBREAK      256
+
+//TSO payload is split over data descriptors of at most this many bytes
+#define E1000_TSO_CHUNK     PGSIZE
 
 //Bit 31:20 are not writable. Always read 0b.
 #define E1000_IOADDR_OFFSET 0x00000000
@@ -36,12 +72,48 @@
 
 #define E1000_CNTRL_RST_BIT(cntrl) \
         (cntrl & E1000_CNTRL_RST_MASK)
+//Give up on a reset that hasn't finished after this many ns
+#define E1000_RESET_TIMEOUT       10000000
+
+/**
+ * Ethernet Device Status register
+ */
+#define E1000_STATUS              0x00008
+#define E1000_STATUS_FD           0x00000001    //full duplex
+#define E1000_STATUS_LU           0x00000002    //link up
+#define E1000_STATUS_SPEED_MASK   0x000000C0
+#define E1000_STATUS_SPEED_SHIFT  6             //0: 10Mb/s, 1: 100Mb/s, 2 or 3: 1000Mb/s
+
+/**
+ * Ethernet Device MDI Control register, to reach the PHY registers
+ */
+#define E1000_MDIC                0x00020
+#define E1000_MDIC_REG_SHIFT      16
+#define E1000_MDIC_PHY_SHIFT      21
+#define E1000_MDIC_OP_WRITE       0x04000000
+#define E1000_MDIC_OP_READ        0x08000000
+#define E1000_MDIC_READY          0x10000000
+#define E1000_MDIC_ERROR          0x40000000
+#define E1000_PHY_ADDR            1     //the 8254x internal PHY
+#define E1000_MDIC_TIMEOUT        100000  //ns
+
+//PHY Control register
+#define E1000_PHY_CTRL            0
+#define E1000_PHY_CTRL_LOOPBACK   0x4000
 
 /**
  * Ethernet Device registers
  */
 #define E1000_RCV_RAL0      0x05400
 #define E1000_RCV_RAH0      0x05404
+//Receive address n, n = 0..15. Entry 0 holds the station address
+#define E1000_RCV_RAL(n)    (E1000_RCV_RAL0 + 8*(n))
+#define E1000_RCV_RAH(n)    (E1000_RCV_RAH0 + 8*(n))
+#define E1000_RAH_AV        0x80000000    //address valid
+#define E1000_RAR_ENTRIES   16
+//Multicast Table Array, 4096 hash bits in 128 registers
+#define E1000_MTA           0x05200
+#define E1000_MTA_REGS      128
 #define E1000_TDBAL         0x03800
 #define E1000_TDBAH         0x03804
 #define E1000_TDLEN         0x03808
@@ -53,6 +125,22 @@
 #define E1000_RDH           0x02810
 #define E1000_RDT           0x02818
 
+/**
+ * Ethernet Device Interrupt moderation registers
+ */
+#define E1000_ITR           0x000c4   //Interrupt Throttling, 256ns units
+#define E1000_RDTR          0x02820   //Receive Delay Timer, 1.024us units
+#define E1000_RADV          0x0282c   //Receive Absolute Delay, 1.024us units
+#define E1000_TIDV          0x03820   //Transmit Interrupt Delay, 1.024us units
+#define E1000_TADV          0x0382c   //Transmit Absolute Delay, 1.024us units
+
+//Defaults. ITR=488 caps us around 8000 interrupts/s
+#define E1000_ITR_DEFAULT   488
+#define E1000_RDTR_DEFAULT  0
+#define E1000_RADV_DEFAULT  8
+#define E1000_TIDV_DEFAULT  8
+#define E1000_TADV_DEFAULT  32
+
 /**
  * Ethernet Device Transmission Control register
  */
@@ -91,27 +179,130 @@
 * Ethernet Device Interrupt Mast Set registers
 */
 #define E1000_IMS                 0x000d0
+#define E1000_IMS_TXDW            0x00000001
 #define E1000_IMS_TXQE            0x00000002
+#define E1000_IMS_LSC             0x00000004
 #define E1000_IMS_RXSEQ           0x00000008
+#define E1000_IMS_RXDMT0          0x00000010
 #define E1000_IMS_RXO             0x00000040
 #define E1000_IMS_RXT0            0x00000080
 
+#define E1000_IMS_RX_MASK \
+        (E1000_IMS_RXSEQ | E1000_IMS_RXDMT0 | E1000_IMS_RXO | E1000_IMS_RXT0)
+
+/**
+ * Ethernet Device Interrupt Mask Clear register
+ */
+#define E1000_IMC                 0x000d8
+
+/**
+ * Ethernet Device Interrupt Cause Set register, raises the causes written
+ */
+#define E1000_ICS                 0x000c8
+
+/**
+ * Ethernet Device Interrupt Cause Read register. Reading it clears it.
+ * Bit positions are the same as in IMS.
+ */
+#define E1000_ICR                 0x000c0
+#define E1000_ICR_TXDW            0x00000001
+#define E1000_ICR_TXQE            0x00000002
+#define E1000_ICR_LSC             0x00000004    //link status change
+#define E1000_ICR_RXSEQ           0x00000008
+#define E1000_ICR_RXDMT0          0x00000010
+#define E1000_ICR_RXO             0x00000040
+#define E1000_ICR_RXT0            0x00000080
+
+#define E1000_ICR_RX_MASK \
+        (E1000_ICR_RXSEQ | E1000_ICR_RXDMT0 | E1000_ICR_RXO | E1000_ICR_RXT0)
+#define E1000_ICR_TX_MASK \
+        (E1000_ICR_TXDW | E1000_ICR_TXQE)
+
 /**
  * Ethernet Device Receive Control register
  */
 #define E1000_RCTL                0x00100
 
 #define E1000_RCTL_EN             0x00000002
+#define E1000_RCTL_UPE            0x00000008    //unicast promiscuous
+#define E1000_RCTL_MPE            0x00000010    //multicast promiscuous
+#define E1000_RCTL_LBM_MAC        0x00000040    //MAC loopback
+#define E1000_RCTL_LBM_MASK       0x000000C0
+#define E1000_RCTL_LPE            0x00000020    //long packets, over 1522 bytes
 #define E1000_RCTL_BAM            0x00008000
-#define E1000_RCTL_BSIZE          0x00000000
+#define E1000_RCTL_BSIZE_2048     0x00000000
+#define E1000_RCTL_BSIZE_16384    0x00010000    //with BSEX
+#define E1000_RCTL_BSIZE_8192     0x00020000    //with BSEX
+#define E1000_RCTL_BSIZE_4096     0x00030000    //with BSEX
+#define E1000_RCTL_BSEX           0x02000000    //BSIZE is in 16x units
 #define E1000_RCTL_SECRC          0x04000000
 
+/**
+ * Ethernet Device statistics registers. All clear on read; the 64-bit
+ * octet counters latch their high half when the low half is read.
+ */
+#define E1000_CRCERRS             0x04000
+#define E1000_ALGNERRC            0x04004
+#define E1000_SYMERRS             0x04008
+#define E1000_RXERRC              0x0400C
+#define E1000_MPC                 0x04010
+#define E1000_SCC                 0x04014
+#define E1000_ECOL                0x04018
+#define E1000_MCC                 0x0401C
+#define E1000_LATECOL             0x04020
+#define E1000_COLC                0x04028
+#define E1000_DC                  0x04030
+#define E1000_TNCRS               0x04034
+#define E1000_RLEC                0x04040
+#define E1000_XONRXC              0x04048
+#define E1000_XONTXC              0x0404C
+#define E1000_XOFFRXC             0x04050
+#define E1000_XOFFTXC             0x04054
+#define E1000_GPRC                0x04074
+#define E1000_BPRC                0x04078
+#define E1000_MPRC                0x0407C
+#define E1000_GPTC                0x04080
+#define E1000_GORCL               0x04088
+#define E1000_GOTCL               0x04090
+#define E1000_RNBC                0x040A0
+#define E1000_RUC                 0x040A4
+#define E1000_RFC                 0x040A8
+#define E1000_ROC                 0x040AC
+#define E1000_RJC                 0x040B0
+#define E1000_TPR                 0x040D0
+#define E1000_TPT                 0x040D4
+#define E1000_MPTC                0x040F0
+#define E1000_BPTC                0x040F4
+#define E1000_TSCTC               0x040F8
+#define E1000_TSCTFC              0x040FC
+
+/**
+ * Ethernet Device Receive Checksum Control register
+ */
+#define E1000_RXCSUM              0x05000
+#define E1000_RXCSUM_IPOFLD       0x00000100
+#define E1000_RXCSUM_TUOFLD       0x00000200
+
 /**
  * Ethernet Device Transmit Descriptor Command Field
  */
 #define E1000_TDESC_CMD_RS      0x08
 #define E1000_TDESC_CMD_EOP     0x01
 #define E1000_TDESC_CMD_IFCS    0x02
+#define E1000_TDESC_CMD_TSE     0x04
+#define E1000_TDESC_CMD_DEXT    0x20
+#define E1000_TDESC_CMD_IDE     0x80   //delay the TXDW interrupt by TIDV/TADV
+
+/**
+ * Extended (context and data) Transmit Descriptor fields
+ */
+#define E1000_TDESC_DTYP_CTX    0x0
+#define E1000_TDESC_DTYP_DATA   0x1
+#define E1000_TDESC_TUCMD_TCP   0x01   //TCP, else UDP
+#define E1000_TDESC_TUCMD_IP    0x02   //IPv4, else IPv6
+#define E1000_TDESC_TUCMD_TSE   0x04   //TCP segmentation
+#define E1000_TDESC_POPTS_IXSM  0x01   //insert IP checksum
+#define E1000_TDESC_POPTS_TXSM  0x02   //insert TCP/UDP checksum
 
 /**
  * Ethernet Device Transmit Descriptor Status Field
@@ -120,6 +311,27 @@
 #define E1000_TDESC_STATUS_DONE(status) \
         (status & E1000_TDESC_STATUS_DONE_MASK)
 
+/**
+ * Ethernet Device Receive Descriptor Status Field
+ */
+#define E1000_RDESC_STATUS_DONE_MASK   0x01
+#define E1000_RDESC_STATUS_EOP_MASK    0x02
+#define E1000_RDESC_STATUS_IXSM_MASK   0x04   //checksum indication not valid
+#define E1000_RDESC_STATUS_TCPCS_MASK  0x20   //TCP/UDP checksum was computed
+#define E1000_RDESC_STATUS_IPCS_MASK   0x40   //IP checksum was computed
+#define E1000_RDESC_STATUS_DONE(status) \
+        (status & E1000_RDESC_STATUS_DONE_MASK)
+#define E1000_RDESC_STATUS_EOP(status) \
+        (status & E1000_RDESC_STATUS_EOP_MASK)
+
+/**
+ * Ethernet Device Receive Descriptor Errors Field
+ */
+#define E1000_RDESC_ERR_TCPE    0x20
+#define E1000_RDESC_ERR_IPE     0x40
+//everything but checksum errors means the frame itself is broken
+#define E1000_RDESC_ERR_FRAME   0x97
+
 /**
   * Ethernet Device EEPROM registers
   */
@@ -161,6 +373,36 @@ struct e1000_tbd {
 	uint16_t special;
 };
 
+//Transmit Context Descriptor. Sets up checksum offload for the data
+//descriptors that follow it until the next context descriptor.
+__attribute__ ((packed))
+struct e1000_ctx_tbd {
+  uint8_t ipcss;    //start of IP header
+  uint8_t ipcso;    //where to put the IP checksum
+  uint16_t ipcse;   //last byte of IP header
+  uint8_t tucss;    //start of TCP/UDP header
+  uint8_t tucso;    //where to put the TCP/UDP checksum
+  uint16_t tucse;   //last byte covered, 0 means end of frame
+  uint32_t paylen:20;
+  uint32_t dtyp:4;
+  uint32_t tucmd:8;
+  uint8_t status;
+  uint8_t hdrlen;
+  uint16_t mss;
+};
+
+//Transmit Extended Data Descriptor
+__attribute__ ((packed))
+struct e1000_data_tbd {
+  uint64_t addr;
+  uint32_t length:20;
+  uint32_t dtyp:4;
+  uint32_t dcmd:8;
+  uint8_t status;
+  uint8_t popts;
+  uint16_t special;
+};
+
 //Receive Buffer Descriptor
 // The Receive Descriptor Queue must be aligned on 16-byte boundary
 __attribute__ ((packed))
@@ -174,78 +416,601 @@ struct e1000_rbd {
 	uint16_t	special;
 };
 
-struct packet_buf {
-    uint8_t buf[2046];
+//Software state kept alongside each transmit descriptor
+struct e1000_tx_slot {
+  uint8_t *buf;                   //tx_bufsize bytes for the copy path
+  //zero-copy slots point at caller memory, given back through this on completion
+  void (*release)(void *arg);
+  void *release_arg;
+};
+
+//Addresses a receive filter lets in. Adds past E1000_ADDR_MAX are only
+//counted in overflow and leave the filter promiscuous until removed.
+#define E1000_ADDR_MAX  32
+struct e1000_addr_list {
+  uint8_t addr[E1000_ADDR_MAX][6];
+  int n;
+  int overflow;
 };
 
 struct e1000 {
-	struct e1000_tbd *tbd[E1000_TBD_SLOTS];
-	struct e1000_rbd *rbd[E1000_RBD_SLOTS];
+  //descriptor rings, physically contiguous and indexed directly
+	struct e1000_tbd *tbd;
+	struct e1000_rbd *rbd;
+  int tbd_slots;
+  int rbd_slots;
+
+  struct e1000_tx_slot *tx_slot;  //per tbd bookkeeping, tbd_slots long
+  struct pktbuf **rx_buf;         //buffer posted to each rbd, rbd_slots long
+  struct pktpool rx_pool;         //refills rx_buf as frames are passed up
+  uint32_t rx_nobuf;              //frames dropped because rx_pool ran dry
+  struct pktpool rx_small;        //copybreak buffers
+  uint32_t rx_copybreak;          //frames shorter than this are copied
+  uint32_t rx_copy, rx_flip;      //frames passed up by copy / by buffer swap
+  uint32_t tx_ctx;   //checksum context the hardware holds, 0 if none
+  struct pktpool tx_pool;         //copy path buffers behind tx_slot
 
-  struct packet_buf *tx_buf[E1000_TBD_SLOTS];  //packet buffer space for tbd
-  struct packet_buf *rx_buf[E1000_RBD_SLOTS];  //packet buffer space for rbd
+  //frame size limits
+  uint32_t mtu;
+  uint32_t rx_bufsize;            //receive buffer size programmed in RCTL
+  uint32_t tx_bufsize;            //copy path buffer size
+  uint32_t rctl;                  //RCTL as last written
+  uint32_t loopback;              //NICCTL_LOOPBACK setting
+  int link_up;                    //STATUS.LU as last seen, transmit fails while 0
+  int rx_discard;                 //dropping the rest of a frame that overran a buffer
 
-  int tbd_head;
-	int tbd_tail;
+  //interrupt moderation, in register units
+  uint32_t itr;
+  uint32_t rdtr;
+  uint32_t radv;
+  uint32_t tidv;
+  uint32_t tadv;
+
+  int tbd_head;   //oldest descriptor not yet reclaimed from the hardware
+	int tbd_tail;   //next free descriptor, mirrors TDT
 	char tbd_idle;
+  struct spinlock tx_lock;
 
-	int rbd_head;
-	int rbd_tail;
+	int rbd_head;   //next descriptor the hardware will hand back to us
+	int rbd_tail;   //last descriptor given to the hardware, mirrors RDT
 	char rbd_idle;
+  struct spinlock rx_lock;
+  char rx_polling;  //receive interrupts masked, poll thread owns the ring
 
   uint32_t iobase;
   uint32_t membase;
   uint8_t irq_line;
   uint8_t irq_pin;
   uint8_t mac_addr[6];
+
+  //receive filters, see e1000_sync_filters()
+  struct e1000_addr_list uc;      //extra unicast addresses, in RAR 1..15
+  struct e1000_addr_list mc;      //multicast addresses, hashed into the MTA
+
+  //hardware counters accumulated by e1000_update_stats(), NICSTAT_* order
+  struct spinlock stats_lock;
+  uint64_t stats[NICSTAT_COUNT];
 };
 
 static void e1000_reg_write(uint32_t reg_addr, uint32_t value, struct e1000 *the_e1000) {
-  *(uint32_t*)(the_e1000->membase + reg_addr) = value;
+  *(volatile uint32_t*)(the_e1000->membase + reg_addr) = value;
 }
 
 static uint32_t e1000_reg_read(uint32_t reg_addr, struct e1000 *the_e1000) {
-  uint32_t value = *(uint32_t*)(the_e1000->membase + reg_addr);
+  uint32_t value = *(volatile uint32_t*)(the_e1000->membase + reg_addr);
   //cprintf("Read value 0x%x from E1000 I/O port 0x%x\n", value, reg_addr);
 
   return value;
 }
 
-// Each inb of port 0x84 takes about 1.25us
-// Super stupid delay logic. Don't even know if this works
-// or understand what port 0x84 does.
-// Could not find an explanantion.
-static void udelay(unsigned int u)
+//one slot always stays empty so that a full ring can't look like an empty one
+#define E1000_TBD_FREE(e1000) \
+        (((e1000)->tbd_head - (e1000)->tbd_tail - 1 + (e1000)->tbd_slots) % (e1000)->tbd_slots)
+
+/**
+ * Move tbd_head past every descriptor the hardware has written back
+ * and wake up senders waiting for a free slot. Caller holds tx_lock.
+ */
+static int e1000_tx_reclaim(struct e1000 *e1000) {
+  int reclaimed = 0;
+
+  while(e1000->tbd_head != e1000->tbd_tail) {
+    int slot = e1000->tbd_head;
+    volatile uint8_t *status = &e1000->tbd[slot].status;
+    if(!E1000_TDESC_STATUS_DONE(*status))
+      break;
+    if(e1000->tx_slot[slot].release) {
+      e1000->tx_slot[slot].release(e1000->tx_slot[slot].release_arg);
+      e1000->tx_slot[slot].release = 0;
+    }
+    e1000->tbd_head = (e1000->tbd_head + 1) % e1000->tbd_slots;
+    reclaimed++;
+  }
+  if(reclaimed)
+    wakeup(&e1000->tbd_head);
+
+  return reclaimed;
+}
+
+// Tell the hardware about every descriptor up to tbd_tail.
+// Descriptors must be in memory before the device sees the new tail.
+static void e1000_tx_doorbell(struct e1000 *e1000) {
+  __sync_synchronize();
+  e1000_reg_write(E1000_TDT, e1000->tbd_tail, e1000);
+}
+
+// Frames can only go out with the link up, or looped back
+#define E1000_TX_LINK_OK(e1000) ((e1000)->link_up || (e1000)->loopback)
+
+// Whether a sender may sleep waiting for slots: it runs in a process
+// with interrupts on. Must be asked before acquiring tx_lock, which
+// turns interrupts off.
+static int e1000_can_sleep(void) {
+  return myproc() != 0 && (readeflags() & FL_IF);
+}
+
+/**
+ * Wait until there are n free transmit slots. Caller holds tx_lock.
+ * Rings the doorbell first so frames queued but not yet posted by a
+ * batch can drain. Sleeps if the caller can, spins otherwise
+ * (interrupt context). Returns -1 right away, or as soon as it notices,
+ * if the link is down: the ring would never drain. Same if the ring is
+ * too small to ever have n free slots.
+ */
+static int e1000_tx_wait_slots(struct e1000 *e1000, int n, int can_sleep) {
+  if(!E1000_TX_LINK_OK(e1000) || n > e1000->tbd_slots - 1)
+    return -1;
+  if(E1000_TBD_FREE(e1000) >= n)
+    return 0;
+  e1000_tx_doorbell(e1000);
+  while(E1000_TBD_FREE(e1000) < n) {
+    //a partial reclaim isn't enough, keep going until n are free
+    if(e1000_tx_reclaim(e1000) > 0)
+      continue;
+    if(can_sleep)
+      sleep(&e1000->tbd_head, &e1000->tx_lock);
+    else  //the LSC interrupt can't get in while we spin
+      e1000->link_up = (e1000_reg_read(E1000_STATUS, e1000) & E1000_STATUS_LU) != 0;
+    if(!E1000_TX_LINK_OK(e1000))
+      return -1;
+  }
+  return 0;
+}
+
+// Point the next free slot at a physically contiguous buffer without
+// posting it. EOP marks the last descriptor of a frame.
+// Caller holds tx_lock and has made sure a slot is free.
+static void e1000_tx_post(struct e1000 *e1000, uint32_t pa, uint16_t length, int eop) {
+  int slot = e1000->tbd_tail;
+#ifdef E1000_TRACE_TX
+  cprintf("e1000 driver: Sending packet of length:0x%x in slot %d\n", length, slot);
+#endif
+  memset(&e1000->tbd[slot], 0, sizeof(struct e1000_tbd));
+  e1000->tbd[slot].addr = (uint64_t)pa;
+	e1000->tbd[slot].length = length;
+	e1000->tbd[slot].cmd = (E1000_TDESC_CMD_RS | E1000_TDESC_CMD_IFCS | E1000_TDESC_CMD_IDE);
+	if(eop)
+	  e1000->tbd[slot].cmd |= E1000_TDESC_CMD_EOP;
+	e1000->tbd_tail = (slot + 1) % e1000->tbd_slots;
+}
+
+// Longest frame we hand to the hardware, the FCS is appended by it (IFCS)
+static uint32_t e1000_max_frame(struct e1000 *e1000) {
+  return e1000->mtu + ETHR_HDR_LEN;
+}
+
+// Copy a frame into the slot's own packet buffer and post it. Caller holds tx_lock.
+static void e1000_tx_fill(struct e1000 *e1000, uint8_t *pkt, uint16_t length) {
+  int slot = e1000->tbd_tail;
+  memmove(e1000->tx_slot[slot].buf, pkt, length);
+  e1000_tx_post(e1000, V2P(e1000->tx_slot[slot].buf), length, 1);
+}
+
+/**
+ * Queue a burst of frames on the transmit ring and ring the TDT doorbell
+ * once for all of them. Returns without waiting for the hardware;
+ * completed descriptors are reclaimed lazily, from the TXDW interrupt or
+ * when the ring is full. Only then does the caller block.
+ * Returns the number of frames queued, oversized frames are dropped.
+ */
+int e1000_send_batch(void *driver, uint8_t **pkts, uint16_t *lengths, int n)
+{
+  struct e1000 *e1000 = (struct e1000*)driver;
+  int can_sleep = e1000_can_sleep();
+  int queued = 0;
+
+  acquire(&e1000->tx_lock);
+  for(int i = 0; i < n; i++) {
+    if(lengths[i] > e1000_max_frame(e1000))
+      continue;
+    if(e1000_tx_wait_slots(e1000, 1, can_sleep) < 0)
+      break;
+    e1000_tx_fill(e1000, pkts[i], lengths[i]);
+    queued++;
+  }
+  if(queued)
+    e1000_tx_doorbell(e1000);
+  release(&e1000->tx_lock);
+
+  return queued;
+}
+
+int e1000_send(void *driver, uint8_t *pkt, uint16_t length)
+{
+  return e1000_send_batch(driver, &pkt, &length, 1) == 1 ? 0 : -1;
+}
+
+/**
+ * Zero-copy transmit. The descriptor points straight at pkt, which must
+ * be kernel memory (direct mapped, hence physically contiguous) and stay
+ * untouched until done(arg) is called. done runs from descriptor
+ * reclaim with tx_lock held, possibly in interrupt context, so it must
+ * not transmit.
+ */
+int e1000_send_zc(void *driver, uint8_t *pkt, uint16_t length,
+                  void (*done)(void *arg), void *arg)
+{
+  struct e1000 *e1000 = (struct e1000*)driver;
+  int can_sleep = e1000_can_sleep();
+
+  if(length > e1000_max_frame(e1000))
+    return -1;
+  if((uint)pkt < KERNBASE || V2P(pkt) + length > PHYSTOP)
+    return -1;
+
+  acquire(&e1000->tx_lock);
+  if(e1000_tx_wait_slots(e1000, 1, can_sleep) < 0) {
+    release(&e1000->tx_lock);
+    return -1;
+  }
+  e1000->tx_slot[e1000->tbd_tail].release = done;
+  e1000->tx_slot[e1000->tbd_tail].release_arg = arg;
+  e1000_tx_post(e1000, V2P(pkt), length, 1);
+  e1000_tx_doorbell(e1000);
+  release(&e1000->tx_lock);
+
+  return 0;
+}
+
+// Queue a context descriptor for the offloads of the data descriptors
+// that follow it. Caller holds tx_lock and has made sure a slot is free.
+static void e1000_tx_post_ctx(struct e1000 *e1000, uint8_t l3off, uint8_t l4off,
+                              uint8_t tucmd, uint32_t paylen, uint8_t hdrlen, uint16_t mss) {
+  struct e1000_ctx_tbd *cd = (struct e1000_ctx_tbd*)&e1000->tbd[e1000->tbd_tail];
+
+  memset(cd, 0, sizeof(*cd));
+  cd->ipcss = l3off;
+  cd->ipcso = l3off + 10;
+  cd->ipcse = l4off - 1;
+  cd->tucss = l4off;
+  cd->tucso = l4off + ((tucmd & E1000_TDESC_TUCMD_TCP) ? 16 : 6);
+  cd->tucse = 0;
+  cd->paylen = paylen;
+  cd->dtyp = E1000_TDESC_DTYP_CTX;
+  cd->tucmd = E1000_TDESC_CMD_DEXT | E1000_TDESC_CMD_RS | E1000_TDESC_TUCMD_IP | tucmd;
+  cd->hdrlen = hdrlen;
+  cd->mss = mss;
+  e1000->tbd_tail = (e1000->tbd_tail + 1) % e1000->tbd_slots;
+}
+
+// Queue an extended data descriptor. Caller holds tx_lock and has made
+// sure a slot is free.
+static void e1000_tx_post_ext(struct e1000 *e1000, uint32_t pa, uint32_t length,
+                              uint8_t dcmd, uint8_t popts) {
+  struct e1000_data_tbd *dd = (struct e1000_data_tbd*)&e1000->tbd[e1000->tbd_tail];
+
+  memset(dd, 0, sizeof(*dd));
+  dd->addr = (uint64_t)pa;
+  dd->length = length;
+  dd->dtyp = E1000_TDESC_DTYP_DATA;
+  dd->dcmd = E1000_TDESC_CMD_DEXT | E1000_TDESC_CMD_RS | E1000_TDESC_CMD_IFCS |
+             E1000_TDESC_CMD_IDE | dcmd;
+  dd->popts = popts;
+  e1000->tbd_tail = (e1000->tbd_tail + 1) % e1000->tbd_slots;
+}
+
+/**
+ * Transmit with checksum offload. A context descriptor describing where
+ * the headers are is queued ahead of the frame, unless the hardware
+ * already holds the same context from the previous offloaded frame.
+ * The frame goes out as an extended data descriptor asking for the
+ * IP and/or TCP/UDP checksum to be inserted. See nic_send_csum() for
+ * what the caller has to put in the checksum fields.
+ */
+int e1000_send_csum(void *driver, uint8_t *pkt, uint16_t length, struct nic_txcsum *csum)
 {
-	unsigned int i;
-	for (i = 0; i < u; i++)
-		inb(0x84);
+  struct e1000 *e1000 = (struct e1000*)driver;
+  int can_sleep = e1000_can_sleep();
+  uint32_t ctx = csum->flags | (csum->l3off << 8) | (csum->l4off << 16);
+  uint8_t popts = 0;
+
+  if(length > e1000_max_frame(e1000) || csum->l4off <= csum->l3off)
+    return -1;
+  if(csum->flags & NIC_TXCSUM_IP)
+    popts |= E1000_TDESC_POPTS_IXSM;
+  if(csum->flags & (NIC_TXCSUM_TCP | NIC_TXCSUM_UDP))
+    popts |= E1000_TDESC_POPTS_TXSM;
+
+  acquire(&e1000->tx_lock);
+  if(e1000_tx_wait_slots(e1000, 2, can_sleep) < 0) {
+    release(&e1000->tx_lock);
+    return -1;
+  }
+  if(ctx != e1000->tx_ctx) {
+    e1000_tx_post_ctx(e1000, csum->l3off, csum->l4off,
+                      (csum->flags & NIC_TXCSUM_TCP) ? E1000_TDESC_TUCMD_TCP : 0,
+                      0, 0, 0);
+    e1000->tx_ctx = ctx;
+  }
+  int slot = e1000->tbd_tail;
+  memmove(e1000->tx_slot[slot].buf, pkt, length);
+  e1000_tx_post_ext(e1000, V2P(e1000->tx_slot[slot].buf), length, E1000_TDESC_CMD_EOP, popts);
+  e1000_tx_doorbell(e1000);
+  release(&e1000->tx_lock);
+
+  return 0;
 }
 
-void e1000_send(void *driver, uint8_t *pkt, uint16_t length )
+/**
+ * TCP segmentation offload. hdr is the Ethernet/IPv4/TCP header template
+ * of the first segment and is copied; payload is referenced in place
+ * like e1000_send_zc() and done(arg) runs once every segment is out.
+ * The hardware cuts payload into mss sized segments, fixing up IP total
+ * length, IP id, TCP sequence number, flags and both checksums on each.
+ * See nic_send_tso() for how the template must be filled in, and for
+ * when done is called if the send fails.
+ */
+int e1000_send_tso(void *driver, uint8_t *hdr, uint16_t hdrlen,
+                   uint8_t *payload, uint32_t paylen, struct nic_tso *tso,
+                   void (*done)(void *arg), void *arg)
 {
   struct e1000 *e1000 = (struct e1000*)driver;
-  cprintf("e1000 driver: Sending packet of length:0x%x %x starting at physical address:0x%x\n", length, sizeof(struct ethr_hdr), V2P(e1000->tx_buf[e1000->tbd_tail]));
-  memset(e1000->tbd[e1000->tbd_tail], 0, sizeof(struct e1000_tbd));
-  memmove((e1000->tx_buf[e1000->tbd_tail]), pkt, length);
-  e1000->tbd[e1000->tbd_tail]->addr = (uint64_t)(uint32_t)V2P(e1000->tx_buf[e1000->tbd_tail]);
-	e1000->tbd[e1000->tbd_tail]->length = length;
-	e1000->tbd[e1000->tbd_tail]->cmd = (E1000_TDESC_CMD_RS | E1000_TDESC_CMD_EOP | E1000_TDESC_CMD_IFCS);
-  e1000->tbd[e1000->tbd_tail]->cso = 0;
-	// update the tail so the hardware knows it's ready
-	int oldtail = e1000->tbd_tail;
-	e1000->tbd_tail = (e1000->tbd_tail + 1) % E1000_TBD_SLOTS;
-	e1000_reg_write(E1000_TDT, e1000->tbd_tail, e1000);
-
-	while( !E1000_TDESC_STATUS_DONE(e1000->tbd[oldtail]->status) )
-	{
-		udelay(2);
-	}
-  cprintf("after while loop\n");
+  int can_sleep = e1000_can_sleep();
+  int ndesc = 2 + (paylen + E1000_TSO_CHUNK - 1) / E1000_TSO_CHUNK;
+
+  if(hdrlen > NIC_TSO_MAX_HDR || paylen == 0 || paylen > NIC_TSO_MAX ||
+     tso->l4off <= tso->l3off || tso->mss == 0)
+    goto fail;
+  if((uint)payload < KERNBASE || V2P(payload) + paylen > PHYSTOP)
+    goto fail;
+  //one slot always stays empty, a small ring could never free this many.
+  //payload is still the caller's, nic_send_tso() segments it instead
+  if(ndesc > e1000->tbd_slots - 1)
+    return NIC_TSO_SOFTWARE;
+
+  acquire(&e1000->tx_lock);
+  if(e1000_tx_wait_slots(e1000, ndesc, can_sleep) < 0) {
+    release(&e1000->tx_lock);
+    goto fail;
+  }
+  e1000_tx_post_ctx(e1000, tso->l3off, tso->l4off,
+                    E1000_TDESC_TUCMD_TCP | E1000_TDESC_TUCMD_TSE,
+                    paylen, hdrlen, tso->mss);
+  //the hardware now holds a TSO context, the next checksum frame needs a new one
+  e1000->tx_ctx = 0;
+
+  int slot = e1000->tbd_tail;
+  uint8_t popts = E1000_TDESC_POPTS_IXSM | E1000_TDESC_POPTS_TXSM;
+  memmove(e1000->tx_slot[slot].buf, hdr, hdrlen);
+  e1000_tx_post_ext(e1000, V2P(e1000->tx_slot[slot].buf), hdrlen, E1000_TDESC_CMD_TSE, popts);
+  for(uint32_t off = 0; off < paylen; off += E1000_TSO_CHUNK) {
+    uint32_t len = paylen - off < E1000_TSO_CHUNK ? paylen - off : E1000_TSO_CHUNK;
+    uint8_t dcmd = E1000_TDESC_CMD_TSE;
+    if(off + len == paylen) {
+      dcmd |= E1000_TDESC_CMD_EOP;
+      e1000->tx_slot[e1000->tbd_tail].release = done;
+      e1000->tx_slot[e1000->tbd_tail].release_arg = arg;
+    }
+    e1000_tx_post_ext(e1000, V2P(payload + off), len, dcmd, popts);
+  }
+  e1000_tx_doorbell(e1000);
+  release(&e1000->tx_lock);
+
+  return 0;
+
+fail:
+  if(done)
+    done(arg);
+  return -1;
+}
+
+/**
+ * Gather transmit. The frame is assembled by the hardware from nfrags
+ * buffers, one descriptor each, EOP only on the last. Fragments marked
+ * copy are copied into the slot's packet buffer (e.g. headers built on the
+ * stack); the others are referenced in place like e1000_send_zc() and
+ * done(arg) runs once the whole frame is out.
+ */
+int e1000_send_sg(void *driver, struct nic_frag *frags, int nfrags,
+                  void (*done)(void *arg), void *arg)
+{
+  struct e1000 *e1000 = (struct e1000*)driver;
+  int can_sleep = e1000_can_sleep();
+  uint32_t total = 0;
+
+  if(nfrags <= 0 || nfrags > NIC_MAX_FRAGS)
+    return -1;
+  for(int i = 0; i < nfrags; i++) {
+    total += frags[i].length;
+    if(frags[i].copy) {
+      if(frags[i].length > e1000->tx_bufsize)
+        return -1;
+    } else if((uint)frags[i].buf < KERNBASE ||
+              V2P(frags[i].buf) + frags[i].length > PHYSTOP) {
+      return -1;
+    }
+  }
+  if(total > e1000_max_frame(e1000))
+    return -1;
+
+  acquire(&e1000->tx_lock);
+  //a frame's descriptors must all be posted together
+  if(e1000_tx_wait_slots(e1000, nfrags, can_sleep) < 0) {
+    release(&e1000->tx_lock);
+    return -1;
+  }
+  for(int i = 0; i < nfrags; i++) {
+    int slot = e1000->tbd_tail;
+    int eop = (i == nfrags - 1);
+    uint32_t pa;
+    if(frags[i].copy) {
+      memmove(e1000->tx_slot[slot].buf, frags[i].buf, frags[i].length);
+      pa = V2P(e1000->tx_slot[slot].buf);
+    } else {
+      pa = V2P(frags[i].buf);
+    }
+    if(eop) {
+      e1000->tx_slot[slot].release = done;
+      e1000->tx_slot[slot].release_arg = arg;
+    }
+    e1000_tx_post(e1000, pa, frags[i].length, eop);
+  }
+  e1000_tx_doorbell(e1000);
+  release(&e1000->tx_lock);
+
+  return 0;
+}
+
+/**
+ * Program the receive filters from the address lists: unicast addresses
+ * into RAR 1..15 and multicast ones into the MTA hash. When there are
+ * more unicast addresses than RAR entries, or either list overflowed,
+ * fall back to UPE/MPE for that kind of address. Caller holds rx_lock.
+ */
+static void e1000_sync_filters(struct e1000 *e1000) {
+  uint32_t mta[E1000_MTA_REGS];
+  int uc_promisc = e1000->uc.overflow || e1000->uc.n > E1000_RAR_ENTRIES - 1;
+  int i;
+
+  for(i = 1; i < E1000_RAR_ENTRIES; i++) {
+    uint8_t *a = e1000->uc.addr[i-1];
+    //clear AV first so a half written entry never matches
+    e1000_reg_write(E1000_RCV_RAH(i), 0, e1000);
+    if(uc_promisc || i > e1000->uc.n)
+      continue;
+    e1000_reg_write(E1000_RCV_RAL(i), a[0] | a[1] << 8 | a[2] << 16 | a[3] << 24, e1000);
+    e1000_reg_write(E1000_RCV_RAH(i), a[4] | a[5] << 8 | E1000_RAH_AV, e1000);
+  }
+
+  //RCTL.MO = 0, the hash is address bits 47:36
+  memset(mta, 0, sizeof(mta));
+  for(i = 0; i < e1000->mc.n; i++) {
+    uint8_t *a = e1000->mc.addr[i];
+    uint32_t hash = ((a[4] >> 4) | (a[5] << 4)) & 0xfff;
+    mta[hash >> 5] |= 1 << (hash & 0x1f);
+  }
+  for(i = 0; i < E1000_MTA_REGS; i++)
+    e1000_reg_write(E1000_MTA + 4*i, mta[i], e1000);
+
+  e1000->rctl &= ~(E1000_RCTL_UPE | E1000_RCTL_MPE);
+  if(uc_promisc)
+    e1000->rctl |= E1000_RCTL_UPE;
+  if(e1000->mc.overflow)
+    e1000->rctl |= E1000_RCTL_MPE;
+  e1000_reg_write(E1000_RCTL, e1000->rctl, e1000);
+}
+
+#define E1000_PAGES(bytes) (((bytes) + PGSIZE - 1) / PGSIZE)
+
+/**
+ * Size the buffers for an MTU: the smallest receive buffer size RCTL
+ * offers that holds a whole frame, so frames never span descriptors,
+ * and copy path transmit buffers of one frame. Only called before the
+ * rings are allocated.
+ */
+static void e1000_size_buffers(struct e1000 *e1000, uint32_t mtu) {
+  static const struct { uint32_t size, rctl; } bsize[] = {
+    { 2048,  E1000_RCTL_BSIZE_2048 },
+    { 4096,  E1000_RCTL_BSIZE_4096 | E1000_RCTL_BSEX },
+    { 8192,  E1000_RCTL_BSIZE_8192 | E1000_RCTL_BSEX },
+    { 16384, E1000_RCTL_BSIZE_16384 | E1000_RCTL_BSEX },
+  };
+  int i;
+
+  for(i = 0; i < NELEM(bsize) - 1; i++)
+    if(E1000_FRAME_LEN(mtu) <= bsize[i].size)
+      break;
+  e1000->mtu = mtu;
+  e1000->rx_bufsize = bsize[i].size;
+  e1000->tx_bufsize = mtu + ETHR_HDR_LEN;
+  e1000->rctl = E1000_RCTL_EN | E1000_RCTL_BAM | bsize[i].rctl;
+  if(mtu > NIC_DEF_MTU)
+    e1000->rctl |= E1000_RCTL_LPE;
+}
+
+// Give back the rings e1000_alloc_rings() got before it failed
+static void e1000_free_rings(struct e1000 *e1000) {
+  if(e1000->tbd)
+    kfreen((char*)e1000->tbd, E1000_PAGES(e1000->tbd_slots * sizeof(struct e1000_tbd)));
+  if(e1000->rbd)
+    kfreen((char*)e1000->rbd, E1000_PAGES(e1000->rbd_slots * sizeof(struct e1000_rbd)));
+  if(e1000->tx_slot)
+    kfreen((char*)e1000->tx_slot, E1000_PAGES(e1000->tbd_slots * sizeof(struct e1000_tx_slot)));
+  if(e1000->rx_buf)
+    kfreen((char*)e1000->rx_buf, E1000_PAGES(e1000->rbd_slots * sizeof(struct pktbuf*)));
+  e1000->tbd = 0;
+  e1000->rbd = 0;
+  e1000->tx_slot = 0;
+  e1000->rx_buf = 0;
+}
+
+/**
+ * Allocate the descriptor rings and their packet buffers. Each ring is
+ * a physically contiguous array of descriptors from kallocn(), so its
+ * size is not bounded by a page and needs no per-descriptor pointers.
+ * kalloc() hands out junk filled pages; a stale DD bit would make us
+ * reap descriptors the hardware never wrote back, so rings are zeroed.
+ * On failure the rings are freed again; pool buffers already carved
+ * stay with their pool, pools are never given back.
+ */
+static int e1000_alloc_rings(struct e1000 *e1000, int tbd_slots, int rbd_slots) {
+  int i;
+
+  if(tbd_slots < 8 || tbd_slots > E1000_MAX_SLOTS || tbd_slots % 8 ||
+     rbd_slots < 8 || rbd_slots > E1000_MAX_SLOTS || rbd_slots % 8)
+    return -1;
+  e1000->tbd_slots = tbd_slots;
+  e1000->rbd_slots = rbd_slots;
+
+  e1000->tbd = (struct e1000_tbd*)kallocn(E1000_PAGES(tbd_slots * sizeof(struct e1000_tbd)));
+  e1000->rbd = (struct e1000_rbd*)kallocn(E1000_PAGES(rbd_slots * sizeof(struct e1000_rbd)));
+  e1000->tx_slot = (struct e1000_tx_slot*)kallocn(E1000_PAGES(tbd_slots * sizeof(struct e1000_tx_slot)));
+  e1000->rx_buf = (struct pktbuf**)kallocn(E1000_PAGES(rbd_slots * sizeof(struct pktbuf*)));
+  if(!e1000->tbd || !e1000->rbd || !e1000->tx_slot || !e1000->rx_buf)
+    goto fail;
+  memset(e1000->tbd, 0, tbd_slots * sizeof(struct e1000_tbd));
+  memset(e1000->rbd, 0, rbd_slots * sizeof(struct e1000_rbd));
+  memset(e1000->tx_slot, 0, tbd_slots * sizeof(struct e1000_tx_slot));
+
+  //Receive buffers come from a pool so filled ones can be passed up
+  //by reference and the slot refilled with a fresh one
+  if(pktpool_init(&e1000->rx_pool, "e1000 rx pool",
+                  rbd_slots * E1000_RX_POOL_FACTOR, e1000->rx_bufsize) < 0)
+    goto fail;
+  if(pktpool_init(&e1000->rx_small, "e1000 rx small",
+                  rbd_slots, E1000_RX_SMALL_BUFSIZE) < 0)
+    goto fail;
+  for(i = 0; i < rbd_slots; i++) {
+    e1000->rx_buf[i] = pktbuf_alloc(&e1000->rx_pool);
+    e1000->rbd[i].addr_l = V2P(e1000->rx_buf[i]->data);
+  }
+
+  //Transmit copy path buffers, one per slot for its lifetime
+  if(pktpool_init(&e1000->tx_pool, "e1000 tx pool", tbd_slots, e1000->tx_bufsize) < 0)
+    goto fail;
+  for(i = 0; i < tbd_slots; i++)
+    e1000->tx_slot[i].buf = pktbuf_alloc(&e1000->tx_pool)->data;
+
+  return 0;
+
+fail:
+  e1000_free_rings(e1000);
+  return -1;
 }
 
 int e1000_init(struct pci_func *pcif, void** driver, uint8_t *mac_addr) {
   struct e1000 *the_e1000 = (struct e1000*)kalloc();
+  memset(the_e1000, 0, sizeof(struct e1000));
 
 	for (int i = 0; i < 6; i++) {
     // I/O port numbers are 16 bits, so they should be between 0 and 0xffff.
@@ -264,22 +1029,31 @@ int e1000_init(struct pci_func *pcif, void** driver, uint8_t *mac_addr) {
   }
   if (!the_e1000->iobase)
     panic("Fail to find a valid I/O port base for E1000.");
-    if (!the_e1000->membase)
-      panic("Fail to find a valid Mem I/O base for E1000.");
+  if (!the_e1000->membase)
+    panic("Fail to find a valid Mem I/O base for E1000.");
 
 	the_e1000->irq_line = pcif->irq_line;
   the_e1000->irq_pin = pcif->irq_pin;
   cprintf("e1000 init: interrupt pin=%d and line:%d\n",the_e1000->irq_pin,the_e1000->irq_line);
   the_e1000->tbd_head = the_e1000->tbd_tail = 0;
   the_e1000->rbd_head = the_e1000->rbd_tail = 0;
+  initlock(&the_e1000->rx_lock, "e1000 rx");
+  initlock(&the_e1000->tx_lock, "e1000 tx");
+  initlock(&the_e1000->stats_lock, "e1000 stats");
 
   // Reset device but keep the PCI config
   e1000_reg_write(E1000_CNTRL_REG,
     e1000_reg_read(E1000_CNTRL_REG, the_e1000) | E1000_CNTRL_RST_MASK,
     the_e1000);
-  //read back the value after approx 1us to check RST bit cleared
+  //RST self clears once the reset is done, within a few us
+  uint64_t deadline = nsecs() + E1000_RESET_TIMEOUT;
   do {
     udelay(3);
+    if(nsecs() > deadline) {
+      cprintf("ERROR:e1000:device did not come out of reset\n");
+      kfree((char*)the_e1000);
+      return -1;
+    }
   }while(E1000_CNTRL_RST_BIT(e1000_reg_read(E1000_CNTRL_REG, the_e1000)));
 
   //the manual says in Section 14.3 General Config -
@@ -302,58 +1076,17 @@ int e1000_init(struct pci_func *pcif, void** driver, uint8_t *mac_addr) {
 
   cprintf("\nMAC address of the e1000 device:%s\n", mac_str);
   //Transmit/Receive and DMA config beyond this point...
-  //sizeof(tbd)=128bits/16bytes. so 256 of these will fit in a page of size 4KB.
-  //But the struct e1000 has to contain pointer to these many descriptors.
-  //Each pointer being 4 bytes, and 4 such array of pointers(inclusing packet buffers)
-  //you get N*16+(some more values in the struct e1000) = 4096
-  // N=128=E1000_TBD_SLOTS. i.e., the maximum number of descriptors in one ring
-  struct e1000_tbd *ttmp = (struct e1000_tbd*)kalloc();
-  for(int i=0;i<E1000_TBD_SLOTS;i++, ttmp++) {
-    the_e1000->tbd[i] = (struct e1000_tbd*)ttmp;
-  }
-  //check the last nibble of the transmit/receive rings to make sure they
-  //are on paragraph boundary
-  if( (V2P(the_e1000->tbd[0]) & 0x0000000f) != 0){
-    cprintf("ERROR:e1000:Transmit Descriptor Ring not on paragraph boundary\n");
-    kfree((char*)ttmp);
-    return -1;
-  }
-  //same for rbd
-  struct e1000_rbd *rtmp = (struct e1000_rbd*)kalloc();
-  for(int i=0;i<E1000_RBD_SLOTS;i++, rtmp++) {
-    the_e1000->rbd[i] = (struct e1000_rbd*)rtmp;
-  }
-  if( (V2P(the_e1000->rbd[0]) & 0x0000000f) != 0){
-    cprintf("ERROR:e1000:Receive Descriptor Ring not on paragraph boundary\n");
-    kfree((char*)rtmp);
+  e1000_size_buffers(the_e1000, E1000_MTU);
+  if(e1000_alloc_rings(the_e1000, E1000_TBD_SLOTS, E1000_RBD_SLOTS) < 0) {
+    cprintf("ERROR:e1000:Failed to allocate descriptor rings\n");
+    kfree((char*)the_e1000);
     return -1;
   }
 
-  //Now for the packet buffers in Receive Ring. Can fit 2 packet buf in 1 page
-  struct packet_buf *tmp;
-  for(int i=0; i<E1000_RBD_SLOTS; i+=2) {
-    tmp = (struct packet_buf*)kalloc();
-    the_e1000->rx_buf[i] = tmp++;
-    the_e1000->rbd[i]->addr_l = V2P((uint32_t)the_e1000->rx_buf[i]);
-    the_e1000->rbd[i]->addr_h = 0;
-    the_e1000->rx_buf[i+1] = tmp;
-    the_e1000->rbd[i+1]->addr_l = V2P((uint32_t)the_e1000->rx_buf[i+1]);
-    the_e1000->rbd[i+1]->addr_h = 0;
-  }
-  for(int i=0; i<E1000_TBD_SLOTS; i+=2) {
-    tmp = (struct packet_buf*)kalloc();
-    the_e1000->tx_buf[i] = tmp++;
-    //the_e1000->tbd[i]->addr = (uint32_t)the_e1000->tx_buf[i];
-    //the_e1000->tbd[i]->addr_h = 0;
-    the_e1000->tx_buf[i+1] = tmp;
-    //the_e1000->tbd[i+1]->addr_l = (uint32_t)the_e1000->tx_buf[i+1];
-    //the_e1000->tbd[i+1]->addr_h = 0;
-  }
-
   //Write the Descriptor ring addresses in TDBAL, and RDBAL, plus HEAD and TAIL pointers
-  e1000_reg_write(E1000_TDBAL, V2P(the_e1000->tbd[0]), the_e1000);
+  e1000_reg_write(E1000_TDBAL, V2P(the_e1000->tbd), the_e1000);
   e1000_reg_write(E1000_TDBAH, 0x00000000, the_e1000);
-  e1000_reg_write(E1000_TDLEN, (E1000_TBD_SLOTS*16) << 7, the_e1000);
+  e1000_reg_write(E1000_TDLEN, the_e1000->tbd_slots * sizeof(struct e1000_tbd), the_e1000);
   e1000_reg_write(E1000_TDH, 0x00000000, the_e1000);
   e1000_reg_write(E1000_TCTL,
                   E1000_TCTL_EN |
@@ -367,30 +1100,456 @@ int e1000_init(struct pci_func *pcif, void** driver, uint8_t *mac_addr) {
                     E1000_TIPG_IPGR1_SET(10) |
                     E1000_TIPG_IPGR2_SET(10),
                   the_e1000);
-  e1000_reg_write(E1000_RDBAL, V2P(the_e1000->rbd[0]), the_e1000);
+  e1000_reg_write(E1000_RDBAL, V2P(the_e1000->rbd), the_e1000);
   e1000_reg_write(E1000_RDBAH, 0x00000000, the_e1000);
-  e1000_reg_write(E1000_RDLEN, (E1000_RBD_SLOTS*16) << 7, the_e1000);
+  e1000_reg_write(E1000_RDLEN, the_e1000->rbd_slots * sizeof(struct e1000_rbd), the_e1000);
   e1000_reg_write(E1000_RDH, 0x00000000, the_e1000);
-  e1000_reg_write(E1000_RDT, 0x00000000, the_e1000);
-  //enable interrupts
-  e1000_reg_write(E1000_IMS, E1000_IMS_RXSEQ | E1000_IMS_RXO | E1000_IMS_RXT0|E1000_IMS_TXQE, the_e1000);
-  //Receive control Register.
-  e1000_reg_write(E1000_RCTL,
-                E1000_RCTL_EN |
-                  E1000_RCTL_BAM |
-                  E1000_RCTL_BSIZE | 0x00000008,//|
-                //  E1000_RCTL_SECRC,
-                the_e1000);
-cprintf("e1000:Interrupt enabled mask:0x%x\n", e1000_reg_read(E1000_IMS, the_e1000));
-  //Register interrupt handler here...
-  picenable(the_e1000->irq_line);
-  ioapicenable(the_e1000->irq_line, 0);
-  ioapicenable(the_e1000->irq_line, 1);
-
+  //RDT==RDH means the ring is empty, i.e. hardware owns no buffers.
+  //Hand it every slot but one so head never catches up with tail.
+  the_e1000->rbd_tail = the_e1000->rbd_slots - 1;
+  e1000_reg_write(E1000_RDT, the_e1000->rbd_tail, the_e1000);
+  //interrupt moderation
+  the_e1000->itr = E1000_ITR_DEFAULT;
+  the_e1000->rdtr = E1000_RDTR_DEFAULT;
+  the_e1000->radv = E1000_RADV_DEFAULT;
+  the_e1000->tidv = E1000_TIDV_DEFAULT;
+  the_e1000->tadv = E1000_TADV_DEFAULT;
+  e1000_reg_write(E1000_ITR, the_e1000->itr, the_e1000);
+  e1000_reg_write(E1000_RDTR, the_e1000->rdtr, the_e1000);
+  e1000_reg_write(E1000_RADV, the_e1000->radv, the_e1000);
+  e1000_reg_write(E1000_TIDV, the_e1000->tidv, the_e1000);
+  e1000_reg_write(E1000_TADV, the_e1000->tadv, the_e1000);
+  //small received frames are copied, the rest handed up in place
+  the_e1000->rx_copybreak = E1000_RX_COPYBREAK;
+  //let the hardware verify IP and TCP/UDP checksums of received frames
+  e1000_reg_write(E1000_RXCSUM, E1000_RXCSUM_IPOFLD | E1000_RXCSUM_TUOFLD, the_e1000);
+  //interrupts stay masked until e1000_enable_intr(): the device isn't
+  //registered yet, so nobody would claim them
+  e1000_reg_write(E1000_IMC, 0xffffffff, the_e1000);
+  e1000_reg_read(E1000_ICR, the_e1000);
+  //the MTA comes out of reset undefined, program the filters before
+  //turning the receiver on. This writes RCTL.
+  e1000_sync_filters(the_e1000);
+  //autonegotiation may still be running. transmit goes by what STATUS
+  //says now, the nic layer hears about the link in e1000_enable_intr()
+  the_e1000->link_up = (e1000_reg_read(E1000_STATUS, the_e1000) & E1000_STATUS_LU) != 0;
 
   *driver = the_e1000;
   return 0;
 }
 
-void e1000_recv(void *driver, uint8_t* pkt, uint16_t length) {
+// Translate the descriptor checksum status into NIC_RXCSUM_* flags
+static int e1000_rx_csum(struct e1000_rbd *rbd) {
+  int flags = 0;
+
+  if(rbd->status & E1000_RDESC_STATUS_IXSM_MASK)
+    return 0;
+  if((rbd->status & E1000_RDESC_STATUS_IPCS_MASK) && !(rbd->errors & E1000_RDESC_ERR_IPE))
+    flags |= NIC_RXCSUM_IP_OK;
+  if((rbd->status & E1000_RDESC_STATUS_TCPCS_MASK) && !(rbd->errors & E1000_RDESC_ERR_TCPE))
+    flags |= NIC_RXCSUM_L4_OK;
+
+  return flags;
+}
+
+/**
+ * Reap up to budget receive descriptors the hardware has written back
+ * (DD set), pass their frames up to nic_rx() and give the slots back to
+ * the hardware. RDT is written once after the whole batch.
+ * A filled buffer is detached from its slot and handed up as is, the
+ * slot gets a fresh one from rx_pool. If the pool is dry the frame is
+ * dropped and its buffer stays posted. Frames shorter than rx_copybreak
+ * are copied into a buffer from rx_small instead, so the big buffer is
+ * re-posted right away.
+ * Caller holds rx_lock.
+ */
+static int e1000_rx_reap(struct e1000 *e1000, struct nic_device *nd, int budget) {
+  struct e1000_rbd *rbd;
+  int reaped = 0;
+
+  while(reaped < budget) {
+    rbd = &e1000->rbd[e1000->rbd_head];
+    if(!E1000_RDESC_STATUS_DONE(*(volatile uint8_t*)&rbd->status))
+      break;
+    //buffers hold a whole frame of the MTU, so a frame spanning descriptors
+    //is over the MTU (LPE lets up to 16KB in). Drop all its pieces.
+    if(!E1000_RDESC_STATUS_EOP(rbd->status)) {
+      e1000->rx_discard = 1;
+    } else if(e1000->rx_discard) {
+      e1000->rx_discard = 0;
+    } else if(!(rbd->errors & E1000_RDESC_ERR_FRAME)) {
+      struct pktbuf *pb = e1000->rx_buf[e1000->rbd_head];
+      struct pktbuf *fresh;
+      if(rbd->length < e1000->rx_copybreak &&
+         (fresh = pktbuf_alloc(&e1000->rx_small)) != 0) {
+        memmove(fresh->data, pb->data, rbd->length);
+        fresh->len = rbd->length;
+        e1000->rx_copy++;
+        nic_rx(nd, fresh, e1000_rx_csum(rbd));
+      } else if((fresh = pktbuf_alloc(&e1000->rx_pool)) != 0) {
+        pb->len = rbd->length;
+        e1000->rx_buf[e1000->rbd_head] = fresh;
+        rbd->addr_l = V2P(fresh->data);
+        e1000->rx_flip++;
+        nic_rx(nd, pb, e1000_rx_csum(rbd));
+      } else {
+        e1000->rx_nobuf++;
+      }
+    }
+    rbd->status = 0;
+    e1000->rbd_tail = e1000->rbd_head;
+    e1000->rbd_head = (e1000->rbd_head + 1) % e1000->rbd_slots;
+    reaped++;
+  }
+  if(reaped)
+    e1000_reg_write(E1000_RDT, e1000->rbd_tail, e1000);
+
+  return reaped;
+}
+
+/**
+ * Poll entry, called by the nic poll thread while receive interrupts are
+ * masked. Once the ring is drained within budget, receive interrupts are
+ * turned back on. A frame landing in between is not lost: its cause
+ * stays latched in ICR and fires as soon as IMS is written.
+ */
+int e1000_recv(struct nic_device *nd, int budget) {
+  struct e1000 *e1000 = (struct e1000*)nd->driver;
+  int reaped;
+
+  acquire(&e1000->rx_lock);
+  reaped = e1000_rx_reap(e1000, nd, budget);
+  if(reaped < budget && e1000->rx_polling) {
+    e1000->rx_polling = 0;
+    e1000_reg_write(E1000_IMS, E1000_IMS_RX_MASK, e1000);
+  }
+  release(&e1000->rx_lock);
+
+  return reaped;
+}
+
+/**
+ * Link status changed, or init wants it reported. Record it for
+ * transmit, wake senders waiting on a ring that won't drain now, and
+ * tell the nic layer. Speed and duplex are what autonegotiation settled.
+ */
+static void e1000_link_change(struct e1000 *e1000, struct nic_device *nd) {
+  uint32_t status = e1000_reg_read(E1000_STATUS, e1000);
+  static const uint16_t speeds[] = { 10, 100, 1000, 1000 };
+  int up = (status & E1000_STATUS_LU) != 0;
+
+  acquire(&e1000->tx_lock);
+  e1000->link_up = up;
+  if(!up)
+    wakeup(&e1000->tbd_head);
+  release(&e1000->tx_lock);
+  nic_link_change(nd, up,
+                  speeds[(status & E1000_STATUS_SPEED_MASK) >> E1000_STATUS_SPEED_SHIFT],
+                  (status & E1000_STATUS_FD) != 0);
+}
+
+/**
+ * Called by the nic layer once nd is registered and the layer is set
+ * up. Reports the link as it is now, then unmasks interrupts and routes
+ * the irq. A link change in between is latched in ICR and raises LSC as
+ * soon as it is unmasked.
+ */
+void e1000_enable_intr(struct nic_device *nd) {
+  struct e1000 *e1000 = (struct e1000*)nd->driver;
+
+  e1000_link_change(e1000, nd);
+  e1000_reg_write(E1000_IMS, E1000_IMS_RX_MASK | E1000_IMS_TXDW | E1000_IMS_TXQE |
+                  E1000_IMS_LSC, e1000);
+  picenable(nd->irq_line);
+  ioapicenable(nd->irq_line, 0);
+  ioapicenable(nd->irq_line, 1);
+}
+
+void e1000_intr(struct nic_device *nd) {
+  struct e1000 *e1000 = (struct e1000*)nd->driver;
+  uint32_t icr;
+  int reaped, poll = 0;
+
+  //reading ICR acks the causes. keep going until no new cause shows up,
+  //the ioapic line is edge triggered and we would miss it otherwise.
+  while((icr = e1000_reg_read(E1000_ICR, e1000)) != 0) {
+    if(icr & E1000_ICR_RX_MASK) {
+      //handle a trickle right here. a burst that doesn't fit in the
+      //interrupt budget switches the ring to polled mode until drained.
+      acquire(&e1000->rx_lock);
+      if(!e1000->rx_polling) {
+        reaped = e1000_rx_reap(e1000, nd, NIC_INTR_BUDGET);
+        nd->rx_intr_frames += reaped;
+        if(reaped == NIC_INTR_BUDGET) {
+          e1000->rx_polling = 1;
+          e1000_reg_write(E1000_IMC, E1000_IMS_RX_MASK, e1000);
+          poll = 1;
+        }
+      }
+      release(&e1000->rx_lock);
+    }
+    if(icr & E1000_ICR_TX_MASK) {
+      acquire(&e1000->tx_lock);
+      e1000_tx_reclaim(e1000);
+      release(&e1000->tx_lock);
+    }
+    if(icr & E1000_ICR_LSC)
+      e1000_link_change(e1000, nd);
+  }
+  if(poll)
+    nic_schedule_poll(nd);
+}
+
+int e1000_get_param(void *driver, int param, uint32_t *value) {
+  struct e1000 *e1000 = (struct e1000*)driver;
+
+  switch(param) {
+  case NICCTL_ITR:  *value = e1000->itr; break;
+  case NICCTL_RDTR: *value = e1000->rdtr; break;
+  case NICCTL_RADV: *value = e1000->radv; break;
+  case NICCTL_TIDV: *value = e1000->tidv; break;
+  case NICCTL_TADV: *value = e1000->tadv; break;
+  case NICCTL_RX_RING: *value = e1000->rbd_slots; break;
+  case NICCTL_TX_RING: *value = e1000->tbd_slots; break;
+  case NICCTL_RX_NOBUF: *value = e1000->rx_nobuf; break;
+  case NICCTL_RX_FREE: *value = e1000->rx_pool.nfree; break;
+  case NICCTL_COPYBREAK: *value = e1000->rx_copybreak; break;
+  case NICCTL_MTU: *value = e1000->mtu; break;
+  case NICCTL_LOOPBACK: *value = e1000->loopback; break;
+  case NICCTL_RX_COPY: *value = e1000->rx_copy; break;
+  case NICCTL_RX_FLIP: *value = e1000->rx_flip; break;
+  default:
+    return -1;
+  }
+  return 0;
+}
+
+/**
+ * Read or write a PHY register through MDIC. Returns the register value
+ * (0 for writes), or -1 if the PHY didn't answer.
+ */
+static int e1000_phy_rw(struct e1000 *e1000, uint32_t op, int reg, uint16_t data) {
+  uint32_t mdic = op | reg << E1000_MDIC_REG_SHIFT |
+                  E1000_PHY_ADDR << E1000_MDIC_PHY_SHIFT | data;
+  uint64_t deadline;
+
+  e1000_reg_write(E1000_MDIC, mdic, e1000);
+  //an MDI cycle takes 64 MDC clocks, well under 100us
+  deadline = nsecs() + E1000_MDIC_TIMEOUT;
+  do {
+    udelay(1);
+    mdic = e1000_reg_read(E1000_MDIC, e1000);
+    if(mdic & E1000_MDIC_READY)
+      return (mdic & E1000_MDIC_ERROR) ? -1 : (mdic & 0xffff);
+  } while(nsecs() < deadline);
+  return -1;
+}
+
+/**
+ * Turn loopback on or off. Transmitted frames come straight back in on
+ * the receive ring and never reach the wire. Both MAC loopback (RCTL.LBM)
+ * and PHY loopback are set; emulated devices like qemu's only honour
+ * the latter.
+ */
+static int e1000_set_loopback(struct e1000 *e1000, int on) {
+  int ctrl = e1000_phy_rw(e1000, E1000_MDIC_OP_READ, E1000_PHY_CTRL, 0);
+
+  if(ctrl < 0)
+    return -1;
+  if(on)
+    ctrl |= E1000_PHY_CTRL_LOOPBACK;
+  else
+    ctrl &= ~E1000_PHY_CTRL_LOOPBACK;
+  if(e1000_phy_rw(e1000, E1000_MDIC_OP_WRITE, E1000_PHY_CTRL, ctrl) < 0)
+    return -1;
+
+  acquire(&e1000->rx_lock);
+  e1000->rctl &= ~E1000_RCTL_LBM_MASK;
+  if(on)
+    e1000->rctl |= E1000_RCTL_LBM_MAC;
+  e1000_reg_write(E1000_RCTL, e1000->rctl, e1000);
+  release(&e1000->rx_lock);
+  e1000->loopback = on;
+  return 0;
+}
+
+int e1000_set_param(void *driver, int param, uint32_t value) {
+  struct e1000 *e1000 = (struct e1000*)driver;
+  uint32_t reg, *field;
+
+  if(param == NICCTL_MTU) {
+    //buffers were sized for the MTU at init and can't grow
+    if(value < NIC_MIN_MTU || value > NIC_MAX_MTU ||
+       E1000_FRAME_LEN(value) > e1000->rx_bufsize ||
+       value + ETHR_HDR_LEN > e1000->tx_bufsize)
+      return -1;
+    acquire(&e1000->tx_lock);
+    e1000->mtu = value;
+    release(&e1000->tx_lock);
+    acquire(&e1000->rx_lock);
+    if(value > NIC_DEF_MTU)
+      e1000->rctl |= E1000_RCTL_LPE;
+    else
+      e1000->rctl &= ~E1000_RCTL_LPE;
+    e1000_reg_write(E1000_RCTL, e1000->rctl, e1000);
+    release(&e1000->rx_lock);
+    return 0;
+  }
+
+  if(param == NICCTL_LOOPBACK) {
+    if(value > 1)
+      return -1;
+    return e1000_set_loopback(e1000, value);
+  }
+
+  if(param == NICCTL_COPYBREAK) {
+    //0 turns copying off, the small buffers bound it from above
+    if(value > E1000_RX_SMALL_BUFSIZE)
+      return -1;
+    e1000->rx_copybreak = value;
+    return 0;
+  }
+
+  switch(param) {
+  case NICCTL_ITR:  reg = E1000_ITR;  field = &e1000->itr; break;
+  case NICCTL_RDTR: reg = E1000_RDTR; field = &e1000->rdtr; break;
+  case NICCTL_RADV: reg = E1000_RADV; field = &e1000->radv; break;
+  case NICCTL_TIDV: reg = E1000_TIDV; field = &e1000->tidv; break;
+  case NICCTL_TADV: reg = E1000_TADV; field = &e1000->tadv; break;
+  default:
+    return -1;
+  }
+  //the moderation intervals are all 16 bits wide
+  if(value > 0xffff)
+    return -1;
+  *field = value;
+  e1000_reg_write(reg, value, e1000);
+  return 0;
+}
+
+static int e1000_addr_find(struct e1000_addr_list *l, uint8_t *addr) {
+  for(int i = 0; i < l->n; i++)
+    if(memcmp(l->addr[i], addr, 6) == 0)
+      return i;
+  return -1;
+}
+
+/**
+ * Let frames to addr in. Multicast addresses (group bit set) go to the
+ * MTA, unicast ones to a receive address entry. Adding an address
+ * already in the filter is a no-op.
+ */
+int e1000_add_addr(void *driver, uint8_t *addr) {
+  struct e1000 *e1000 = (struct e1000*)driver;
+  struct e1000_addr_list *l = (addr[0] & 1) ? &e1000->mc : &e1000->uc;
+
+  if(!(addr[0] & 1) && memcmp(addr, e1000->mac_addr, 6) == 0)
+    return 0;
+  acquire(&e1000->rx_lock);
+  if(e1000_addr_find(l, addr) < 0) {
+    if(l->n < E1000_ADDR_MAX)
+      memmove(l->addr[l->n++], addr, 6);
+    else
+      l->overflow++;
+    e1000_sync_filters(e1000);
+  }
+  release(&e1000->rx_lock);
+  return 0;
+}
+
+// Undo e1000_add_addr(). Returns -1 if addr was never added.
+int e1000_del_addr(void *driver, uint8_t *addr) {
+  struct e1000 *e1000 = (struct e1000*)driver;
+  struct e1000_addr_list *l = (addr[0] & 1) ? &e1000->mc : &e1000->uc;
+  int i, r = 0;
+
+  if(!(addr[0] & 1) && memcmp(addr, e1000->mac_addr, 6) == 0)
+    return -1;
+  acquire(&e1000->rx_lock);
+  if((i = e1000_addr_find(l, addr)) >= 0) {
+    l->n--;
+    memmove(l->addr[i], l->addr[l->n], 6);
+  } else if(l->overflow > 0) {
+    //one of the addresses we could not keep track of
+    l->overflow--;
+  } else {
+    r = -1;
+  }
+  if(r == 0)
+    e1000_sync_filters(e1000);
+  release(&e1000->rx_lock);
+  return r;
+}
+
+//Statistics register behind each NICSTAT_* counter
+static const struct {
+  uint32_t reg;
+  uint8_t wide;   //64-bit, low half at reg
+} e1000_stat_regs[NICSTAT_COUNT] = {
+  [NICSTAT_RX_PACKETS]      = { E1000_GPRC, 0 },
+  [NICSTAT_RX_BYTES]        = { E1000_GORCL, 1 },
+  [NICSTAT_RX_BROADCAST]    = { E1000_BPRC, 0 },
+  [NICSTAT_RX_MULTICAST]    = { E1000_MPRC, 0 },
+  [NICSTAT_RX_TOTAL]        = { E1000_TPR, 0 },
+  [NICSTAT_RX_MISSED]       = { E1000_MPC, 0 },
+  [NICSTAT_RX_NO_BUFFER]    = { E1000_RNBC, 0 },
+  [NICSTAT_RX_CRC_ERRORS]   = { E1000_CRCERRS, 0 },
+  [NICSTAT_RX_ALIGN_ERRORS] = { E1000_ALGNERRC, 0 },
+  [NICSTAT_RX_SYMBOL_ERRORS] = { E1000_SYMERRS, 0 },
+  [NICSTAT_RX_ERRORS]       = { E1000_RXERRC, 0 },
+  [NICSTAT_RX_LENGTH_ERRORS] = { E1000_RLEC, 0 },
+  [NICSTAT_RX_UNDERSIZE]    = { E1000_RUC, 0 },
+  [NICSTAT_RX_FRAGMENTS]    = { E1000_RFC, 0 },
+  [NICSTAT_RX_OVERSIZE]     = { E1000_ROC, 0 },
+  [NICSTAT_RX_JABBER]       = { E1000_RJC, 0 },
+  [NICSTAT_RX_XON]          = { E1000_XONRXC, 0 },
+  [NICSTAT_RX_XOFF]         = { E1000_XOFFRXC, 0 },
+  [NICSTAT_TX_PACKETS]      = { E1000_GPTC, 0 },
+  [NICSTAT_TX_BYTES]        = { E1000_GOTCL, 1 },
+  [NICSTAT_TX_BROADCAST]    = { E1000_BPTC, 0 },
+  [NICSTAT_TX_MULTICAST]    = { E1000_MPTC, 0 },
+  [NICSTAT_TX_TOTAL]        = { E1000_TPT, 0 },
+  [NICSTAT_TX_TSO]          = { E1000_TSCTC, 0 },
+  [NICSTAT_TX_TSO_FAILED]   = { E1000_TSCTFC, 0 },
+  [NICSTAT_TX_XON]          = { E1000_XONTXC, 0 },
+  [NICSTAT_TX_XOFF]         = { E1000_XOFFTXC, 0 },
+  [NICSTAT_COLLISIONS]      = { E1000_COLC, 0 },
+  [NICSTAT_SINGLE_COLL]     = { E1000_SCC, 0 },
+  [NICSTAT_MULTI_COLL]      = { E1000_MCC, 0 },
+  [NICSTAT_LATE_COLL]       = { E1000_LATECOL, 0 },
+  [NICSTAT_EXCESS_COLL]     = { E1000_ECOL, 0 },
+  [NICSTAT_DEFERRED]        = { E1000_DC, 0 },
+  [NICSTAT_NO_CRS]          = { E1000_TNCRS, 0 },
+};
+
+/**
+ * Fold the clear-on-read hardware counters into the 64-bit software
+ * ones. Called often enough (see nic_tick()) that the 32-bit registers
+ * can't wrap in between.
+ */
+void e1000_update_stats(void *driver) {
+  struct e1000 *e1000 = (struct e1000*)driver;
+
+  acquire(&e1000->stats_lock);
+  for(int i = 0; i < NICSTAT_COUNT; i++) {
+    uint32_t reg = e1000_stat_regs[i].reg;
+    uint64_t v = e1000_reg_read(reg, e1000);
+    if(e1000_stat_regs[i].wide)
+      v |= (uint64_t)e1000_reg_read(reg + 4, e1000) << 32;
+    e1000->stats[i] += v;
+  }
+  release(&e1000->stats_lock);
+}
+
+// Copy out up to n counters, freshly updated. Returns how many.
+int e1000_get_stats(void *driver, uint64_t *stats, int n) {
+  struct e1000 *e1000 = (struct e1000*)driver;
+
+  if(n > NICSTAT_COUNT)
+    n = NICSTAT_COUNT;
+  e1000_update_stats(driver);
+  acquire(&e1000->stats_lock);
+  memmove(stats, e1000->stats, n * sizeof(uint64_t));
+  release(&e1000->stats_lock);
+  return n;
 }
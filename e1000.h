@@ -14,7 +14,24 @@ struct e1000;
 
 int e1000_init(struct pci_func *pcif, void **driver, uint8_t *mac_addr);
 
-void e1000_send(void *e1000, uint8_t* pkt, uint16_t length);
-void e1000_recv(void *e1000, uint8_t* pkt, uint16_t length);
+int e1000_send(void *e1000, uint8_t* pkt, uint16_t length);
+int e1000_send_batch(void *e1000, uint8_t** pkts, uint16_t* lengths, int n);
+int e1000_send_zc(void *e1000, uint8_t* pkt, uint16_t length,
+                  void (*done)(void *arg), void *arg);
+int e1000_send_csum(void *e1000, uint8_t* pkt, uint16_t length, struct nic_txcsum *csum);
+int e1000_send_tso(void *e1000, uint8_t* hdr, uint16_t hdrlen,
+                   uint8_t* payload, uint32_t paylen, struct nic_tso *tso,
+                   void (*done)(void *arg), void *arg);
+int e1000_send_sg(void *e1000, struct nic_frag *frags, int nfrags,
+                  void (*done)(void *arg), void *arg);
+int e1000_recv(struct nic_device *nd, int budget);
+int e1000_add_addr(void *e1000, uint8_t *addr);
+int e1000_del_addr(void *e1000, uint8_t *addr);
+void e1000_update_stats(void *e1000);
+int e1000_get_stats(void *e1000, uint64_t *stats, int n);
+int e1000_get_param(void *e1000, int param, uint32_t *value);
+int e1000_set_param(void *e1000, int param, uint32_t value);
+void e1000_intr(struct nic_device *nd);
+void e1000_enable_intr(struct nic_device *nd);
 
 #endif
@@ -0,0 +1,1726 @@
+
+_grep:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 18             	sub    $0x18,%esp
+  14:	8b 01                	mov    (%ecx),%eax
+  16:	8b 59 04             	mov    0x4(%ecx),%ebx
+  19:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  int fd, i;
+  char *pattern;
+
+  if(argc <= 1){
+  1c:	83 f8 01             	cmp    $0x1,%eax
+  1f:	7e 6f                	jle    90 <main+0x90>
+    printf(2, "usage: grep pattern [file ...]\n");
+    exit();
+  }
+  pattern = argv[1];
+  21:	8b 43 04             	mov    0x4(%ebx),%eax
+  24:	83 c3 08             	add    $0x8,%ebx
+
+  if(argc <= 2){
+  27:	83 7d e4 02          	cmpl   $0x2,-0x1c(%ebp)
+    grep(pattern, 0);
+    exit();
+  }
+
+  for(i = 2; i < argc; i++){
+  2b:	be 02 00 00 00       	mov    $0x2,%esi
+  pattern = argv[1];
+  30:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  if(argc <= 2){
+  33:	75 2d                	jne    62 <main+0x62>
+  35:	eb 6c                	jmp    a3 <main+0xa3>
+  37:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  3e:	66 90                	xchg   %ax,%ax
+    if((fd = open(argv[i], 0)) < 0){
+      printf(1, "grep: cannot open %s\n", argv[i]);
+      exit();
+    }
+    grep(pattern, fd);
+  40:	83 ec 08             	sub    $0x8,%esp
+  for(i = 2; i < argc; i++){
+  43:	83 c6 01             	add    $0x1,%esi
+  46:	83 c3 04             	add    $0x4,%ebx
+    grep(pattern, fd);
+  49:	50                   	push   %eax
+  4a:	ff 75 e0             	push   -0x20(%ebp)
+  4d:	e8 9e 01 00 00       	call   1f0 <grep>
+    close(fd);
+  52:	89 3c 24             	mov    %edi,(%esp)
+  55:	e8 2a 06 00 00       	call   684 <close>
+  for(i = 2; i < argc; i++){
+  5a:	83 c4 10             	add    $0x10,%esp
+  5d:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  60:	7e 29                	jle    8b <main+0x8b>
+    if((fd = open(argv[i], 0)) < 0){
+  62:	83 ec 08             	sub    $0x8,%esp
+  65:	6a 00                	push   $0x0
+  67:	ff 33                	push   (%ebx)
+  69:	e8 2e 06 00 00       	call   69c <open>
+  6e:	83 c4 10             	add    $0x10,%esp
+  71:	89 c7                	mov    %eax,%edi
+  73:	85 c0                	test   %eax,%eax
+  75:	79 c9                	jns    40 <main+0x40>
+      printf(1, "grep: cannot open %s\n", argv[i]);
+  77:	50                   	push   %eax
+  78:	ff 33                	push   (%ebx)
+  7a:	68 58 0b 00 00       	push   $0xb58
+  7f:	6a 01                	push   $0x1
+  81:	e8 8a 07 00 00       	call   810 <printf>
+      exit();
+  86:	e8 d1 05 00 00       	call   65c <exit>
+  }
+  exit();
+  8b:	e8 cc 05 00 00       	call   65c <exit>
+    printf(2, "usage: grep pattern [file ...]\n");
+  90:	51                   	push   %ecx
+  91:	51                   	push   %ecx
+  92:	68 38 0b 00 00       	push   $0xb38
+  97:	6a 02                	push   $0x2
+  99:	e8 72 07 00 00       	call   810 <printf>
+    exit();
+  9e:	e8 b9 05 00 00       	call   65c <exit>
+    grep(pattern, 0);
+  a3:	52                   	push   %edx
+  a4:	52                   	push   %edx
+  a5:	6a 00                	push   $0x0
+  a7:	50                   	push   %eax
+  a8:	e8 43 01 00 00       	call   1f0 <grep>
+    exit();
+  ad:	e8 aa 05 00 00       	call   65c <exit>
+  b2:	66 90                	xchg   %ax,%ax
+  b4:	66 90                	xchg   %ax,%ax
+  b6:	66 90                	xchg   %ax,%ax
+  b8:	66 90                	xchg   %ax,%ax
+  ba:	66 90                	xchg   %ax,%ax
+  bc:	66 90                	xchg   %ax,%ax
+  be:	66 90                	xchg   %ax,%ax
+
+000000c0 <matchhere>:
+  return 0;
+}
+
+// matchhere: search for re at beginning of text
+int matchhere(char *re, char *text)
+{
+  c0:	55                   	push   %ebp
+  c1:	89 e5                	mov    %esp,%ebp
+  c3:	57                   	push   %edi
+  c4:	56                   	push   %esi
+  c5:	53                   	push   %ebx
+  c6:	83 ec 0c             	sub    $0xc,%esp
+  c9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  cc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(re[0] == '\0')
+  cf:	0f b6 0f             	movzbl (%edi),%ecx
+  d2:	84 c9                	test   %cl,%cl
+  d4:	0f 84 96 00 00 00    	je     170 <matchhere+0xb0>
+    return 1;
+  if(re[1] == '*')
+  da:	0f b6 47 01          	movzbl 0x1(%edi),%eax
+  de:	3c 2a                	cmp    $0x2a,%al
+  e0:	74 2d                	je     10f <matchhere+0x4f>
+  e2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return matchstar(re[0], re+2, text);
+  if(re[0] == '$' && re[1] == '\0')
+    return *text == '\0';
+  e8:	0f b6 33             	movzbl (%ebx),%esi
+  if(re[0] == '$' && re[1] == '\0')
+  eb:	80 f9 24             	cmp    $0x24,%cl
+  ee:	74 50                	je     140 <matchhere+0x80>
+  if(*text!='\0' && (re[0]=='.' || re[0]==*text))
+  f0:	89 f2                	mov    %esi,%edx
+  f2:	84 d2                	test   %dl,%dl
+  f4:	74 6e                	je     164 <matchhere+0xa4>
+  f6:	80 f9 2e             	cmp    $0x2e,%cl
+  f9:	75 65                	jne    160 <matchhere+0xa0>
+    return matchhere(re+1, text+1);
+  fb:	83 c3 01             	add    $0x1,%ebx
+  fe:	83 c7 01             	add    $0x1,%edi
+  if(re[0] == '\0')
+ 101:	84 c0                	test   %al,%al
+ 103:	74 6b                	je     170 <matchhere+0xb0>
+ 105:	89 c1                	mov    %eax,%ecx
+  if(re[1] == '*')
+ 107:	0f b6 47 01          	movzbl 0x1(%edi),%eax
+ 10b:	3c 2a                	cmp    $0x2a,%al
+ 10d:	75 d9                	jne    e8 <matchhere+0x28>
+    return matchstar(re[0], re+2, text);
+ 10f:	8d 77 02             	lea    0x2(%edi),%esi
+ 112:	0f be f9             	movsbl %cl,%edi
+  return 0;
+}
+
+// matchstar: search for c*re at beginning of text
+int matchstar(int c, char *re, char *text)
+ 115:	8d 76 00             	lea    0x0(%esi),%esi
+{
+  do{  // a * matches zero or more instances
+    if(matchhere(re, text))
+ 118:	83 ec 08             	sub    $0x8,%esp
+ 11b:	53                   	push   %ebx
+ 11c:	56                   	push   %esi
+ 11d:	e8 9e ff ff ff       	call   c0 <matchhere>
+ 122:	83 c4 10             	add    $0x10,%esp
+ 125:	85 c0                	test   %eax,%eax
+ 127:	75 47                	jne    170 <matchhere+0xb0>
+      return 1;
+  }while(*text!='\0' && (*text++==c || c=='.'));
+ 129:	0f be 13             	movsbl (%ebx),%edx
+ 12c:	84 d2                	test   %dl,%dl
+ 12e:	74 45                	je     175 <matchhere+0xb5>
+ 130:	83 c3 01             	add    $0x1,%ebx
+ 133:	39 fa                	cmp    %edi,%edx
+ 135:	74 e1                	je     118 <matchhere+0x58>
+ 137:	83 ff 2e             	cmp    $0x2e,%edi
+ 13a:	74 dc                	je     118 <matchhere+0x58>
+ 13c:	eb 37                	jmp    175 <matchhere+0xb5>
+ 13e:	66 90                	xchg   %ax,%ax
+  if(re[0] == '$' && re[1] == '\0')
+ 140:	84 c0                	test   %al,%al
+ 142:	74 39                	je     17d <matchhere+0xbd>
+  if(*text!='\0' && (re[0]=='.' || re[0]==*text))
+ 144:	89 f2                	mov    %esi,%edx
+ 146:	84 d2                	test   %dl,%dl
+ 148:	74 1a                	je     164 <matchhere+0xa4>
+ 14a:	80 fa 24             	cmp    $0x24,%dl
+ 14d:	75 15                	jne    164 <matchhere+0xa4>
+    return matchhere(re+1, text+1);
+ 14f:	83 c3 01             	add    $0x1,%ebx
+ 152:	83 c7 01             	add    $0x1,%edi
+  if(re[0] == '\0')
+ 155:	89 c1                	mov    %eax,%ecx
+ 157:	eb ae                	jmp    107 <matchhere+0x47>
+ 159:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(*text!='\0' && (re[0]=='.' || re[0]==*text))
+ 160:	38 ca                	cmp    %cl,%dl
+ 162:	74 97                	je     fb <matchhere+0x3b>
+}
+ 164:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+ 167:	31 c0                	xor    %eax,%eax
+}
+ 169:	5b                   	pop    %ebx
+ 16a:	5e                   	pop    %esi
+ 16b:	5f                   	pop    %edi
+ 16c:	5d                   	pop    %ebp
+ 16d:	c3                   	ret
+ 16e:	66 90                	xchg   %ax,%ax
+    return 1;
+ 170:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+ 175:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 178:	5b                   	pop    %ebx
+ 179:	5e                   	pop    %esi
+ 17a:	5f                   	pop    %edi
+ 17b:	5d                   	pop    %ebp
+ 17c:	c3                   	ret
+    return *text == '\0';
+ 17d:	89 f0                	mov    %esi,%eax
+ 17f:	84 c0                	test   %al,%al
+ 181:	0f 94 c0             	sete   %al
+ 184:	0f b6 c0             	movzbl %al,%eax
+ 187:	eb ec                	jmp    175 <matchhere+0xb5>
+ 189:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000190 <match>:
+{
+ 190:	55                   	push   %ebp
+ 191:	89 e5                	mov    %esp,%ebp
+ 193:	56                   	push   %esi
+ 194:	53                   	push   %ebx
+ 195:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 198:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(re[0] == '^')
+ 19b:	80 3b 5e             	cmpb   $0x5e,(%ebx)
+ 19e:	75 11                	jne    1b1 <match+0x21>
+ 1a0:	eb 2e                	jmp    1d0 <match+0x40>
+ 1a2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  }while(*text++ != '\0');
+ 1a8:	83 c6 01             	add    $0x1,%esi
+ 1ab:	80 7e ff 00          	cmpb   $0x0,-0x1(%esi)
+ 1af:	74 16                	je     1c7 <match+0x37>
+    if(matchhere(re, text))
+ 1b1:	83 ec 08             	sub    $0x8,%esp
+ 1b4:	56                   	push   %esi
+ 1b5:	53                   	push   %ebx
+ 1b6:	e8 05 ff ff ff       	call   c0 <matchhere>
+ 1bb:	83 c4 10             	add    $0x10,%esp
+ 1be:	85 c0                	test   %eax,%eax
+ 1c0:	74 e6                	je     1a8 <match+0x18>
+      return 1;
+ 1c2:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+ 1c7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 1ca:	5b                   	pop    %ebx
+ 1cb:	5e                   	pop    %esi
+ 1cc:	5d                   	pop    %ebp
+ 1cd:	c3                   	ret
+ 1ce:	66 90                	xchg   %ax,%ax
+    return matchhere(re+1, text);
+ 1d0:	83 c3 01             	add    $0x1,%ebx
+ 1d3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 1d6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 1d9:	5b                   	pop    %ebx
+ 1da:	5e                   	pop    %esi
+ 1db:	5d                   	pop    %ebp
+    return matchhere(re+1, text);
+ 1dc:	e9 df fe ff ff       	jmp    c0 <matchhere>
+ 1e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ef:	90                   	nop
+
+000001f0 <grep>:
+{
+ 1f0:	55                   	push   %ebp
+ 1f1:	89 e5                	mov    %esp,%ebp
+ 1f3:	57                   	push   %edi
+  m = 0;
+ 1f4:	31 ff                	xor    %edi,%edi
+{
+ 1f6:	56                   	push   %esi
+ 1f7:	53                   	push   %ebx
+ 1f8:	83 ec 1c             	sub    $0x1c,%esp
+ 1fb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 1fe:	89 7d e0             	mov    %edi,-0x20(%ebp)
+    return matchhere(re+1, text);
+ 201:	8d 43 01             	lea    0x1(%ebx),%eax
+ 204:	89 45 dc             	mov    %eax,-0x24(%ebp)
+ 207:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 20e:	66 90                	xchg   %ax,%ax
+  while((n = read(fd, buf+m, sizeof(buf)-m-1)) > 0){
+ 210:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+ 213:	b8 ff 03 00 00       	mov    $0x3ff,%eax
+ 218:	83 ec 04             	sub    $0x4,%esp
+ 21b:	29 c8                	sub    %ecx,%eax
+ 21d:	50                   	push   %eax
+ 21e:	8d 81 a0 0f 00 00    	lea    0xfa0(%ecx),%eax
+ 224:	50                   	push   %eax
+ 225:	ff 75 0c             	push   0xc(%ebp)
+ 228:	e8 47 04 00 00       	call   674 <read>
+ 22d:	83 c4 10             	add    $0x10,%esp
+ 230:	85 c0                	test   %eax,%eax
+ 232:	0f 8e fd 00 00 00    	jle    335 <grep+0x145>
+    m += n;
+ 238:	01 45 e0             	add    %eax,-0x20(%ebp)
+ 23b:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    buf[m] = '\0';
+ 23e:	bf a0 0f 00 00       	mov    $0xfa0,%edi
+ 243:	89 de                	mov    %ebx,%esi
+ 245:	c6 81 a0 0f 00 00 00 	movb   $0x0,0xfa0(%ecx)
+    while((q = strchr(p, '\n')) != 0){
+ 24c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 250:	83 ec 08             	sub    $0x8,%esp
+ 253:	6a 0a                	push   $0xa
+ 255:	57                   	push   %edi
+ 256:	e8 c5 01 00 00       	call   420 <strchr>
+ 25b:	83 c4 10             	add    $0x10,%esp
+ 25e:	89 c2                	mov    %eax,%edx
+ 260:	85 c0                	test   %eax,%eax
+ 262:	0f 84 88 00 00 00    	je     2f0 <grep+0x100>
+      *q = 0;
+ 268:	c6 02 00             	movb   $0x0,(%edx)
+  if(re[0] == '^')
+ 26b:	80 3e 5e             	cmpb   $0x5e,(%esi)
+ 26e:	74 58                	je     2c8 <grep+0xd8>
+ 270:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 273:	89 d3                	mov    %edx,%ebx
+ 275:	eb 12                	jmp    289 <grep+0x99>
+ 277:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 27e:	66 90                	xchg   %ax,%ax
+  }while(*text++ != '\0');
+ 280:	83 c7 01             	add    $0x1,%edi
+ 283:	80 7f ff 00          	cmpb   $0x0,-0x1(%edi)
+ 287:	74 37                	je     2c0 <grep+0xd0>
+    if(matchhere(re, text))
+ 289:	83 ec 08             	sub    $0x8,%esp
+ 28c:	57                   	push   %edi
+ 28d:	56                   	push   %esi
+ 28e:	e8 2d fe ff ff       	call   c0 <matchhere>
+ 293:	83 c4 10             	add    $0x10,%esp
+ 296:	85 c0                	test   %eax,%eax
+ 298:	74 e6                	je     280 <grep+0x90>
+        write(1, p, q+1 - p);
+ 29a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 29d:	89 da                	mov    %ebx,%edx
+ 29f:	8d 5b 01             	lea    0x1(%ebx),%ebx
+ 2a2:	89 d8                	mov    %ebx,%eax
+ 2a4:	83 ec 04             	sub    $0x4,%esp
+        *q = '\n';
+ 2a7:	c6 02 0a             	movb   $0xa,(%edx)
+        write(1, p, q+1 - p);
+ 2aa:	29 f8                	sub    %edi,%eax
+ 2ac:	50                   	push   %eax
+ 2ad:	57                   	push   %edi
+ 2ae:	89 df                	mov    %ebx,%edi
+ 2b0:	6a 01                	push   $0x1
+ 2b2:	e8 c5 03 00 00       	call   67c <write>
+ 2b7:	83 c4 10             	add    $0x10,%esp
+ 2ba:	eb 94                	jmp    250 <grep+0x60>
+ 2bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2c0:	8d 7b 01             	lea    0x1(%ebx),%edi
+      p = q+1;
+ 2c3:	eb 8b                	jmp    250 <grep+0x60>
+ 2c5:	8d 76 00             	lea    0x0(%esi),%esi
+    return matchhere(re+1, text);
+ 2c8:	83 ec 08             	sub    $0x8,%esp
+ 2cb:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+ 2ce:	57                   	push   %edi
+ 2cf:	ff 75 dc             	push   -0x24(%ebp)
+ 2d2:	e8 e9 fd ff ff       	call   c0 <matchhere>
+        write(1, p, q+1 - p);
+ 2d7:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    return matchhere(re+1, text);
+ 2da:	83 c4 10             	add    $0x10,%esp
+        write(1, p, q+1 - p);
+ 2dd:	8d 5a 01             	lea    0x1(%edx),%ebx
+      if(match(pattern, p)){
+ 2e0:	85 c0                	test   %eax,%eax
+ 2e2:	75 be                	jne    2a2 <grep+0xb2>
+        write(1, p, q+1 - p);
+ 2e4:	89 df                	mov    %ebx,%edi
+ 2e6:	e9 65 ff ff ff       	jmp    250 <grep+0x60>
+ 2eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2ef:	90                   	nop
+    if(p == buf)
+ 2f0:	89 f3                	mov    %esi,%ebx
+ 2f2:	81 ff a0 0f 00 00    	cmp    $0xfa0,%edi
+ 2f8:	74 2f                	je     329 <grep+0x139>
+    if(m > 0){
+ 2fa:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 2fd:	85 c0                	test   %eax,%eax
+ 2ff:	0f 8e 0b ff ff ff    	jle    210 <grep+0x20>
+      m -= p - buf;
+ 305:	89 f8                	mov    %edi,%eax
+      memmove(buf, p, m);
+ 307:	83 ec 04             	sub    $0x4,%esp
+      m -= p - buf;
+ 30a:	2d a0 0f 00 00       	sub    $0xfa0,%eax
+ 30f:	29 45 e0             	sub    %eax,-0x20(%ebp)
+ 312:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+      memmove(buf, p, m);
+ 315:	51                   	push   %ecx
+ 316:	57                   	push   %edi
+ 317:	68 a0 0f 00 00       	push   $0xfa0
+ 31c:	e8 ef 01 00 00       	call   510 <memmove>
+ 321:	83 c4 10             	add    $0x10,%esp
+ 324:	e9 e7 fe ff ff       	jmp    210 <grep+0x20>
+      m = 0;
+ 329:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+ 330:	e9 db fe ff ff       	jmp    210 <grep+0x20>
+}
+ 335:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 338:	5b                   	pop    %ebx
+ 339:	5e                   	pop    %esi
+ 33a:	5f                   	pop    %edi
+ 33b:	5d                   	pop    %ebp
+ 33c:	c3                   	ret
+ 33d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000340 <matchstar>:
+{
+ 340:	55                   	push   %ebp
+ 341:	89 e5                	mov    %esp,%ebp
+ 343:	57                   	push   %edi
+ 344:	56                   	push   %esi
+ 345:	53                   	push   %ebx
+ 346:	83 ec 0c             	sub    $0xc,%esp
+ 349:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 34c:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 34f:	8b 7d 10             	mov    0x10(%ebp),%edi
+ 352:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(matchhere(re, text))
+ 358:	83 ec 08             	sub    $0x8,%esp
+ 35b:	57                   	push   %edi
+ 35c:	56                   	push   %esi
+ 35d:	e8 5e fd ff ff       	call   c0 <matchhere>
+ 362:	83 c4 10             	add    $0x10,%esp
+ 365:	85 c0                	test   %eax,%eax
+ 367:	75 1f                	jne    388 <matchstar+0x48>
+  }while(*text!='\0' && (*text++==c || c=='.'));
+ 369:	0f be 17             	movsbl (%edi),%edx
+ 36c:	84 d2                	test   %dl,%dl
+ 36e:	74 0c                	je     37c <matchstar+0x3c>
+ 370:	83 c7 01             	add    $0x1,%edi
+ 373:	39 da                	cmp    %ebx,%edx
+ 375:	74 e1                	je     358 <matchstar+0x18>
+ 377:	83 fb 2e             	cmp    $0x2e,%ebx
+ 37a:	74 dc                	je     358 <matchstar+0x18>
+}
+ 37c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 37f:	5b                   	pop    %ebx
+ 380:	5e                   	pop    %esi
+ 381:	5f                   	pop    %edi
+ 382:	5d                   	pop    %ebp
+ 383:	c3                   	ret
+ 384:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 388:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return 1;
+ 38b:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+ 390:	5b                   	pop    %ebx
+ 391:	5e                   	pop    %esi
+ 392:	5f                   	pop    %edi
+ 393:	5d                   	pop    %ebp
+ 394:	c3                   	ret
+ 395:	66 90                	xchg   %ax,%ax
+ 397:	66 90                	xchg   %ax,%ax
+ 399:	66 90                	xchg   %ax,%ax
+ 39b:	66 90                	xchg   %ax,%ax
+ 39d:	66 90                	xchg   %ax,%ax
+ 39f:	90                   	nop
+
+000003a0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 3a0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 3a1:	31 c0                	xor    %eax,%eax
+{
+ 3a3:	89 e5                	mov    %esp,%ebp
+ 3a5:	53                   	push   %ebx
+ 3a6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 3a9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 3ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 3b0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 3b4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 3b7:	83 c0 01             	add    $0x1,%eax
+ 3ba:	84 d2                	test   %dl,%dl
+ 3bc:	75 f2                	jne    3b0 <strcpy+0x10>
+    ;
+  return os;
+}
+ 3be:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3c1:	89 c8                	mov    %ecx,%eax
+ 3c3:	c9                   	leave
+ 3c4:	c3                   	ret
+ 3c5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003d0 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 3d0:	55                   	push   %ebp
+ 3d1:	89 e5                	mov    %esp,%ebp
+ 3d3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 3d6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 3d9:	74 15                	je     3f0 <strlen+0x20>
+ 3db:	31 c0                	xor    %eax,%eax
+ 3dd:	8d 76 00             	lea    0x0(%esi),%esi
+ 3e0:	83 c0 01             	add    $0x1,%eax
+ 3e3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 3e7:	89 c1                	mov    %eax,%ecx
+ 3e9:	75 f5                	jne    3e0 <strlen+0x10>
+    ;
+  return n;
+}
+ 3eb:	89 c8                	mov    %ecx,%eax
+ 3ed:	5d                   	pop    %ebp
+ 3ee:	c3                   	ret
+ 3ef:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 3f0:	31 c9                	xor    %ecx,%ecx
+}
+ 3f2:	5d                   	pop    %ebp
+ 3f3:	89 c8                	mov    %ecx,%eax
+ 3f5:	c3                   	ret
+ 3f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000400 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 400:	55                   	push   %ebp
+ 401:	89 e5                	mov    %esp,%ebp
+ 403:	57                   	push   %edi
+ 404:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 407:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 40a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 40d:	89 d7                	mov    %edx,%edi
+ 40f:	fc                   	cld
+ 410:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 412:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 415:	89 d0                	mov    %edx,%eax
+ 417:	c9                   	leave
+ 418:	c3                   	ret
+ 419:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000420 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 420:	55                   	push   %ebp
+ 421:	89 e5                	mov    %esp,%ebp
+ 423:	8b 45 08             	mov    0x8(%ebp),%eax
+ 426:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 42a:	0f b6 10             	movzbl (%eax),%edx
+ 42d:	84 d2                	test   %dl,%dl
+ 42f:	75 12                	jne    443 <strchr+0x23>
+ 431:	eb 1d                	jmp    450 <strchr+0x30>
+ 433:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 437:	90                   	nop
+ 438:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 43c:	83 c0 01             	add    $0x1,%eax
+ 43f:	84 d2                	test   %dl,%dl
+ 441:	74 0d                	je     450 <strchr+0x30>
+    if(*s == c)
+ 443:	38 d1                	cmp    %dl,%cl
+ 445:	75 f1                	jne    438 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 447:	5d                   	pop    %ebp
+ 448:	c3                   	ret
+ 449:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 450:	31 c0                	xor    %eax,%eax
+}
+ 452:	5d                   	pop    %ebp
+ 453:	c3                   	ret
+ 454:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 45b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 45f:	90                   	nop
+
+00000460 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 460:	55                   	push   %ebp
+ 461:	89 e5                	mov    %esp,%ebp
+ 463:	57                   	push   %edi
+ 464:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 465:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 468:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 469:	31 db                	xor    %ebx,%ebx
+{
+ 46b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 46e:	eb 27                	jmp    497 <gets+0x37>
+    cc = read(0, &c, 1);
+ 470:	83 ec 04             	sub    $0x4,%esp
+ 473:	6a 01                	push   $0x1
+ 475:	56                   	push   %esi
+ 476:	6a 00                	push   $0x0
+ 478:	e8 f7 01 00 00       	call   674 <read>
+    if(cc < 1)
+ 47d:	83 c4 10             	add    $0x10,%esp
+ 480:	85 c0                	test   %eax,%eax
+ 482:	7e 1d                	jle    4a1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 484:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 488:	8b 55 08             	mov    0x8(%ebp),%edx
+ 48b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 48f:	3c 0a                	cmp    $0xa,%al
+ 491:	74 10                	je     4a3 <gets+0x43>
+ 493:	3c 0d                	cmp    $0xd,%al
+ 495:	74 0c                	je     4a3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 497:	89 df                	mov    %ebx,%edi
+ 499:	83 c3 01             	add    $0x1,%ebx
+ 49c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 49f:	7c cf                	jl     470 <gets+0x10>
+ 4a1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 4a3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4a6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 4aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 4ad:	5b                   	pop    %ebx
+ 4ae:	5e                   	pop    %esi
+ 4af:	5f                   	pop    %edi
+ 4b0:	5d                   	pop    %ebp
+ 4b1:	c3                   	ret
+ 4b2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000004c0 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 4c0:	55                   	push   %ebp
+ 4c1:	89 e5                	mov    %esp,%ebp
+ 4c3:	56                   	push   %esi
+ 4c4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 4c5:	83 ec 08             	sub    $0x8,%esp
+ 4c8:	6a 00                	push   $0x0
+ 4ca:	ff 75 08             	push   0x8(%ebp)
+ 4cd:	e8 ca 01 00 00       	call   69c <open>
+  if(fd < 0)
+ 4d2:	83 c4 10             	add    $0x10,%esp
+ 4d5:	85 c0                	test   %eax,%eax
+ 4d7:	78 27                	js     500 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 4d9:	83 ec 08             	sub    $0x8,%esp
+ 4dc:	ff 75 0c             	push   0xc(%ebp)
+ 4df:	89 c3                	mov    %eax,%ebx
+ 4e1:	50                   	push   %eax
+ 4e2:	e8 cd 01 00 00       	call   6b4 <fstat>
+  close(fd);
+ 4e7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 4ea:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 4ec:	e8 93 01 00 00       	call   684 <close>
+  return r;
+ 4f1:	83 c4 10             	add    $0x10,%esp
+}
+ 4f4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 4f7:	89 f0                	mov    %esi,%eax
+ 4f9:	5b                   	pop    %ebx
+ 4fa:	5e                   	pop    %esi
+ 4fb:	5d                   	pop    %ebp
+ 4fc:	c3                   	ret
+ 4fd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 500:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 505:	eb ed                	jmp    4f4 <stat+0x34>
+ 507:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 50e:	66 90                	xchg   %ax,%ax
+
+00000510 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 510:	55                   	push   %ebp
+ 511:	89 e5                	mov    %esp,%ebp
+ 513:	57                   	push   %edi
+ 514:	56                   	push   %esi
+ 515:	8b 45 10             	mov    0x10(%ebp),%eax
+ 518:	8b 55 08             	mov    0x8(%ebp),%edx
+ 51b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 51e:	85 c0                	test   %eax,%eax
+ 520:	7e 13                	jle    535 <memmove+0x25>
+ 522:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 524:	89 d7                	mov    %edx,%edi
+ 526:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 52d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 530:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 531:	39 f8                	cmp    %edi,%eax
+ 533:	75 fb                	jne    530 <memmove+0x20>
+  return vdst;
+}
+ 535:	5e                   	pop    %esi
+ 536:	89 d0                	mov    %edx,%eax
+ 538:	5f                   	pop    %edi
+ 539:	5d                   	pop    %ebp
+ 53a:	c3                   	ret
+ 53b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 53f:	90                   	nop
+
+00000540 <parseip>:
+
+// a.b.c.d to network byte order. -1 if malformed
+int
+parseip(char *s, uint *addr)
+{
+ 540:	55                   	push   %ebp
+ 541:	89 e5                	mov    %esp,%ebp
+ 543:	57                   	push   %edi
+  uint8_t *b = (uint8_t*)addr;
+  int v;
+
+  for(int i = 0; i < 4; i++) {
+ 544:	31 ff                	xor    %edi,%edi
+{
+ 546:	56                   	push   %esi
+ 547:	53                   	push   %ebx
+ 548:	8b 55 08             	mov    0x8(%ebp),%edx
+    if(*s < '0' || *s > '9')
+ 54b:	0f be 02             	movsbl (%edx),%eax
+ 54e:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 551:	80 f9 09             	cmp    $0x9,%cl
+ 554:	77 59                	ja     5af <parseip+0x6f>
+      return -1;
+    for(v = 0; *s >= '0' && *s <= '9'; s++)
+ 556:	31 c9                	xor    %ecx,%ecx
+ 558:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 55f:	90                   	nop
+      v = v * 10 + *s - '0';
+ 560:	89 d6                	mov    %edx,%esi
+ 562:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    for(v = 0; *s >= '0' && *s <= '9'; s++)
+ 565:	83 c2 01             	add    $0x1,%edx
+      v = v * 10 + *s - '0';
+ 568:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+    for(v = 0; *s >= '0' && *s <= '9'; s++)
+ 56c:	0f be 02             	movsbl (%edx),%eax
+ 56f:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 572:	80 fb 09             	cmp    $0x9,%bl
+ 575:	76 e9                	jbe    560 <parseip+0x20>
+    if(v > 255 || *s != (i < 3 ? '.' : '\0'))
+ 577:	81 f9 ff 00 00 00    	cmp    $0xff,%ecx
+ 57d:	7f 30                	jg     5af <parseip+0x6f>
+ 57f:	83 ff 03             	cmp    $0x3,%edi
+ 582:	74 1c                	je     5a0 <parseip+0x60>
+ 584:	83 f8 2e             	cmp    $0x2e,%eax
+ 587:	75 26                	jne    5af <parseip+0x6f>
+      return -1;
+    b[i] = v;
+ 589:	8b 45 0c             	mov    0xc(%ebp),%eax
+    s++;
+ 58c:	8d 56 02             	lea    0x2(%esi),%edx
+    b[i] = v;
+ 58f:	88 0c 38             	mov    %cl,(%eax,%edi,1)
+  for(int i = 0; i < 4; i++) {
+ 592:	83 c7 01             	add    $0x1,%edi
+ 595:	eb b4                	jmp    54b <parseip+0xb>
+ 597:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 59e:	66 90                	xchg   %ax,%ax
+    if(v > 255 || *s != (i < 3 ? '.' : '\0'))
+ 5a0:	85 c0                	test   %eax,%eax
+ 5a2:	75 0b                	jne    5af <parseip+0x6f>
+    b[i] = v;
+ 5a4:	8b 7d 0c             	mov    0xc(%ebp),%edi
+ 5a7:	88 4f 03             	mov    %cl,0x3(%edi)
+  }
+  return 0;
+}
+ 5aa:	5b                   	pop    %ebx
+ 5ab:	5e                   	pop    %esi
+ 5ac:	5f                   	pop    %edi
+ 5ad:	5d                   	pop    %ebp
+ 5ae:	c3                   	ret
+ 5af:	5b                   	pop    %ebx
+      return -1;
+ 5b0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+ 5b5:	5e                   	pop    %esi
+ 5b6:	5f                   	pop    %edi
+ 5b7:	5d                   	pop    %ebp
+ 5b8:	c3                   	ret
+ 5b9:	66 90                	xchg   %ax,%ax
+ 5bb:	66 90                	xchg   %ax,%ax
+ 5bd:	66 90                	xchg   %ax,%ax
+ 5bf:	90                   	nop
+
+000005c0 <atoi>:
+#include "types.h"
+#include "util.h"
+
+int
+atoi(const char *s)
+{
+ 5c0:	55                   	push   %ebp
+ 5c1:	89 e5                	mov    %esp,%ebp
+ 5c3:	53                   	push   %ebx
+ 5c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 5c7:	0f be 02             	movsbl (%edx),%eax
+ 5ca:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 5cd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 5d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 5d5:	77 1e                	ja     5f5 <atoi+0x35>
+ 5d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5de:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 5e0:	83 c2 01             	add    $0x1,%edx
+ 5e3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 5e6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 5ea:	0f be 02             	movsbl (%edx),%eax
+ 5ed:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 5f0:	80 fb 09             	cmp    $0x9,%bl
+ 5f3:	76 eb                	jbe    5e0 <atoi+0x20>
+  return n;
+}
+ 5f5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 5f8:	89 c8                	mov    %ecx,%eax
+ 5fa:	c9                   	leave
+ 5fb:	c3                   	ret
+ 5fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000600 <strcmp>:
+
+
+int
+strcmp(const char *p, const char *q)
+{
+ 600:	55                   	push   %ebp
+ 601:	89 e5                	mov    %esp,%ebp
+ 603:	53                   	push   %ebx
+ 604:	8b 55 08             	mov    0x8(%ebp),%edx
+ 607:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 60a:	0f b6 02             	movzbl (%edx),%eax
+ 60d:	84 c0                	test   %al,%al
+ 60f:	75 17                	jne    628 <strcmp+0x28>
+ 611:	eb 3a                	jmp    64d <strcmp+0x4d>
+ 613:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 617:	90                   	nop
+ 618:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 61c:	83 c2 01             	add    $0x1,%edx
+ 61f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 622:	84 c0                	test   %al,%al
+ 624:	74 1a                	je     640 <strcmp+0x40>
+    p++, q++;
+ 626:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 628:	0f b6 19             	movzbl (%ecx),%ebx
+ 62b:	38 c3                	cmp    %al,%bl
+ 62d:	74 e9                	je     618 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 62f:	29 d8                	sub    %ebx,%eax
+}
+ 631:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 634:	c9                   	leave
+ 635:	c3                   	ret
+ 636:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 63d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 640:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 644:	31 c0                	xor    %eax,%eax
+ 646:	29 d8                	sub    %ebx,%eax
+}
+ 648:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 64b:	c9                   	leave
+ 64c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 64d:	0f b6 19             	movzbl (%ecx),%ebx
+ 650:	31 c0                	xor    %eax,%eax
+ 652:	eb db                	jmp    62f <strcmp+0x2f>
+
+00000654 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 654:	b8 01 00 00 00       	mov    $0x1,%eax
+ 659:	cd 40                	int    $0x40
+ 65b:	c3                   	ret
+
+0000065c <exit>:
+SYSCALL(exit)
+ 65c:	b8 02 00 00 00       	mov    $0x2,%eax
+ 661:	cd 40                	int    $0x40
+ 663:	c3                   	ret
+
+00000664 <wait>:
+SYSCALL(wait)
+ 664:	b8 03 00 00 00       	mov    $0x3,%eax
+ 669:	cd 40                	int    $0x40
+ 66b:	c3                   	ret
+
+0000066c <pipe>:
+SYSCALL(pipe)
+ 66c:	b8 04 00 00 00       	mov    $0x4,%eax
+ 671:	cd 40                	int    $0x40
+ 673:	c3                   	ret
+
+00000674 <read>:
+SYSCALL(read)
+ 674:	b8 05 00 00 00       	mov    $0x5,%eax
+ 679:	cd 40                	int    $0x40
+ 67b:	c3                   	ret
+
+0000067c <write>:
+SYSCALL(write)
+ 67c:	b8 10 00 00 00       	mov    $0x10,%eax
+ 681:	cd 40                	int    $0x40
+ 683:	c3                   	ret
+
+00000684 <close>:
+SYSCALL(close)
+ 684:	b8 15 00 00 00       	mov    $0x15,%eax
+ 689:	cd 40                	int    $0x40
+ 68b:	c3                   	ret
+
+0000068c <kill>:
+SYSCALL(kill)
+ 68c:	b8 06 00 00 00       	mov    $0x6,%eax
+ 691:	cd 40                	int    $0x40
+ 693:	c3                   	ret
+
+00000694 <exec>:
+SYSCALL(exec)
+ 694:	b8 07 00 00 00       	mov    $0x7,%eax
+ 699:	cd 40                	int    $0x40
+ 69b:	c3                   	ret
+
+0000069c <open>:
+SYSCALL(open)
+ 69c:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 6a1:	cd 40                	int    $0x40
+ 6a3:	c3                   	ret
+
+000006a4 <mknod>:
+SYSCALL(mknod)
+ 6a4:	b8 11 00 00 00       	mov    $0x11,%eax
+ 6a9:	cd 40                	int    $0x40
+ 6ab:	c3                   	ret
+
+000006ac <unlink>:
+SYSCALL(unlink)
+ 6ac:	b8 12 00 00 00       	mov    $0x12,%eax
+ 6b1:	cd 40                	int    $0x40
+ 6b3:	c3                   	ret
+
+000006b4 <fstat>:
+SYSCALL(fstat)
+ 6b4:	b8 08 00 00 00       	mov    $0x8,%eax
+ 6b9:	cd 40                	int    $0x40
+ 6bb:	c3                   	ret
+
+000006bc <link>:
+SYSCALL(link)
+ 6bc:	b8 13 00 00 00       	mov    $0x13,%eax
+ 6c1:	cd 40                	int    $0x40
+ 6c3:	c3                   	ret
+
+000006c4 <mkdir>:
+SYSCALL(mkdir)
+ 6c4:	b8 14 00 00 00       	mov    $0x14,%eax
+ 6c9:	cd 40                	int    $0x40
+ 6cb:	c3                   	ret
+
+000006cc <chdir>:
+SYSCALL(chdir)
+ 6cc:	b8 09 00 00 00       	mov    $0x9,%eax
+ 6d1:	cd 40                	int    $0x40
+ 6d3:	c3                   	ret
+
+000006d4 <dup>:
+SYSCALL(dup)
+ 6d4:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 6d9:	cd 40                	int    $0x40
+ 6db:	c3                   	ret
+
+000006dc <getpid>:
+SYSCALL(getpid)
+ 6dc:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 6e1:	cd 40                	int    $0x40
+ 6e3:	c3                   	ret
+
+000006e4 <sbrk>:
+SYSCALL(sbrk)
+ 6e4:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 6e9:	cd 40                	int    $0x40
+ 6eb:	c3                   	ret
+
+000006ec <sleep>:
+SYSCALL(sleep)
+ 6ec:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 6f1:	cd 40                	int    $0x40
+ 6f3:	c3                   	ret
+
+000006f4 <uptime>:
+SYSCALL(uptime)
+ 6f4:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 6f9:	cd 40                	int    $0x40
+ 6fb:	c3                   	ret
+
+000006fc <arp>:
+SYSCALL(arp)
+ 6fc:	b8 16 00 00 00       	mov    $0x16,%eax
+ 701:	cd 40                	int    $0x40
+ 703:	c3                   	ret
+
+00000704 <nicget>:
+SYSCALL(nicget)
+ 704:	b8 17 00 00 00       	mov    $0x17,%eax
+ 709:	cd 40                	int    $0x40
+ 70b:	c3                   	ret
+
+0000070c <nicset>:
+SYSCALL(nicset)
+ 70c:	b8 18 00 00 00       	mov    $0x18,%eax
+ 711:	cd 40                	int    $0x40
+ 713:	c3                   	ret
+
+00000714 <nicstats>:
+SYSCALL(nicstats)
+ 714:	b8 19 00 00 00       	mov    $0x19,%eax
+ 719:	cd 40                	int    $0x40
+ 71b:	c3                   	ret
+
+0000071c <nicsend>:
+SYSCALL(nicsend)
+ 71c:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 721:	cd 40                	int    $0x40
+ 723:	c3                   	ret
+
+00000724 <nicrecv>:
+SYSCALL(nicrecv)
+ 724:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 729:	cd 40                	int    $0x40
+ 72b:	c3                   	ret
+
+0000072c <arpdump>:
+SYSCALL(arpdump)
+ 72c:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 731:	cd 40                	int    $0x40
+ 733:	c3                   	ret
+
+00000734 <arpflush>:
+SYSCALL(arpflush)
+ 734:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 739:	cd 40                	int    $0x40
+ 73b:	c3                   	ret
+
+0000073c <nicgetip>:
+SYSCALL(nicgetip)
+ 73c:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 741:	cd 40                	int    $0x40
+ 743:	c3                   	ret
+
+00000744 <nicsetip>:
+SYSCALL(nicsetip)
+ 744:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 749:	cd 40                	int    $0x40
+ 74b:	c3                   	ret
+
+0000074c <arpresolve>:
+SYSCALL(arpresolve)
+ 74c:	b8 20 00 00 00       	mov    $0x20,%eax
+ 751:	cd 40                	int    $0x40
+ 753:	c3                   	ret
+
+00000754 <arpresolvev>:
+SYSCALL(arpresolvev)
+ 754:	b8 21 00 00 00       	mov    $0x21,%eax
+ 759:	cd 40                	int    $0x40
+ 75b:	c3                   	ret
+
+0000075c <arpsend>:
+SYSCALL(arpsend)
+ 75c:	b8 22 00 00 00       	mov    $0x22,%eax
+ 761:	cd 40                	int    $0x40
+ 763:	c3                   	ret
+ 764:	66 90                	xchg   %ax,%ax
+ 766:	66 90                	xchg   %ax,%ax
+ 768:	66 90                	xchg   %ax,%ax
+ 76a:	66 90                	xchg   %ax,%ax
+ 76c:	66 90                	xchg   %ax,%ax
+ 76e:	66 90                	xchg   %ax,%ax
+
+00000770 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 770:	55                   	push   %ebp
+ 771:	89 e5                	mov    %esp,%ebp
+ 773:	57                   	push   %edi
+ 774:	56                   	push   %esi
+ 775:	53                   	push   %ebx
+ 776:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 778:	89 d1                	mov    %edx,%ecx
+{
+ 77a:	83 ec 3c             	sub    $0x3c,%esp
+ 77d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 780:	85 d2                	test   %edx,%edx
+ 782:	0f 89 80 00 00 00    	jns    808 <printint+0x98>
+ 788:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 78c:	74 7a                	je     808 <printint+0x98>
+    x = -xx;
+ 78e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 790:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 795:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 798:	31 f6                	xor    %esi,%esi
+ 79a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 7a0:	89 c8                	mov    %ecx,%eax
+ 7a2:	31 d2                	xor    %edx,%edx
+ 7a4:	89 f7                	mov    %esi,%edi
+ 7a6:	f7 f3                	div    %ebx
+ 7a8:	8d 76 01             	lea    0x1(%esi),%esi
+ 7ab:	0f b6 92 d0 0b 00 00 	movzbl 0xbd0(%edx),%edx
+ 7b2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 7b6:	89 ca                	mov    %ecx,%edx
+ 7b8:	89 c1                	mov    %eax,%ecx
+ 7ba:	39 da                	cmp    %ebx,%edx
+ 7bc:	73 e2                	jae    7a0 <printint+0x30>
+  if(neg)
+ 7be:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 7c1:	85 c0                	test   %eax,%eax
+ 7c3:	74 07                	je     7cc <printint+0x5c>
+    buf[i++] = '-';
+ 7c5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 7ca:	89 f7                	mov    %esi,%edi
+ 7cc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 7cf:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 7d2:	01 df                	add    %ebx,%edi
+ 7d4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 7d8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 7db:	83 ec 04             	sub    $0x4,%esp
+ 7de:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 7e1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 7e4:	6a 01                	push   $0x1
+ 7e6:	50                   	push   %eax
+ 7e7:	56                   	push   %esi
+ 7e8:	e8 8f fe ff ff       	call   67c <write>
+  while(--i >= 0)
+ 7ed:	89 f8                	mov    %edi,%eax
+ 7ef:	83 c4 10             	add    $0x10,%esp
+ 7f2:	83 ef 01             	sub    $0x1,%edi
+ 7f5:	39 d8                	cmp    %ebx,%eax
+ 7f7:	75 df                	jne    7d8 <printint+0x68>
+}
+ 7f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 7fc:	5b                   	pop    %ebx
+ 7fd:	5e                   	pop    %esi
+ 7fe:	5f                   	pop    %edi
+ 7ff:	5d                   	pop    %ebp
+ 800:	c3                   	ret
+ 801:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 808:	31 c0                	xor    %eax,%eax
+ 80a:	eb 89                	jmp    795 <printint+0x25>
+ 80c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000810 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 810:	55                   	push   %ebp
+ 811:	89 e5                	mov    %esp,%ebp
+ 813:	57                   	push   %edi
+ 814:	56                   	push   %esi
+ 815:	53                   	push   %ebx
+ 816:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 819:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 81c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 81f:	0f b6 1e             	movzbl (%esi),%ebx
+ 822:	83 c6 01             	add    $0x1,%esi
+ 825:	84 db                	test   %bl,%bl
+ 827:	74 67                	je     890 <printf+0x80>
+ 829:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 82c:	31 d2                	xor    %edx,%edx
+ 82e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 831:	eb 34                	jmp    867 <printf+0x57>
+ 833:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 837:	90                   	nop
+ 838:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 83b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 840:	83 f8 25             	cmp    $0x25,%eax
+ 843:	74 18                	je     85d <printf+0x4d>
+  write(fd, &c, 1);
+ 845:	83 ec 04             	sub    $0x4,%esp
+ 848:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 84b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 84e:	6a 01                	push   $0x1
+ 850:	50                   	push   %eax
+ 851:	57                   	push   %edi
+ 852:	e8 25 fe ff ff       	call   67c <write>
+ 857:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 85a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 85d:	0f b6 1e             	movzbl (%esi),%ebx
+ 860:	83 c6 01             	add    $0x1,%esi
+ 863:	84 db                	test   %bl,%bl
+ 865:	74 29                	je     890 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 867:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 86a:	85 d2                	test   %edx,%edx
+ 86c:	74 ca                	je     838 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 86e:	83 fa 25             	cmp    $0x25,%edx
+ 871:	75 ea                	jne    85d <printf+0x4d>
+      if(c == 'd'){
+ 873:	83 f8 25             	cmp    $0x25,%eax
+ 876:	0f 84 24 01 00 00    	je     9a0 <printf+0x190>
+ 87c:	83 e8 63             	sub    $0x63,%eax
+ 87f:	83 f8 15             	cmp    $0x15,%eax
+ 882:	77 1c                	ja     8a0 <printf+0x90>
+ 884:	ff 24 85 78 0b 00 00 	jmp    *0xb78(,%eax,4)
+ 88b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 88f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 890:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 893:	5b                   	pop    %ebx
+ 894:	5e                   	pop    %esi
+ 895:	5f                   	pop    %edi
+ 896:	5d                   	pop    %ebp
+ 897:	c3                   	ret
+ 898:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 89f:	90                   	nop
+  write(fd, &c, 1);
+ 8a0:	83 ec 04             	sub    $0x4,%esp
+ 8a3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 8a6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 8aa:	6a 01                	push   $0x1
+ 8ac:	52                   	push   %edx
+ 8ad:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 8b0:	57                   	push   %edi
+ 8b1:	e8 c6 fd ff ff       	call   67c <write>
+ 8b6:	83 c4 0c             	add    $0xc,%esp
+ 8b9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 8bc:	6a 01                	push   $0x1
+ 8be:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 8c1:	52                   	push   %edx
+ 8c2:	57                   	push   %edi
+ 8c3:	e8 b4 fd ff ff       	call   67c <write>
+        putc(fd, c);
+ 8c8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 8cb:	31 d2                	xor    %edx,%edx
+ 8cd:	eb 8e                	jmp    85d <printf+0x4d>
+ 8cf:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 8d0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 8d3:	83 ec 0c             	sub    $0xc,%esp
+ 8d6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 8db:	8b 13                	mov    (%ebx),%edx
+ 8dd:	6a 00                	push   $0x0
+ 8df:	89 f8                	mov    %edi,%eax
+        ap++;
+ 8e1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 8e4:	e8 87 fe ff ff       	call   770 <printint>
+        ap++;
+ 8e9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 8ec:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 8ef:	31 d2                	xor    %edx,%edx
+ 8f1:	e9 67 ff ff ff       	jmp    85d <printf+0x4d>
+ 8f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8fd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 900:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 903:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 905:	83 c0 04             	add    $0x4,%eax
+ 908:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 90b:	85 db                	test   %ebx,%ebx
+ 90d:	0f 84 9d 00 00 00    	je     9b0 <printf+0x1a0>
+        while(*s != 0){
+ 913:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 916:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 918:	84 c0                	test   %al,%al
+ 91a:	0f 84 3d ff ff ff    	je     85d <printf+0x4d>
+ 920:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 923:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 926:	89 de                	mov    %ebx,%esi
+ 928:	89 d3                	mov    %edx,%ebx
+ 92a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 930:	83 ec 04             	sub    $0x4,%esp
+ 933:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 936:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 939:	6a 01                	push   $0x1
+ 93b:	53                   	push   %ebx
+ 93c:	57                   	push   %edi
+ 93d:	e8 3a fd ff ff       	call   67c <write>
+        while(*s != 0){
+ 942:	0f b6 06             	movzbl (%esi),%eax
+ 945:	83 c4 10             	add    $0x10,%esp
+ 948:	84 c0                	test   %al,%al
+ 94a:	75 e4                	jne    930 <printf+0x120>
+      state = 0;
+ 94c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 94f:	31 d2                	xor    %edx,%edx
+ 951:	e9 07 ff ff ff       	jmp    85d <printf+0x4d>
+ 956:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 95d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 960:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 963:	83 ec 0c             	sub    $0xc,%esp
+ 966:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 96b:	8b 13                	mov    (%ebx),%edx
+ 96d:	6a 01                	push   $0x1
+ 96f:	e9 6b ff ff ff       	jmp    8df <printf+0xcf>
+ 974:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 978:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 97b:	83 ec 04             	sub    $0x4,%esp
+ 97e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 981:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 983:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 986:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 989:	6a 01                	push   $0x1
+ 98b:	52                   	push   %edx
+ 98c:	57                   	push   %edi
+ 98d:	e8 ea fc ff ff       	call   67c <write>
+        ap++;
+ 992:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 995:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 998:	31 d2                	xor    %edx,%edx
+ 99a:	e9 be fe ff ff       	jmp    85d <printf+0x4d>
+ 99f:	90                   	nop
+  write(fd, &c, 1);
+ 9a0:	83 ec 04             	sub    $0x4,%esp
+ 9a3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 9a6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 9a9:	6a 01                	push   $0x1
+ 9ab:	e9 11 ff ff ff       	jmp    8c1 <printf+0xb1>
+ 9b0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 9b5:	bb 6e 0b 00 00       	mov    $0xb6e,%ebx
+ 9ba:	e9 61 ff ff ff       	jmp    920 <printf+0x110>
+ 9bf:	90                   	nop
+
+000009c0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 9c0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 9c1:	a1 a0 13 00 00       	mov    0x13a0,%eax
+{
+ 9c6:	89 e5                	mov    %esp,%ebp
+ 9c8:	57                   	push   %edi
+ 9c9:	56                   	push   %esi
+ 9ca:	53                   	push   %ebx
+ 9cb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 9ce:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 9d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9d8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 9da:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 9dc:	39 ca                	cmp    %ecx,%edx
+ 9de:	73 30                	jae    a10 <free+0x50>
+ 9e0:	39 c1                	cmp    %eax,%ecx
+ 9e2:	72 04                	jb     9e8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 9e4:	39 c2                	cmp    %eax,%edx
+ 9e6:	72 f0                	jb     9d8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 9e8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 9eb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 9ee:	39 f8                	cmp    %edi,%eax
+ 9f0:	74 2e                	je     a20 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 9f2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 9f5:	8b 42 04             	mov    0x4(%edx),%eax
+ 9f8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 9fb:	39 f1                	cmp    %esi,%ecx
+ 9fd:	74 38                	je     a37 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 9ff:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ a01:	5b                   	pop    %ebx
+  freep = p;
+ a02:	89 15 a0 13 00 00    	mov    %edx,0x13a0
+}
+ a08:	5e                   	pop    %esi
+ a09:	5f                   	pop    %edi
+ a0a:	5d                   	pop    %ebp
+ a0b:	c3                   	ret
+ a0c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a10:	39 c1                	cmp    %eax,%ecx
+ a12:	72 d0                	jb     9e4 <free+0x24>
+ a14:	eb c2                	jmp    9d8 <free+0x18>
+ a16:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a1d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ a20:	03 70 04             	add    0x4(%eax),%esi
+ a23:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ a26:	8b 02                	mov    (%edx),%eax
+ a28:	8b 00                	mov    (%eax),%eax
+ a2a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ a2d:	8b 42 04             	mov    0x4(%edx),%eax
+ a30:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ a33:	39 f1                	cmp    %esi,%ecx
+ a35:	75 c8                	jne    9ff <free+0x3f>
+    p->s.size += bp->s.size;
+ a37:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ a3a:	89 15 a0 13 00 00    	mov    %edx,0x13a0
+    p->s.size += bp->s.size;
+ a40:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ a43:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ a46:	89 0a                	mov    %ecx,(%edx)
+}
+ a48:	5b                   	pop    %ebx
+ a49:	5e                   	pop    %esi
+ a4a:	5f                   	pop    %edi
+ a4b:	5d                   	pop    %ebp
+ a4c:	c3                   	ret
+ a4d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000a50 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ a50:	55                   	push   %ebp
+ a51:	89 e5                	mov    %esp,%ebp
+ a53:	57                   	push   %edi
+ a54:	56                   	push   %esi
+ a55:	53                   	push   %ebx
+ a56:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ a59:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ a5c:	8b 15 a0 13 00 00    	mov    0x13a0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ a62:	8d 78 07             	lea    0x7(%eax),%edi
+ a65:	c1 ef 03             	shr    $0x3,%edi
+ a68:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ a6b:	85 d2                	test   %edx,%edx
+ a6d:	0f 84 8d 00 00 00    	je     b00 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a73:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ a75:	8b 48 04             	mov    0x4(%eax),%ecx
+ a78:	39 f9                	cmp    %edi,%ecx
+ a7a:	73 64                	jae    ae0 <malloc+0x90>
+  if(nu < 4096)
+ a7c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ a81:	39 df                	cmp    %ebx,%edi
+ a83:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ a86:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ a8d:	eb 0a                	jmp    a99 <malloc+0x49>
+ a8f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a90:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ a92:	8b 48 04             	mov    0x4(%eax),%ecx
+ a95:	39 f9                	cmp    %edi,%ecx
+ a97:	73 47                	jae    ae0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ a99:	89 c2                	mov    %eax,%edx
+ a9b:	39 05 a0 13 00 00    	cmp    %eax,0x13a0
+ aa1:	75 ed                	jne    a90 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ aa3:	83 ec 0c             	sub    $0xc,%esp
+ aa6:	56                   	push   %esi
+ aa7:	e8 38 fc ff ff       	call   6e4 <sbrk>
+  if(p == (char*)-1)
+ aac:	83 c4 10             	add    $0x10,%esp
+ aaf:	83 f8 ff             	cmp    $0xffffffff,%eax
+ ab2:	74 1c                	je     ad0 <malloc+0x80>
+  hp->s.size = nu;
+ ab4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ ab7:	83 ec 0c             	sub    $0xc,%esp
+ aba:	83 c0 08             	add    $0x8,%eax
+ abd:	50                   	push   %eax
+ abe:	e8 fd fe ff ff       	call   9c0 <free>
+  return freep;
+ ac3:	8b 15 a0 13 00 00    	mov    0x13a0,%edx
+      if((p = morecore(nunits)) == 0)
+ ac9:	83 c4 10             	add    $0x10,%esp
+ acc:	85 d2                	test   %edx,%edx
+ ace:	75 c0                	jne    a90 <malloc+0x40>
+        return 0;
+  }
+}
+ ad0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ ad3:	31 c0                	xor    %eax,%eax
+}
+ ad5:	5b                   	pop    %ebx
+ ad6:	5e                   	pop    %esi
+ ad7:	5f                   	pop    %edi
+ ad8:	5d                   	pop    %ebp
+ ad9:	c3                   	ret
+ ada:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ ae0:	39 cf                	cmp    %ecx,%edi
+ ae2:	74 4c                	je     b30 <malloc+0xe0>
+        p->s.size -= nunits;
+ ae4:	29 f9                	sub    %edi,%ecx
+ ae6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ ae9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ aec:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ aef:	89 15 a0 13 00 00    	mov    %edx,0x13a0
+}
+ af5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ af8:	83 c0 08             	add    $0x8,%eax
+}
+ afb:	5b                   	pop    %ebx
+ afc:	5e                   	pop    %esi
+ afd:	5f                   	pop    %edi
+ afe:	5d                   	pop    %ebp
+ aff:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ b00:	c7 05 a0 13 00 00 a4 	movl   $0x13a4,0x13a0
+ b07:	13 00 00 
+    base.s.size = 0;
+ b0a:	b8 a4 13 00 00       	mov    $0x13a4,%eax
+    base.s.ptr = freep = prevp = &base;
+ b0f:	c7 05 a4 13 00 00 a4 	movl   $0x13a4,0x13a4
+ b16:	13 00 00 
+    base.s.size = 0;
+ b19:	c7 05 a8 13 00 00 00 	movl   $0x0,0x13a8
+ b20:	00 00 00 
+    if(p->s.size >= nunits){
+ b23:	e9 54 ff ff ff       	jmp    a7c <malloc+0x2c>
+ b28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b2f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ b30:	8b 08                	mov    (%eax),%ecx
+ b32:	89 0a                	mov    %ecx,(%edx)
+ b34:	eb b9                	jmp    aef <malloc+0x9f>
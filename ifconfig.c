@@ -0,0 +1,51 @@
+/**
+ *show or set interface IPv4 addresses
+ *usage: ifconfig [interface [a.b.c.d]]
+ *setting 0.0.0.0 removes the address
+ */
+#include "types.h"
+#include "user.h"
+
+static void show(char *interface) {
+  uint addr;
+  uint8_t *b = (uint8_t*)&addr;
+
+  if(nicgetip(interface, &addr) < 0) {
+    printf(2, "ifconfig: no interface %s\n", interface);
+    return;
+  }
+  printf(1, "%s: inet ", interface);
+  if(addr)
+    printf(1, "%d.%d.%d.%d\n", b[0], b[1], b[2], b[3]);
+  else
+    printf(1, "none\n");
+}
+
+int main(int argc, char *argv[]) {
+  char name[8];
+  uint addr;
+
+  if(argc > 3) {
+    printf(2, "usage: ifconfig [interface [a.b.c.d]]\n");
+    exit();
+  }
+
+  // No interface given: show them all, eth0 onwards until one is missing
+  if(argc == 1) {
+    strcpy(name, "eth0");
+    for(; nicgetip(name, &addr) >= 0; name[3]++)
+      show(name);
+    exit();
+  }
+
+  if(argc == 3) {
+    if(parseip(argv[2], &addr) < 0) {
+      printf(2, "ifconfig: bad address %s\n", argv[2]);
+      exit();
+    }
+    if(nicsetip(argv[1], addr) < 0)
+      printf(2, "ifconfig: failed to set the address of %s\n", argv[1]);
+  }
+  show(argv[1]);
+  exit();
+}
@@ -94,3 +94,48 @@ kalloc(void)
   return (char*)r;
 }
 
+// Allocate n physically contiguous pages, for device DMA
+// rings. freerange() pushes pages in increasing address order,
+// so runs of adjacent pages sit next to each other on the
+// free list, highest address first. Look for such a run.
+// Returns the lowest page, or 0 if there is no run long enough.
+char*
+kallocn(int n)
+{
+  struct run **start, *r;
+  int len;
+
+  if(n == 1)
+    return kalloc();
+  if(kmem.use_lock)
+    acquire(&kmem.lock);
+  start = &kmem.freelist;
+  len = 0;
+  for(r = kmem.freelist; r; r = r->next){
+    if(len > 0 && (char*)r == (char*)*start - len*PGSIZE)
+      len++;
+    else {
+      // Find the link pointing at r to restart the run there.
+      if(len > 0)
+        for(; *start != r; start = &(*start)->next)
+          ;
+      len = 1;
+    }
+    if(len == n){
+      *start = r->next;
+      break;
+    }
+  }
+  if(kmem.use_lock)
+    release(&kmem.lock);
+  return len == n ? (char*)r : 0;
+}
+
+// Free n pages allocated with kallocn().
+void
+kfreen(char *v, int n)
+{
+  for(int i = 0; i < n; i++)
+    kfree(v + i*PGSIZE);
+}
+
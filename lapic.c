@@ -114,10 +114,10 @@ lapiceoi(void)
 }
 
 // Spin for a given number of microseconds.
-// On real hardware would want to tune this dynamically.
 void
 microdelay(int us)
 {
+  udelay(us);
 }
 
 #define CMOS_PORT    0x70
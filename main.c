@@ -6,6 +6,7 @@
 #include "proc.h"
 #include "x86.h"
 #include "pci.h"
+#include "nic.h"
 
 static void startothers(void);
 static void mpmain(void)  __attribute__((noreturn));
@@ -27,6 +28,7 @@ main(void)
   ioapicinit();    // another interrupt controller
   consoleinit();   // console hardware
   uartinit();      // serial port
+  tscinit();       // calibrate delays and clock
   pinit();         // process table
   tvinit();        // trap vectors
   binit();         // buffer cache
@@ -36,6 +38,7 @@ main(void)
   kinit2(P2V(4*1024*1024), P2V(PHYSTOP)); // must come after startothers()
   pci_init();      // PCI devices
   userinit();      // first user process
+  nic_init();      // NIC receive poll thread
   mpmain();        // finish this processor's setup
 }
 
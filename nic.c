@@ -1,23 +1,517 @@
 #include "nic.h"
 #include "defs.h"
+#include "param.h"
+#include "mmu.h"
+#include "proc.h"
+#include "spinlock.h"
+#include "pktbuf.h"
 
+struct nic_device nic_devices[NIC_MAX_DEVICES];
+int nic_ndevices;
+
+//Protects poll_scheduled of every device. The poll thread sleeps on it.
+static struct spinlock polllock;
+static int stats_due;   //nic_tick() wants the statistics updated
+static int timer_due;   //nic_tick() wants the protocol timers run
+
+//Protects the raw frame queue of every device. Readers sleep on the queue.
+static struct spinlock rawlock;
+
+//nic_init() ran, devices registered from now on get interrupts at once
+static int nic_ready;
+//irq lines PCI found network controllers on, see nic_claim_irq()
+static uint nic_irq_lines;
+
+/**
+ * Look a device up by its index. Returns 0 and sets *nd, or -1 if no
+ * device has that index.
+ */
+int get_device_by_index(int index, struct nic_device** nd) {
+  if(index < 0 || index >= nic_ndevices)
+    return -1;
+  *nd = &nic_devices[index];
+  return 0;
+}
+
+/**
+ * Look a device up by interface name. Names are NIC_NAME_PREFIX followed
+ * by the index, so the lookup is a parse, not a search.
+ */
 int get_device(char* interface, struct nic_device** nd) {
-  cprintf("get device for interface=%s\n", interface);
-  /**
-   *TODO: Use interface name to fetch device details
-   *from a table of loaded devices.
-   *
-   * For now, since we have only one device loaded at a time,
-   * this will suffice
-   */
-   if(nic_devices[0].send_packet == 0 || nic_devices[0].recv_packet == 0) {
-     return -1;
-   }
-   *nd = &nic_devices[0];
-
-   return 0;
-}
-
-void register_device(struct nic_device nd) {
-  nic_devices[0] = nd;
+  int index = 0;
+  char *p = interface;
+
+  if(strncmp(p, NIC_NAME_PREFIX, sizeof(NIC_NAME_PREFIX) - 1) != 0)
+    return -1;
+  p += sizeof(NIC_NAME_PREFIX) - 1;
+  if(*p == 0 || (*p == '0' && p[1] != 0))
+    return -1;
+  for(; *p; p++) {
+    if(*p < '0' || *p > '9' || index >= NIC_MAX_DEVICES)
+      return -1;
+    index = index * 10 + (*p - '0');
+  }
+  return get_device_by_index(index, nd);
+}
+
+/**
+ * Add a device the driver has set up to the table and name it after its
+ * index. Only called while devices are probed at boot, before anything
+ * can look them up. Returns the index, or -1 if the table is full.
+ */
+int register_device(struct nic_device nd) {
+  int index = nic_ndevices;
+  char *p;
+
+  if(index >= NIC_MAX_DEVICES)
+    return -1;
+  nd.index = index;
+  safestrcpy(nd.name, NIC_NAME_PREFIX, sizeof(nd.name));
+  p = nd.name + sizeof(NIC_NAME_PREFIX) - 1;
+  if(index >= 10)
+    *p++ = '0' + index / 10;
+  *p++ = '0' + index % 10;
+  *p = 0;
+  nic_devices[index] = nd;
+  //the entry is complete before the interrupt path can see it
+  __sync_synchronize();
+  nic_ndevices = index + 1;
+  cprintf("nic: %s registered, irq %d\n", nd.name, nd.irq_line);
+  if(nic_ready && nd.enable_intr)
+    nd.enable_intr(&nic_devices[index]);
+  return index;
+}
+
+/**
+ * Send a burst of frames, ringing the device doorbell once if the
+ * driver supports it. Returns the number of frames queued.
+ */
+int nic_send_batch(struct nic_device *nd, uint8_t **pkts, uint16_t *lengths, int n) {
+  if(nd->send_batch)
+    return nd->send_batch(nd->driver, pkts, lengths, n);
+
+  int queued = 0;
+  for(int i = 0; i < n; i++) {
+    if(nd->send_packet(nd->driver, pkts[i], lengths[i]) == 0)
+      queued++;
+  }
+  return queued;
+}
+
+/**
+ * Internet checksum of buf, folded into the 32-bit partial sum.
+ * Returns the complemented 16-bit result in network byte order.
+ */
+uint16_t nic_cksum(uint32_t sum, uint8_t *buf, int length) {
+  for(; length > 1; length -= 2, buf += 2)
+    sum += *(uint16_t*)buf;
+  if(length)
+    sum += *buf;
+  while(sum >> 16)
+    sum = (sum & 0xffff) + (sum >> 16);
+  return ~sum;
+}
+
+/**
+ * Send a frame whose checksums still have to be filled in. The IPv4
+ * header checksum field must be 0 and the TCP/UDP checksum field must
+ * hold the (uncomplemented) pseudo header sum. Devices with NIC_F_TXCSUM
+ * insert the checksums, for the rest they are computed here.
+ */
+int nic_send_csum(struct nic_device *nd, uint8_t *pkt, uint16_t length, struct nic_txcsum *csum) {
+  if((nd->features & NIC_F_TXCSUM) && nd->send_csum)
+    return nd->send_csum(nd->driver, pkt, length, csum);
+
+  if(csum->l4off <= csum->l3off || csum->l4off >= length)
+    return -1;
+  if(csum->flags & NIC_TXCSUM_IP) {
+    uint16_t *ipsum = (uint16_t*)(pkt + csum->l3off + 10);
+    *ipsum = nic_cksum(0, pkt + csum->l3off, csum->l4off - csum->l3off);
+  }
+  if(csum->flags & (NIC_TXCSUM_TCP | NIC_TXCSUM_UDP)) {
+    uint16_t *l4sum = (uint16_t*)(pkt + csum->l4off + ((csum->flags & NIC_TXCSUM_TCP) ? 16 : 6));
+    *l4sum = nic_cksum(0, pkt + csum->l4off, length - csum->l4off);
+  }
+  return nd->send_packet(nd->driver, pkt, length);
+}
+
+/**
+ * Large TCP send. hdr is the Ethernet/IPv4/TCP header of the first
+ * segment: IP total length and checksum are ignored, the TCP checksum
+ * field holds the pseudo header sum *without* the length. payload must
+ * be kernel memory that stays untouched until done(arg) is called.
+ * done(arg) is called exactly once, whether the send succeeds or not,
+ * so the caller never frees payload itself once it has been handed in.
+ * Devices with NIC_F_TSO cut the segments themselves unless the send is
+ * too big for their ring. For the rest, segments are built here one at
+ * a time (software GSO) and sent with nic_send_csum(), so checksum
+ * offload is still used if available.
+ */
+int nic_send_tso(struct nic_device *nd, uint8_t *hdr, uint16_t hdrlen,
+                 uint8_t *payload, uint32_t paylen, struct nic_tso *tso,
+                 void (*done)(void *arg), void *arg) {
+  uint8_t *seg;
+  int r = NIC_TSO_SOFTWARE;
+
+  if((nd->features & NIC_F_TSO) && nd->send_tso)
+    r = nd->send_tso(nd->driver, hdr, hdrlen, payload, paylen, tso, done, arg);
+  if(r != NIC_TSO_SOFTWARE)
+    return r;
+
+  r = -1;
+  if(hdrlen > NIC_TSO_MAX_HDR || paylen > NIC_TSO_MAX || tso->mss == 0 ||
+     tso->l4off <= tso->l3off || tso->l4off + 20 > hdrlen ||
+     hdrlen + tso->mss > PGSIZE)
+    goto out;
+  if((seg = (uint8_t*)kalloc()) == 0)
+    goto out;
+
+  uint8_t *ip = seg + tso->l3off;
+  uint8_t *tcp = seg + tso->l4off;
+  uint16_t ipid = htons(*(uint16_t*)(hdr + tso->l3off + 4));
+  uint32_t seq = htonl(*(uint32_t*)(hdr + tso->l4off + 4));
+  uint16_t seed = *(uint16_t*)(hdr + tso->l4off + 16);
+  struct nic_txcsum csum = { NIC_TXCSUM_IP | NIC_TXCSUM_TCP, tso->l3off, tso->l4off };
+
+  r = 0;
+
+  for(uint32_t off = 0, i = 0; off < paylen; off += tso->mss, i++) {
+    uint32_t len = paylen - off < tso->mss ? paylen - off : tso->mss;
+    uint32_t sum;
+
+    memmove(seg, hdr, hdrlen);
+    memmove(seg + hdrlen, payload + off, len);
+    *(uint16_t*)(ip + 2) = htons(hdrlen - tso->l3off + len);
+    *(uint16_t*)(ip + 4) = htons(ipid + i);
+    *(uint16_t*)(ip + 10) = 0;
+    *(uint32_t*)(tcp + 4) = htonl(seq + off);
+    if(off + len < paylen)
+      tcp[13] &= ~0x09;   //FIN and PSH only on the last segment
+    sum = seed + htons(hdrlen - tso->l4off + len);
+    while(sum >> 16)
+      sum = (sum & 0xffff) + (sum >> 16);
+    *(uint16_t*)(tcp + 16) = sum;
+    if((r = nic_send_csum(nd, seg, hdrlen + len, &csum)) < 0)
+      break;
+  }
+
+  kfree((char*)seg);
+out:
+  if(done)
+    done(arg);
+  return r;
+}
+
+/**
+ * Called from trap() for device interrupts nobody else claimed.
+ * Returns 0 if a loaded NIC owns the irq line, -1 otherwise.
+ */
+int nic_intr(int irq) {
+  int handled = -1;
+
+  for(int i = 0; i < nic_ndevices; i++) {
+    struct nic_device *nd = &nic_devices[i];
+    if(nd->driver == 0 || nd->intr == 0 || nd->irq_line != irq)
+      continue;
+    nd->intr(nd);
+    handled = 0;
+  }
+  //a stray one on a NIC's line, e.g. from a device that failed to attach.
+  //trap() acks it
+  if(handled < 0 && irq < 32 && (nic_irq_lines & (1 << irq)))
+    handled = 0;
+
+  return handled;
+}
+
+/**
+ * PCI found a network controller on irq, whether or not a driver takes
+ * it. Interrupts on the line that no device claims are then ignored
+ * instead of taken for a kernel bug.
+ */
+void nic_claim_irq(int irq) {
+  if(irq < 32)
+    nic_irq_lines |= 1 << irq;
+}
+
+// Queue a raw frame for nic_raw_recv(), takes ownership of pb.
+static void nic_raw_input(struct nic_device *nd, struct pktbuf *pb) {
+  acquire(&rawlock);
+  if(nd->rawq_len >= NIC_RAWQ_MAX) {
+    nd->rawq_drops++;
+    release(&rawlock);
+    pktbuf_free(pb);
+    return;
+  }
+  pb->next = 0;
+  if(nd->rawq_tail)
+    nd->rawq_tail->next = pb;
+  else
+    nd->rawq_head = pb;
+  nd->rawq_tail = pb;
+  nd->rawq_len++;
+  wakeup(&nd->rawq_head);
+  release(&rawlock);
+}
+
+/**
+ * Send a whole Ethernet frame as given, for testing and benchmarks.
+ * Returns 0 if queued.
+ */
+int nic_raw_send(struct nic_device *nd, uint8_t *frame, uint16_t length) {
+  if(length < ETHR_HDR_LEN || length > ETHR_HDR_LEN + nd->mtu)
+    return -1;
+  return nd->send_packet(nd->driver, frame, length) < 0 ? -1 : 0;
+}
+
+/**
+ * Wait for the next received ETHR_TYPE_RAW frame and copy it, cut to
+ * length bytes, into buf. Returns the frame length or -1 if killed.
+ */
+int nic_raw_recv(struct nic_device *nd, uint8_t *buf, int length) {
+  struct pktbuf *pb;
+
+  acquire(&rawlock);
+  while((pb = nd->rawq_head) == 0) {
+    if(myproc()->killed) {
+      release(&rawlock);
+      return -1;
+    }
+    sleep(&nd->rawq_head, &rawlock);
+  }
+  if((nd->rawq_head = pb->next) == 0)
+    nd->rawq_tail = 0;
+  nd->rawq_len--;
+  release(&rawlock);
+
+  if(length > pb->len)
+    length = pb->len;
+  memmove(buf, pb->data, length);
+  length = pb->len;
+  pktbuf_free(pb);
+  return length;
+}
+
+/**
+ * Protocol demux for received frames. Called by the driver from
+ * interrupt or poll context with a buffer detached from its ring; nic_rx
+ * owns pb from here on and frees it unless a protocol keeps it.
+ * rxcsum holds NIC_RXCSUM_* bits for checksums the device already
+ * verified, upper layers must check the rest with nic_cksum().
+ */
+void nic_rx(struct nic_device *nd, struct pktbuf *pb, int rxcsum) {
+  struct ethr_hdr *eth = (struct ethr_hdr*)pb->data;
+
+  if(pb->len >= ETHR_HDR_LEN) {
+    switch(htons(eth->ethr_type)) {
+    case ETHR_TYPE_ARP:
+      arp_input(nd, pb->data, pb->len);
+      break;
+    case ETHR_TYPE_RAW:
+      nic_raw_input(nd, pb);
+      return;
+    default:
+      //no upper layer for this ether type yet, drop it
+      break;
+    }
+  }
+  pktbuf_free(pb);
+}
+
+/**
+ * Timer hook, cpu 0 calls it on every tick. Hands periodic driver work
+ * to the poll thread since it can't be done in interrupt context.
+ * ARP retransmits are one small frame each, so they go out from here.
+ */
+void nic_tick(uint ticks) {
+  arp_tick(ticks);
+  if(ticks % NIC_TIMER_TICKS && ticks % NIC_STATS_TICKS)
+    return;
+  acquire(&polllock);
+  if(ticks % NIC_TIMER_TICKS == 0)
+    timer_due = 1;
+  if(ticks % NIC_STATS_TICKS == 0)
+    stats_due = 1;
+  wakeup(&polllock);
+  release(&polllock);
+}
+
+// Copy out up to n NICSTAT_* counters, returns how many or -1.
+int nic_get_stats(struct nic_device *nd, uint64_t *stats, int n) {
+  if(nd->get_stats == 0 || n < 0)
+    return -1;
+  return nd->get_stats(nd->driver, stats, n);
+}
+
+/**
+ * Called by a driver when its link goes up or down or renegotiates.
+ * speed is in Mb/s. Drivers fail transmits themselves while down.
+ */
+void nic_link_change(struct nic_device *nd, int up, int speed, int full_duplex) {
+  if(up == nd->link_up && speed == nd->speed && full_duplex == nd->full_duplex)
+    return;
+  nd->link_up = up;
+  nd->speed = speed;
+  nd->full_duplex = full_duplex;
+  if(up)
+    cprintf("nic: link up, %d Mb/s %s duplex\n", speed, full_duplex ? "full" : "half");
+  else
+    cprintf("nic: link down\n");
+  //peers may have moved on while we were away
+  if(up && nd->ipaddr)
+    arp_announce(nd);
+}
+
+/**
+ * Give nd an IPv4 address (network byte order), 0 removes it. The ARP
+ * responder answers for it from now on; announce it if we can.
+ */
+void nic_set_ipaddr(struct nic_device *nd, uint32_t ipaddr) {
+  nd->ipaddr = ipaddr;
+  if(ipaddr && nd->link_up)
+    arp_announce(nd);
+}
+
+/**
+ * Called by a driver, usually from its interrupt handler, after it
+ * masked receive interrupts because a burst arrived. The poll thread
+ * will call recv_packet() until the driver reports the ring drained.
+ */
+void nic_schedule_poll(struct nic_device *nd) {
+  acquire(&polllock);
+  nd->poll_scheduled = 1;
+  wakeup(&polllock);
+  release(&polllock);
+}
+
+/**
+ * Kernel thread that drains receive rings in polled mode. Each pass
+ * gives every scheduled device at most poll_budget frames, then yields
+ * so a flood can't starve processes. Also runs the periodic statistics
+ * update and protocol timers nic_tick() asks for.
+ */
+static void nic_poller(void *arg) {
+  int busy;
+
+  acquire(&polllock);
+  for(;;) {
+    busy = 0;
+    for(int i = 0; i < nic_ndevices; i++) {
+      struct nic_device *nd = &nic_devices[i];
+      if(!nd->poll_scheduled)
+        continue;
+      //clear it first: once the driver unmasks receive interrupts, one
+      //may come in and schedule us again before we get the lock back
+      nd->poll_scheduled = 0;
+      release(&polllock);
+      int n = nd->recv_packet(nd, nd->poll_budget);
+      nd->rx_poll_frames += n;
+      acquire(&polllock);
+      if(n >= nd->poll_budget) {
+        nd->poll_scheduled = 1;
+        busy = 1;
+      }
+    }
+    if(timer_due) {
+      timer_due = 0;
+      release(&polllock);
+      arp_timer();
+      acquire(&polllock);
+      continue;
+    }
+    if(stats_due) {
+      stats_due = 0;
+      release(&polllock);
+      for(int i = 0; i < nic_ndevices; i++)
+        if(nic_devices[i].update_stats)
+          nic_devices[i].update_stats(nic_devices[i].driver);
+      acquire(&polllock);
+      continue;
+    }
+    if(busy) {
+      release(&polllock);
+      yield();
+      acquire(&polllock);
+    } else {
+      sleep(&polllock, &polllock);
+    }
+  }
+}
+
+void nic_init(void) {
+  initlock(&polllock, "nicpoll");
+  initlock(&rawlock, "nicraw");
+  arp_init();
+  if(kthread("nicpoll", nic_poller, 0) < 0)
+    panic("nic_init: no poll thread");
+  //locks are set up, the interrupt path may run now
+  nic_ready = 1;
+  for(int i = 0; i < nic_ndevices; i++)
+    if(nic_devices[i].enable_intr)
+      nic_devices[i].enable_intr(&nic_devices[i]);
+}
+
+/**
+ * Receive frames sent to addr as well as to the device's own address and
+ * broadcast. A multicast addr (group bit set) joins that group. Devices
+ * that can't filter stay as they are, which is only right if they
+ * already see everything, so that is an error.
+ */
+int nic_add_addr(struct nic_device *nd, uint8_t *addr) {
+  if(nd->add_addr == 0)
+    return -1;
+  return nd->add_addr(nd->driver, addr);
+}
+
+int nic_del_addr(struct nic_device *nd, uint8_t *addr) {
+  if(nd->del_addr == 0)
+    return -1;
+  return nd->del_addr(nd->driver, addr);
+}
+
+/**
+ * NICCTL_* parameters. The ones kept by the nic layer are answered
+ * here, the rest go to the driver.
+ */
+int nic_get_param(struct nic_device *nd, int param, uint32_t *value) {
+  switch(param) {
+  case NICCTL_POLL_BUDGET: *value = nd->poll_budget; return 0;
+  case NICCTL_RX_INTR:     *value = nd->rx_intr_frames; return 0;
+  case NICCTL_RX_POLL:     *value = nd->rx_poll_frames; return 0;
+  case NICCTL_MTU:         *value = nd->mtu; return 0;
+  case NICCTL_RAW_DROPS:   *value = nd->rawq_drops; return 0;
+  case NICCTL_LINK:        *value = nd->link_up; return 0;
+  case NICCTL_SPEED:       *value = nd->link_up ? nd->speed : 0; return 0;
+  case NICCTL_DUPLEX:      *value = nd->link_up && nd->full_duplex; return 0;
+  case NICCTL_ARPQ_DROPS:  *value = nd->arpq_drops; return 0;
+  }
+  if(nd->get_param == 0)
+    return -1;
+  return nd->get_param(nd->driver, param, value);
+}
+
+int nic_set_param(struct nic_device *nd, int param, uint32_t value) {
+  switch(param) {
+  case NICCTL_POLL_BUDGET:
+    if(value == 0 || value > NIC_POLL_BUDGET_MAX)
+      return -1;
+    nd->poll_budget = value;
+    return 0;
+  case NICCTL_RX_INTR:
+  case NICCTL_RX_POLL:
+  case NICCTL_RAW_DROPS:
+  case NICCTL_LINK:
+  case NICCTL_SPEED:
+  case NICCTL_DUPLEX:
+  case NICCTL_ARPQ_DROPS:
+    return -1;
+  }
+  if(nd->set_param == 0)
+    return -1;
+  if(nd->set_param(nd->driver, param, value) < 0)
+    return -1;
+  //the driver accepted the new MTU, let upper layers size frames by it
+  if(param == NICCTL_MTU)
+    nd->mtu = value;
+  return 0;
 }
@@ -8,20 +8,180 @@
 
 #include "types.h"
 #include "arp_frame.h"
+#include "nicctl.h"
+
+struct pktbuf;
+
+#define ETHR_HDR_LEN    14
+#define ETHR_TYPE_ARP   0x0806
+#define ETHR_FCS_LEN    4
+//IEEE local experimental ether type, queued for nicrecv() as raw frames
+#define ETHR_TYPE_RAW   0x88B5
+
+//Payload bytes per frame. Jumbo frames go up to NIC_MAX_MTU
+#define NIC_MIN_MTU     68
+#define NIC_DEF_MTU     1500
+#define NIC_MAX_MTU     9000
+
+//Devices that can be loaded at once, and their interface names: eth0, eth1...
+#define NIC_MAX_DEVICES   8
+#define NIC_NAME_PREFIX   "eth"
+#define NIC_NAMELEN       8
+
+//Receive frames a driver handles in its interrupt handler before it
+//masks receive interrupts and leaves the rest to the poll thread
+#define NIC_INTR_BUDGET   16
+//Default frames per pass of the poll thread over one device
+#define NIC_POLL_BUDGET   64
+//Largest budget NICCTL_POLL_BUDGET accepts, a full receive ring of the
+//biggest size a driver allows
+#define NIC_POLL_BUDGET_MAX 4096
+
+//Timer ticks between hardware statistics updates
+#define NIC_STATS_TICKS   500
+//Timer ticks between runs of protocol timers (ARP aging)
+#define NIC_TIMER_TICKS   100
+
+//Raw frames a device holds for nicrecv() before it drops new ones
+#define NIC_RAWQ_MAX      256
+
+//Most fragments a gather transmit can take for one frame
+#define NIC_MAX_FRAGS   8
+
+//One piece of a frame handed to send_sg
+struct nic_frag {
+  uint8_t *buf;
+  uint16_t length;
+  uint8_t copy;   //copy into driver memory instead of referencing buf
+};
+
+//Device features, in nic_device.features
+#define NIC_F_TXCSUM    0x1   //can insert IP/TCP/UDP checksums on transmit
+#define NIC_F_RXCSUM    0x2   //verifies IP/TCP/UDP checksums on receive
+#define NIC_F_TSO       0x4   //segments large TCP sends itself
+
+//Transmit checksum offload request, see nic_send_csum()
+#define NIC_TXCSUM_IP   0x1
+#define NIC_TXCSUM_TCP  0x2
+#define NIC_TXCSUM_UDP  0x4
+
+struct nic_txcsum {
+  uint8_t flags;
+  uint8_t l3off;    //offset of the IPv4 header in the frame
+  uint8_t l4off;    //offset of the TCP/UDP header in the frame
+};
+
+//Large TCP send, see nic_send_tso()
+#define NIC_TSO_MAX       65536   //most payload bytes in one large send
+#define NIC_TSO_MAX_HDR   128     //longest Ethernet+IPv4+TCP header template
+#define NIC_TSO_SOFTWARE  -2      //send_tso can't take it, segment in software
+
+struct nic_tso {
+  uint8_t l3off;    //offset of the IPv4 header in the template
+  uint8_t l4off;    //offset of the TCP header in the template
+  uint16_t mss;     //payload bytes per segment
+};
+
+//Receive checksum status handed to nic_rx()
+#define NIC_RXCSUM_IP_OK  0x1   //hardware verified the IPv4 header checksum
+#define NIC_RXCSUM_L4_OK  0x2   //hardware verified the TCP/UDP checksum
 
 //Generic NIC device driver container
 struct nic_device {
+  char name[NIC_NAMELEN];   //interface name, set by register_device()
+  int index;                //position in nic_devices
   void *driver;
   uint8_t mac_addr[6];
-  void (*send_packet) (void *driver, uint8_t* pkt, uint16_t length);
-  void (*recv_packet) (void *driver, uint8_t* pkt, uint16_t length);
+  uint8_t irq_line;
+  uint32_t features;
+  uint32_t mtu;     //largest payload a frame may carry, see NICCTL_MTU
+  //link state as the driver last reported it through nic_link_change()
+  uint8_t link_up;
+  uint8_t full_duplex;
+  uint16_t speed;   //Mb/s
+  uint32_t ipaddr;  //IPv4 address, network byte order. 0 until configured
+  //queue a frame for transmit. returns 0 once queued, <0 if dropped
+  int (*send_packet) (void *driver, uint8_t* pkt, uint16_t length);
+  //queue n frames with one doorbell. returns #frames queued
+  int (*send_batch) (void *driver, uint8_t** pkts, uint16_t* lengths, int n);
+  //queue a caller owned kernel buffer without copying it. done(arg) is
+  //called once the device has finished with it. 0 if queued, <0 if rejected
+  int (*send_zc) (void *driver, uint8_t* pkt, uint16_t length,
+                  void (*done)(void *arg), void *arg);
+  //queue a frame asking the device to fill in checksums. NIC_F_TXCSUM only
+  int (*send_csum) (void *driver, uint8_t* pkt, uint16_t length, struct nic_txcsum *csum);
+  //queue a large TCP send for the device to segment. NIC_F_TSO only.
+  //done(arg) is called once, on completion or right away if rejected,
+  //except for NIC_TSO_SOFTWARE (needs more descriptors than the ring has)
+  //where payload is left untouched for the caller to segment
+  int (*send_tso) (void *driver, uint8_t* hdr, uint16_t hdrlen,
+                   uint8_t* payload, uint32_t paylen, struct nic_tso *tso,
+                   void (*done)(void *arg), void *arg);
+  //queue one frame gathered from nfrags buffers. done(arg) as for send_zc
+  int (*send_sg) (void *driver, struct nic_frag *frags, int nfrags,
+                  void (*done)(void *arg), void *arg);
+  //poll the receive ring, handing up to budget frames to nic_rx(). returns
+  //#frames; fewer than budget means drained and receive interrupts back on
+  int (*recv_packet) (struct nic_device *nd, int budget);
+  //interrupt handler for irq_line
+  void (*intr) (struct nic_device *nd);
+  //unmask the device's interrupts and route irq_line. called once the
+  //device is registered and the nic layer is initialised, not before
+  void (*enable_intr) (struct nic_device *nd);
+  //let frames to a unicast or multicast address in/stop doing so, on top
+  //of mac_addr and broadcast. 0 on success, <0 if not filtered
+  int (*add_addr) (void *driver, uint8_t *addr);
+  int (*del_addr) (void *driver, uint8_t *addr);
+  //fold hardware counters into software ones before they can wrap. run
+  //every NIC_STATS_TICKS from the poll thread
+  void (*update_stats) (void *driver);
+  //copy out up to n NICSTAT_* counters. returns #counters
+  int (*get_stats) (void *driver, uint64_t *stats, int n);
+  //read/tune a NICCTL_* parameter. 0 on success, <0 if unsupported or invalid
+  int (*get_param) (void *driver, int param, uint32_t *value);
+  int (*set_param) (void *driver, int param, uint32_t value);
+
+  //hybrid interrupt/poll receive, see nic_schedule_poll()
+  int poll_scheduled;
+  int poll_budget;          //frames per poll pass
+  uint32_t rx_intr_frames;  //frames handled straight from the interrupt
+  uint32_t rx_poll_frames;  //frames handled by the poll thread
+
+  //received ETHR_TYPE_RAW frames waiting for nic_raw_recv()
+  struct pktbuf *rawq_head, *rawq_tail;
+  int rawq_len;
+  uint32_t rawq_drops;
+
+  //frames arp_output() dropped while their neighbor resolved, see NICCTL_ARPQ_DROPS
+  uint32_t arpq_drops;
 };
 
-//Holds the instances of nic_devices for loaded devices
-//Lets say for now there can't be more than 1 loaded NIC device
-struct nic_device nic_devices[1];
+//Holds the instances of nic_devices for loaded devices, in order of
+//registration. The first nic_ndevices entries are in use.
+extern struct nic_device nic_devices[NIC_MAX_DEVICES];
+extern int nic_ndevices;
 
-void register_device(struct nic_device nd);
+void nic_init(void);
+void nic_claim_irq(int irq);
+int register_device(struct nic_device nd);
 int get_device(char* interface, struct nic_device** nd);
+int get_device_by_index(int index, struct nic_device** nd);
+int nic_send_batch(struct nic_device *nd, uint8_t **pkts, uint16_t *lengths, int n);
+int nic_send_csum(struct nic_device *nd, uint8_t *pkt, uint16_t length, struct nic_txcsum *csum);
+int nic_send_tso(struct nic_device *nd, uint8_t *hdr, uint16_t hdrlen,
+                 uint8_t *payload, uint32_t paylen, struct nic_tso *tso,
+                 void (*done)(void *arg), void *arg);
+uint16_t nic_cksum(uint32_t sum, uint8_t *buf, int length);
+void nic_schedule_poll(struct nic_device *nd);
+void nic_link_change(struct nic_device *nd, int up, int speed, int full_duplex);
+void nic_set_ipaddr(struct nic_device *nd, uint32_t ipaddr);
+int nic_add_addr(struct nic_device *nd, uint8_t *addr);
+int nic_del_addr(struct nic_device *nd, uint8_t *addr);
+int nic_raw_send(struct nic_device *nd, uint8_t *frame, uint16_t length);
+int nic_raw_recv(struct nic_device *nd, uint8_t *buf, int length);
+int nic_get_stats(struct nic_device *nd, uint64_t *stats, int n);
+int nic_get_param(struct nic_device *nd, int param, uint32_t *value);
+int nic_set_param(struct nic_device *nd, int param, uint32_t value);
+void nic_rx(struct nic_device *nd, struct pktbuf *pb, int rxcsum);
 
 #endif
@@ -0,0 +1,1648 @@
+
+_nicbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+      return -1;
+  }
+  return uptime() - start;
+}
+
+int main(int argc, char *argv[]) {
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 28             	sub    $0x28,%esp
+  14:	8b 39                	mov    (%ecx),%edi
+  16:	8b 51 04             	mov    0x4(%ecx),%edx
+  char *interface;
+  int frames = 1000, size = 1514, t;
+  uint mtu, loopback;
+
+  if(argc < 2 || argc > 4) {
+  19:	8d 47 fe             	lea    -0x2(%edi),%eax
+  1c:	83 f8 02             	cmp    $0x2,%eax
+  1f:	0f 87 94 00 00 00    	ja     b9 <main+0xb9>
+    printf(2, "usage: nicbench interface [frames [size]]\n");
+    exit();
+  }
+  interface = argv[1];
+  25:	8b 5a 04             	mov    0x4(%edx),%ebx
+  if(argc > 2)
+  28:	83 ff 02             	cmp    $0x2,%edi
+  2b:	75 3f                	jne    6c <main+0x6c>
+    frames = atoi(argv[2]);
+  if(argc > 3)
+    size = atoi(argv[3]);
+  if(nicget(interface, NICCTL_MTU, &mtu) < 0)
+  2d:	50                   	push   %eax
+  2e:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  int frames = 1000, size = 1514, t;
+  31:	be ea 05 00 00       	mov    $0x5ea,%esi
+  if(nicget(interface, NICCTL_MTU, &mtu) < 0)
+  36:	50                   	push   %eax
+  37:	6a 10                	push   $0x10
+  39:	53                   	push   %ebx
+  3a:	e8 95 06 00 00       	call   6d4 <nicget>
+  int frames = 1000, size = 1514, t;
+  3f:	c7 45 d4 e8 03 00 00 	movl   $0x3e8,-0x2c(%ebp)
+  if(nicget(interface, NICCTL_MTU, &mtu) < 0)
+  46:	83 c4 10             	add    $0x10,%esp
+  49:	85 c0                	test   %eax,%eax
+  4b:	78 65                	js     b2 <main+0xb2>
+    mtu = 0;
+  if(frames <= 0 || size < ETHR_HDR_LEN + 4 || size > ETHR_HDR_LEN + mtu) {
+  4d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  50:	83 c0 0e             	add    $0xe,%eax
+  53:	39 f0                	cmp    %esi,%eax
+  55:	73 75                	jae    cc <main+0xcc>
+    printf(2, "nicbench: bad frame count or size (mtu %d)\n", mtu);
+  57:	51                   	push   %ecx
+  58:	ff 75 e0             	push   -0x20(%ebp)
+  5b:	68 34 0b 00 00       	push   $0xb34
+  60:	6a 02                	push   $0x2
+  62:	e8 79 07 00 00       	call   7e0 <printf>
+    exit();
+  67:	e8 c0 05 00 00       	call   62c <exit>
+    frames = atoi(argv[2]);
+  6c:	83 ec 0c             	sub    $0xc,%esp
+  6f:	ff 72 08             	push   0x8(%edx)
+  int frames = 1000, size = 1514, t;
+  72:	be ea 05 00 00       	mov    $0x5ea,%esi
+    frames = atoi(argv[2]);
+  77:	89 55 d0             	mov    %edx,-0x30(%ebp)
+  7a:	e8 11 05 00 00       	call   590 <atoi>
+  if(argc > 3)
+  7f:	83 c4 10             	add    $0x10,%esp
+  82:	83 ff 04             	cmp    $0x4,%edi
+  85:	8b 55 d0             	mov    -0x30(%ebp),%edx
+    frames = atoi(argv[2]);
+  88:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  if(argc > 3)
+  8b:	0f 84 57 02 00 00    	je     2e8 <main+0x2e8>
+  if(nicget(interface, NICCTL_MTU, &mtu) < 0)
+  91:	50                   	push   %eax
+  92:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  95:	50                   	push   %eax
+  96:	6a 10                	push   $0x10
+  98:	53                   	push   %ebx
+  99:	e8 36 06 00 00       	call   6d4 <nicget>
+  9e:	83 c4 10             	add    $0x10,%esp
+  a1:	85 c0                	test   %eax,%eax
+  a3:	78 0d                	js     b2 <main+0xb2>
+  if(frames <= 0 || size < ETHR_HDR_LEN + 4 || size > ETHR_HDR_LEN + mtu) {
+  a5:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  a9:	7e ac                	jle    57 <main+0x57>
+  ab:	83 fe 11             	cmp    $0x11,%esi
+  ae:	7f 9d                	jg     4d <main+0x4d>
+  b0:	eb a5                	jmp    57 <main+0x57>
+    mtu = 0;
+  b2:	31 ff                	xor    %edi,%edi
+  b4:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  b7:	eb ec                	jmp    a5 <main+0xa5>
+    printf(2, "usage: nicbench interface [frames [size]]\n");
+  b9:	50                   	push   %eax
+  ba:	50                   	push   %eax
+  bb:	68 08 0b 00 00       	push   $0xb08
+  c0:	6a 02                	push   $0x2
+  c2:	e8 19 07 00 00       	call   7e0 <printf>
+    exit();
+  c7:	e8 60 05 00 00       	call   62c <exit>
+  }
+
+  if(nicget(interface, NICCTL_LOOPBACK, &loopback) < 0)
+  cc:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  cf:	52                   	push   %edx
+  d0:	50                   	push   %eax
+  d1:	6a 11                	push   $0x11
+  d3:	53                   	push   %ebx
+  d4:	e8 fb 05 00 00       	call   6d4 <nicget>
+  d9:	83 c4 10             	add    $0x10,%esp
+  dc:	85 c0                	test   %eax,%eax
+  de:	79 05                	jns    e5 <main+0xe5>
+    loopback = 0;
+  e0:	31 c0                	xor    %eax,%eax
+  e2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(nicset(interface, NICCTL_LOOPBACK, 1) < 0) {
+  e5:	50                   	push   %eax
+  e6:	6a 01                	push   $0x1
+  e8:	6a 11                	push   $0x11
+  ea:	53                   	push   %ebx
+  eb:	e8 ec 05 00 00       	call   6dc <nicset>
+  f0:	83 c4 10             	add    $0x10,%esp
+  f3:	85 c0                	test   %eax,%eax
+  f5:	0f 88 02 02 00 00    	js     2fd <main+0x2fd>
+  memset(txbuf, 0, size);
+  fb:	50                   	push   %eax
+  fc:	56                   	push   %esi
+  fd:	6a 00                	push   $0x0
+  ff:	68 20 33 00 00       	push   $0x3320
+ 104:	e8 c7 02 00 00       	call   3d0 <memset>
+  memset(txbuf, 0xff, 6);
+ 109:	83 c4 0c             	add    $0xc,%esp
+ 10c:	6a 06                	push   $0x6
+ 10e:	68 ff 00 00 00       	push   $0xff
+ 113:	68 20 33 00 00       	push   $0x3320
+ 118:	e8 b3 02 00 00       	call   3d0 <memset>
+  txbuf[12] = 0x88;
+ 11d:	0f b7 05 5e 0c 00 00 	movzwl 0xc5e,%eax
+  for(int i = ETHR_HDR_LEN + 4; i < size; i++)
+ 124:	83 c4 10             	add    $0x10,%esp
+  txbuf[12] = 0x88;
+ 127:	66 a3 2c 33 00 00    	mov    %ax,0x332c
+  for(int i = ETHR_HDR_LEN + 4; i < size; i++)
+ 12d:	83 fe 12             	cmp    $0x12,%esi
+ 130:	74 1b                	je     14d <main+0x14d>
+ 132:	b8 12 00 00 00       	mov    $0x12,%eax
+ 137:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 13e:	66 90                	xchg   %ax,%ax
+    txbuf[i] = i;
+ 140:	88 80 20 33 00 00    	mov    %al,0x3320(%eax)
+  for(int i = ETHR_HDR_LEN + 4; i < size; i++)
+ 146:	83 c0 01             	add    $0x1,%eax
+ 149:	39 f0                	cmp    %esi,%eax
+ 14b:	75 f3                	jne    140 <main+0x140>
+    printf(2, "nicbench: %s can't loop back\n", interface);
+    exit();
+  }
+  mkframe(size);
+
+  printf(1, "%d frames of %d bytes, %d ticks/s\n", frames, size, HZ);
+ 14d:	83 ec 0c             	sub    $0xc,%esp
+  int sent = 0, got = 0;
+ 150:	31 ff                	xor    %edi,%edi
+  printf(1, "%d frames of %d bytes, %d ticks/s\n", frames, size, HZ);
+ 152:	6a 64                	push   $0x64
+ 154:	56                   	push   %esi
+ 155:	ff 75 d4             	push   -0x2c(%ebp)
+ 158:	68 60 0b 00 00       	push   $0xb60
+ 15d:	6a 01                	push   $0x1
+ 15f:	e8 7c 06 00 00       	call   7e0 <printf>
+  int start = uptime();
+ 164:	83 c4 20             	add    $0x20,%esp
+ 167:	e8 58 05 00 00       	call   6c4 <uptime>
+ 16c:	89 75 d0             	mov    %esi,-0x30(%ebp)
+  int sent = 0, got = 0;
+ 16f:	31 c9                	xor    %ecx,%ecx
+  int start = uptime();
+ 171:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  while(got < frames) {
+ 174:	89 ca                	mov    %ecx,%edx
+    while(sent < frames && sent - got < WINDOW) {
+ 176:	39 7d d4             	cmp    %edi,-0x2c(%ebp)
+ 179:	0f 8e db 00 00 00    	jle    25a <main+0x25a>
+ 17f:	89 fe                	mov    %edi,%esi
+ 181:	29 d6                	sub    %edx,%esi
+ 183:	83 fe 3f             	cmp    $0x3f,%esi
+ 186:	0f 8f ce 00 00 00    	jg     25a <main+0x25a>
+ 18c:	89 55 cc             	mov    %edx,-0x34(%ebp)
+ 18f:	eb 21                	jmp    1b2 <main+0x1b2>
+ 191:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 198:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+      sent++;
+ 19b:	83 c7 01             	add    $0x1,%edi
+    while(sent < frames && sent - got < WINDOW) {
+ 19e:	39 c7                	cmp    %eax,%edi
+ 1a0:	0f 84 b1 00 00 00    	je     257 <main+0x257>
+ 1a6:	83 c6 01             	add    $0x1,%esi
+ 1a9:	83 fe 40             	cmp    $0x40,%esi
+ 1ac:	0f 84 a5 00 00 00    	je     257 <main+0x257>
+  return nicsend(interface, txbuf, size);
+ 1b2:	83 ec 04             	sub    $0x4,%esp
+ 1b5:	ff 75 d0             	push   -0x30(%ebp)
+ 1b8:	68 20 33 00 00       	push   $0x3320
+ 1bd:	53                   	push   %ebx
+  *(int*)&txbuf[ETHR_HDR_LEN] = seq;
+ 1be:	89 3d 2e 33 00 00    	mov    %edi,0x332e
+  return nicsend(interface, txbuf, size);
+ 1c4:	e8 23 05 00 00       	call   6ec <nicsend>
+      if(xmit(interface, sent, size) < 0)
+ 1c9:	83 c4 10             	add    $0x10,%esp
+ 1cc:	85 c0                	test   %eax,%eax
+ 1ce:	79 c8                	jns    198 <main+0x198>
+ 1d0:	8b 75 d0             	mov    -0x30(%ebp),%esi
+  if((t = throughput(interface, frames, size)) < 0)
+    printf(2, "nicbench: throughput run failed\n");
+ 1d3:	57                   	push   %edi
+ 1d4:	57                   	push   %edi
+ 1d5:	68 84 0b 00 00       	push   $0xb84
+ 1da:	6a 02                	push   $0x2
+ 1dc:	e8 ff 05 00 00       	call   7e0 <printf>
+ 1e1:	83 c4 10             	add    $0x10,%esp
+  int start = uptime();
+ 1e4:	e8 db 04 00 00       	call   6c4 <uptime>
+  for(int i = 0; i < frames; i++) {
+ 1e9:	31 ff                	xor    %edi,%edi
+  int start = uptime();
+ 1eb:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  for(int i = 0; i < frames; i++) {
+ 1ee:	eb 35                	jmp    225 <main+0x225>
+  int n = nicrecv(interface, rxbuf, sizeof(rxbuf));
+ 1f0:	83 ec 04             	sub    $0x4,%esp
+ 1f3:	68 36 23 00 00       	push   $0x2336
+ 1f8:	68 e0 0f 00 00       	push   $0xfe0
+ 1fd:	53                   	push   %ebx
+ 1fe:	e8 f1 04 00 00       	call   6f4 <nicrecv>
+  if(n < 0)
+ 203:	83 c4 10             	add    $0x10,%esp
+ 206:	85 c0                	test   %eax,%eax
+ 208:	78 37                	js     241 <main+0x241>
+  if(*(int*)&rxbuf[ETHR_HDR_LEN] != seq)
+ 20a:	39 3d ee 0f 00 00    	cmp    %edi,0xfee
+ 210:	74 07                	je     219 <main+0x219>
+    errors++;
+ 212:	83 05 c0 0f 00 00 01 	addl   $0x1,0xfc0
+  for(int i = 0; i < frames; i++) {
+ 219:	83 c7 01             	add    $0x1,%edi
+ 21c:	39 7d d4             	cmp    %edi,-0x2c(%ebp)
+ 21f:	0f 8e eb 00 00 00    	jle    310 <main+0x310>
+  return nicsend(interface, txbuf, size);
+ 225:	83 ec 04             	sub    $0x4,%esp
+  *(int*)&txbuf[ETHR_HDR_LEN] = seq;
+ 228:	89 3d 2e 33 00 00    	mov    %edi,0x332e
+  return nicsend(interface, txbuf, size);
+ 22e:	56                   	push   %esi
+ 22f:	68 20 33 00 00       	push   $0x3320
+ 234:	53                   	push   %ebx
+ 235:	e8 b2 04 00 00       	call   6ec <nicsend>
+    if(xmit(interface, i, size) < 0 || recv(interface, i) < 0)
+ 23a:	83 c4 10             	add    $0x10,%esp
+ 23d:	85 c0                	test   %eax,%eax
+ 23f:	79 af                	jns    1f0 <main+0x1f0>
+      t = 1;
+    printf(1, "throughput: %d ticks, %d frames/s, %d KB/s\n",
+           t, frames * HZ / t, frames * (size / 16) / 64 * HZ / t);
+  }
+  if((t = latency(interface, frames, size)) < 0)
+    printf(2, "nicbench: latency run failed\n");
+ 241:	56                   	push   %esi
+ 242:	56                   	push   %esi
+ 243:	68 40 0c 00 00       	push   $0xc40
+ 248:	6a 02                	push   $0x2
+ 24a:	e8 91 05 00 00       	call   7e0 <printf>
+ 24f:	83 c4 10             	add    $0x10,%esp
+ 252:	e9 e6 00 00 00       	jmp    33d <main+0x33d>
+ 257:	8b 55 cc             	mov    -0x34(%ebp),%edx
+ 25a:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  int n = nicrecv(interface, rxbuf, sizeof(rxbuf));
+ 25d:	50                   	push   %eax
+ 25e:	68 36 23 00 00       	push   $0x2336
+ 263:	68 e0 0f 00 00       	push   $0xfe0
+ 268:	53                   	push   %ebx
+ 269:	e8 86 04 00 00       	call   6f4 <nicrecv>
+  if(n < 0)
+ 26e:	83 c4 10             	add    $0x10,%esp
+ 271:	85 c0                	test   %eax,%eax
+ 273:	0f 88 57 ff ff ff    	js     1d0 <main+0x1d0>
+  if(*(int*)&rxbuf[ETHR_HDR_LEN] != seq)
+ 279:	8b 55 cc             	mov    -0x34(%ebp),%edx
+ 27c:	39 15 ee 0f 00 00    	cmp    %edx,0xfee
+ 282:	74 07                	je     28b <main+0x28b>
+    errors++;
+ 284:	83 05 c0 0f 00 00 01 	addl   $0x1,0xfc0
+    got++;
+ 28b:	83 c2 01             	add    $0x1,%edx
+  while(got < frames) {
+ 28e:	39 55 d4             	cmp    %edx,-0x2c(%ebp)
+ 291:	0f 8f df fe ff ff    	jg     176 <main+0x176>
+  return uptime() - start;
+ 297:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 29a:	e8 25 04 00 00       	call   6c4 <uptime>
+  if((t = throughput(interface, frames, size)) < 0)
+ 29f:	8b 55 c8             	mov    -0x38(%ebp),%edx
+ 2a2:	29 d0                	sub    %edx,%eax
+ 2a4:	89 c1                	mov    %eax,%ecx
+ 2a6:	0f 88 27 ff ff ff    	js     1d3 <main+0x1d3>
+      t = 1;
+ 2ac:	b8 01 00 00 00       	mov    $0x1,%eax
+           t, frames * HZ / t, frames * (size / 16) / 64 * HZ / t);
+ 2b1:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+      t = 1;
+ 2b4:	0f 44 c8             	cmove  %eax,%ecx
+           t, frames * HZ / t, frames * (size / 16) / 64 * HZ / t);
+ 2b7:	89 f0                	mov    %esi,%eax
+    printf(1, "throughput: %d ticks, %d frames/s, %d KB/s\n",
+ 2b9:	83 ec 0c             	sub    $0xc,%esp
+           t, frames * HZ / t, frames * (size / 16) / 64 * HZ / t);
+ 2bc:	c1 f8 04             	sar    $0x4,%eax
+ 2bf:	0f af c7             	imul   %edi,%eax
+ 2c2:	c1 f8 06             	sar    $0x6,%eax
+ 2c5:	6b c0 64             	imul   $0x64,%eax,%eax
+    printf(1, "throughput: %d ticks, %d frames/s, %d KB/s\n",
+ 2c8:	99                   	cltd
+ 2c9:	f7 f9                	idiv   %ecx
+ 2cb:	50                   	push   %eax
+           t, frames * HZ / t, frames * (size / 16) / 64 * HZ / t);
+ 2cc:	6b c7 64             	imul   $0x64,%edi,%eax
+    printf(1, "throughput: %d ticks, %d frames/s, %d KB/s\n",
+ 2cf:	99                   	cltd
+ 2d0:	f7 f9                	idiv   %ecx
+ 2d2:	50                   	push   %eax
+ 2d3:	51                   	push   %ecx
+ 2d4:	68 a8 0b 00 00       	push   $0xba8
+ 2d9:	6a 01                	push   $0x1
+ 2db:	e8 00 05 00 00       	call   7e0 <printf>
+ 2e0:	83 c4 20             	add    $0x20,%esp
+ 2e3:	e9 fc fe ff ff       	jmp    1e4 <main+0x1e4>
+    size = atoi(argv[3]);
+ 2e8:	83 ec 0c             	sub    $0xc,%esp
+ 2eb:	ff 72 0c             	push   0xc(%edx)
+ 2ee:	e8 9d 02 00 00       	call   590 <atoi>
+ 2f3:	83 c4 10             	add    $0x10,%esp
+ 2f6:	89 c6                	mov    %eax,%esi
+ 2f8:	e9 94 fd ff ff       	jmp    91 <main+0x91>
+    printf(2, "nicbench: %s can't loop back\n", interface);
+ 2fd:	50                   	push   %eax
+ 2fe:	53                   	push   %ebx
+ 2ff:	68 22 0c 00 00       	push   $0xc22
+ 304:	6a 02                	push   $0x2
+ 306:	e8 d5 04 00 00       	call   7e0 <printf>
+    exit();
+ 30b:	e8 1c 03 00 00       	call   62c <exit>
+  return uptime() - start;
+ 310:	e8 af 03 00 00       	call   6c4 <uptime>
+  if((t = latency(interface, frames, size)) < 0)
+ 315:	8b 55 d0             	mov    -0x30(%ebp),%edx
+ 318:	29 d0                	sub    %edx,%eax
+ 31a:	89 c1                	mov    %eax,%ecx
+ 31c:	0f 88 1f ff ff ff    	js     241 <main+0x241>
+  else
+    printf(1, "latency: %d ticks, %d us per round trip\n",
+           t, t * (1000000 / HZ) / frames);
+ 322:	69 c0 10 27 00 00    	imul   $0x2710,%eax,%eax
+    printf(1, "latency: %d ticks, %d us per round trip\n",
+ 328:	99                   	cltd
+ 329:	f7 7d d4             	idivl  -0x2c(%ebp)
+ 32c:	50                   	push   %eax
+ 32d:	51                   	push   %ecx
+ 32e:	68 d4 0b 00 00       	push   $0xbd4
+ 333:	6a 01                	push   $0x1
+ 335:	e8 a6 04 00 00       	call   7e0 <printf>
+ 33a:	83 c4 10             	add    $0x10,%esp
+  if(errors)
+ 33d:	a1 c0 0f 00 00       	mov    0xfc0,%eax
+ 342:	85 c0                	test   %eax,%eax
+ 344:	75 11                	jne    357 <main+0x357>
+    printf(1, "%d frames came back out of order\n", errors);
+
+  nicset(interface, NICCTL_LOOPBACK, loopback);
+ 346:	52                   	push   %edx
+ 347:	ff 75 e4             	push   -0x1c(%ebp)
+ 34a:	6a 11                	push   $0x11
+ 34c:	53                   	push   %ebx
+ 34d:	e8 8a 03 00 00       	call   6dc <nicset>
+  exit();
+ 352:	e8 d5 02 00 00       	call   62c <exit>
+    printf(1, "%d frames came back out of order\n", errors);
+ 357:	51                   	push   %ecx
+ 358:	50                   	push   %eax
+ 359:	68 00 0c 00 00       	push   $0xc00
+ 35e:	6a 01                	push   $0x1
+ 360:	e8 7b 04 00 00       	call   7e0 <printf>
+ 365:	83 c4 10             	add    $0x10,%esp
+ 368:	eb dc                	jmp    346 <main+0x346>
+ 36a:	66 90                	xchg   %ax,%ax
+ 36c:	66 90                	xchg   %ax,%ax
+ 36e:	66 90                	xchg   %ax,%ax
+
+00000370 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 370:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 371:	31 c0                	xor    %eax,%eax
+{
+ 373:	89 e5                	mov    %esp,%ebp
+ 375:	53                   	push   %ebx
+ 376:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 379:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 37c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 380:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 384:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 387:	83 c0 01             	add    $0x1,%eax
+ 38a:	84 d2                	test   %dl,%dl
+ 38c:	75 f2                	jne    380 <strcpy+0x10>
+    ;
+  return os;
+}
+ 38e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 391:	89 c8                	mov    %ecx,%eax
+ 393:	c9                   	leave
+ 394:	c3                   	ret
+ 395:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 39c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003a0 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 3a0:	55                   	push   %ebp
+ 3a1:	89 e5                	mov    %esp,%ebp
+ 3a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 3a6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 3a9:	74 15                	je     3c0 <strlen+0x20>
+ 3ab:	31 c0                	xor    %eax,%eax
+ 3ad:	8d 76 00             	lea    0x0(%esi),%esi
+ 3b0:	83 c0 01             	add    $0x1,%eax
+ 3b3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 3b7:	89 c1                	mov    %eax,%ecx
+ 3b9:	75 f5                	jne    3b0 <strlen+0x10>
+    ;
+  return n;
+}
+ 3bb:	89 c8                	mov    %ecx,%eax
+ 3bd:	5d                   	pop    %ebp
+ 3be:	c3                   	ret
+ 3bf:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 3c0:	31 c9                	xor    %ecx,%ecx
+}
+ 3c2:	5d                   	pop    %ebp
+ 3c3:	89 c8                	mov    %ecx,%eax
+ 3c5:	c3                   	ret
+ 3c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000003d0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 3d0:	55                   	push   %ebp
+ 3d1:	89 e5                	mov    %esp,%ebp
+ 3d3:	57                   	push   %edi
+ 3d4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 3d7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 3da:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3dd:	89 d7                	mov    %edx,%edi
+ 3df:	fc                   	cld
+ 3e0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 3e2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 3e5:	89 d0                	mov    %edx,%eax
+ 3e7:	c9                   	leave
+ 3e8:	c3                   	ret
+ 3e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000003f0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 3f0:	55                   	push   %ebp
+ 3f1:	89 e5                	mov    %esp,%ebp
+ 3f3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3f6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 3fa:	0f b6 10             	movzbl (%eax),%edx
+ 3fd:	84 d2                	test   %dl,%dl
+ 3ff:	75 12                	jne    413 <strchr+0x23>
+ 401:	eb 1d                	jmp    420 <strchr+0x30>
+ 403:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 407:	90                   	nop
+ 408:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 40c:	83 c0 01             	add    $0x1,%eax
+ 40f:	84 d2                	test   %dl,%dl
+ 411:	74 0d                	je     420 <strchr+0x30>
+    if(*s == c)
+ 413:	38 d1                	cmp    %dl,%cl
+ 415:	75 f1                	jne    408 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 417:	5d                   	pop    %ebp
+ 418:	c3                   	ret
+ 419:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 420:	31 c0                	xor    %eax,%eax
+}
+ 422:	5d                   	pop    %ebp
+ 423:	c3                   	ret
+ 424:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 42b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 42f:	90                   	nop
+
+00000430 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 430:	55                   	push   %ebp
+ 431:	89 e5                	mov    %esp,%ebp
+ 433:	57                   	push   %edi
+ 434:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 435:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 438:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 439:	31 db                	xor    %ebx,%ebx
+{
+ 43b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 43e:	eb 27                	jmp    467 <gets+0x37>
+    cc = read(0, &c, 1);
+ 440:	83 ec 04             	sub    $0x4,%esp
+ 443:	6a 01                	push   $0x1
+ 445:	56                   	push   %esi
+ 446:	6a 00                	push   $0x0
+ 448:	e8 f7 01 00 00       	call   644 <read>
+    if(cc < 1)
+ 44d:	83 c4 10             	add    $0x10,%esp
+ 450:	85 c0                	test   %eax,%eax
+ 452:	7e 1d                	jle    471 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 454:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 458:	8b 55 08             	mov    0x8(%ebp),%edx
+ 45b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 45f:	3c 0a                	cmp    $0xa,%al
+ 461:	74 10                	je     473 <gets+0x43>
+ 463:	3c 0d                	cmp    $0xd,%al
+ 465:	74 0c                	je     473 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 467:	89 df                	mov    %ebx,%edi
+ 469:	83 c3 01             	add    $0x1,%ebx
+ 46c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 46f:	7c cf                	jl     440 <gets+0x10>
+ 471:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 473:	8b 45 08             	mov    0x8(%ebp),%eax
+ 476:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 47a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 47d:	5b                   	pop    %ebx
+ 47e:	5e                   	pop    %esi
+ 47f:	5f                   	pop    %edi
+ 480:	5d                   	pop    %ebp
+ 481:	c3                   	ret
+ 482:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 489:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000490 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 490:	55                   	push   %ebp
+ 491:	89 e5                	mov    %esp,%ebp
+ 493:	56                   	push   %esi
+ 494:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 495:	83 ec 08             	sub    $0x8,%esp
+ 498:	6a 00                	push   $0x0
+ 49a:	ff 75 08             	push   0x8(%ebp)
+ 49d:	e8 ca 01 00 00       	call   66c <open>
+  if(fd < 0)
+ 4a2:	83 c4 10             	add    $0x10,%esp
+ 4a5:	85 c0                	test   %eax,%eax
+ 4a7:	78 27                	js     4d0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 4a9:	83 ec 08             	sub    $0x8,%esp
+ 4ac:	ff 75 0c             	push   0xc(%ebp)
+ 4af:	89 c3                	mov    %eax,%ebx
+ 4b1:	50                   	push   %eax
+ 4b2:	e8 cd 01 00 00       	call   684 <fstat>
+  close(fd);
+ 4b7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 4ba:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 4bc:	e8 93 01 00 00       	call   654 <close>
+  return r;
+ 4c1:	83 c4 10             	add    $0x10,%esp
+}
+ 4c4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 4c7:	89 f0                	mov    %esi,%eax
+ 4c9:	5b                   	pop    %ebx
+ 4ca:	5e                   	pop    %esi
+ 4cb:	5d                   	pop    %ebp
+ 4cc:	c3                   	ret
+ 4cd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 4d0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 4d5:	eb ed                	jmp    4c4 <stat+0x34>
+ 4d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4de:	66 90                	xchg   %ax,%ax
+
+000004e0 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 4e0:	55                   	push   %ebp
+ 4e1:	89 e5                	mov    %esp,%ebp
+ 4e3:	57                   	push   %edi
+ 4e4:	56                   	push   %esi
+ 4e5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 4e8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 4eb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 4ee:	85 c0                	test   %eax,%eax
+ 4f0:	7e 13                	jle    505 <memmove+0x25>
+ 4f2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 4f4:	89 d7                	mov    %edx,%edi
+ 4f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4fd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 500:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 501:	39 f8                	cmp    %edi,%eax
+ 503:	75 fb                	jne    500 <memmove+0x20>
+  return vdst;
+}
+ 505:	5e                   	pop    %esi
+ 506:	89 d0                	mov    %edx,%eax
+ 508:	5f                   	pop    %edi
+ 509:	5d                   	pop    %ebp
+ 50a:	c3                   	ret
+ 50b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 50f:	90                   	nop
+
+00000510 <parseip>:
+
+// a.b.c.d to network byte order. -1 if malformed
+int
+parseip(char *s, uint *addr)
+{
+ 510:	55                   	push   %ebp
+ 511:	89 e5                	mov    %esp,%ebp
+ 513:	57                   	push   %edi
+  uint8_t *b = (uint8_t*)addr;
+  int v;
+
+  for(int i = 0; i < 4; i++) {
+ 514:	31 ff                	xor    %edi,%edi
+{
+ 516:	56                   	push   %esi
+ 517:	53                   	push   %ebx
+ 518:	8b 55 08             	mov    0x8(%ebp),%edx
+    if(*s < '0' || *s > '9')
+ 51b:	0f be 02             	movsbl (%edx),%eax
+ 51e:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 521:	80 f9 09             	cmp    $0x9,%cl
+ 524:	77 59                	ja     57f <parseip+0x6f>
+      return -1;
+    for(v = 0; *s >= '0' && *s <= '9'; s++)
+ 526:	31 c9                	xor    %ecx,%ecx
+ 528:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 52f:	90                   	nop
+      v = v * 10 + *s - '0';
+ 530:	89 d6                	mov    %edx,%esi
+ 532:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    for(v = 0; *s >= '0' && *s <= '9'; s++)
+ 535:	83 c2 01             	add    $0x1,%edx
+      v = v * 10 + *s - '0';
+ 538:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+    for(v = 0; *s >= '0' && *s <= '9'; s++)
+ 53c:	0f be 02             	movsbl (%edx),%eax
+ 53f:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 542:	80 fb 09             	cmp    $0x9,%bl
+ 545:	76 e9                	jbe    530 <parseip+0x20>
+    if(v > 255 || *s != (i < 3 ? '.' : '\0'))
+ 547:	81 f9 ff 00 00 00    	cmp    $0xff,%ecx
+ 54d:	7f 30                	jg     57f <parseip+0x6f>
+ 54f:	83 ff 03             	cmp    $0x3,%edi
+ 552:	74 1c                	je     570 <parseip+0x60>
+ 554:	83 f8 2e             	cmp    $0x2e,%eax
+ 557:	75 26                	jne    57f <parseip+0x6f>
+      return -1;
+    b[i] = v;
+ 559:	8b 45 0c             	mov    0xc(%ebp),%eax
+    s++;
+ 55c:	8d 56 02             	lea    0x2(%esi),%edx
+    b[i] = v;
+ 55f:	88 0c 38             	mov    %cl,(%eax,%edi,1)
+  for(int i = 0; i < 4; i++) {
+ 562:	83 c7 01             	add    $0x1,%edi
+ 565:	eb b4                	jmp    51b <parseip+0xb>
+ 567:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 56e:	66 90                	xchg   %ax,%ax
+    if(v > 255 || *s != (i < 3 ? '.' : '\0'))
+ 570:	85 c0                	test   %eax,%eax
+ 572:	75 0b                	jne    57f <parseip+0x6f>
+    b[i] = v;
+ 574:	8b 7d 0c             	mov    0xc(%ebp),%edi
+ 577:	88 4f 03             	mov    %cl,0x3(%edi)
+  }
+  return 0;
+}
+ 57a:	5b                   	pop    %ebx
+ 57b:	5e                   	pop    %esi
+ 57c:	5f                   	pop    %edi
+ 57d:	5d                   	pop    %ebp
+ 57e:	c3                   	ret
+ 57f:	5b                   	pop    %ebx
+      return -1;
+ 580:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+ 585:	5e                   	pop    %esi
+ 586:	5f                   	pop    %edi
+ 587:	5d                   	pop    %ebp
+ 588:	c3                   	ret
+ 589:	66 90                	xchg   %ax,%ax
+ 58b:	66 90                	xchg   %ax,%ax
+ 58d:	66 90                	xchg   %ax,%ax
+ 58f:	90                   	nop
+
+00000590 <atoi>:
+#include "types.h"
+#include "util.h"
+
+int
+atoi(const char *s)
+{
+ 590:	55                   	push   %ebp
+ 591:	89 e5                	mov    %esp,%ebp
+ 593:	53                   	push   %ebx
+ 594:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 597:	0f be 02             	movsbl (%edx),%eax
+ 59a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 59d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 5a0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 5a5:	77 1e                	ja     5c5 <atoi+0x35>
+ 5a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5ae:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 5b0:	83 c2 01             	add    $0x1,%edx
+ 5b3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 5b6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 5ba:	0f be 02             	movsbl (%edx),%eax
+ 5bd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 5c0:	80 fb 09             	cmp    $0x9,%bl
+ 5c3:	76 eb                	jbe    5b0 <atoi+0x20>
+  return n;
+}
+ 5c5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 5c8:	89 c8                	mov    %ecx,%eax
+ 5ca:	c9                   	leave
+ 5cb:	c3                   	ret
+ 5cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000005d0 <strcmp>:
+
+
+int
+strcmp(const char *p, const char *q)
+{
+ 5d0:	55                   	push   %ebp
+ 5d1:	89 e5                	mov    %esp,%ebp
+ 5d3:	53                   	push   %ebx
+ 5d4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 5d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 5da:	0f b6 02             	movzbl (%edx),%eax
+ 5dd:	84 c0                	test   %al,%al
+ 5df:	75 17                	jne    5f8 <strcmp+0x28>
+ 5e1:	eb 3a                	jmp    61d <strcmp+0x4d>
+ 5e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5e7:	90                   	nop
+ 5e8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 5ec:	83 c2 01             	add    $0x1,%edx
+ 5ef:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 5f2:	84 c0                	test   %al,%al
+ 5f4:	74 1a                	je     610 <strcmp+0x40>
+    p++, q++;
+ 5f6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 5f8:	0f b6 19             	movzbl (%ecx),%ebx
+ 5fb:	38 c3                	cmp    %al,%bl
+ 5fd:	74 e9                	je     5e8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 5ff:	29 d8                	sub    %ebx,%eax
+}
+ 601:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 604:	c9                   	leave
+ 605:	c3                   	ret
+ 606:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 60d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 610:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 614:	31 c0                	xor    %eax,%eax
+ 616:	29 d8                	sub    %ebx,%eax
+}
+ 618:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 61b:	c9                   	leave
+ 61c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 61d:	0f b6 19             	movzbl (%ecx),%ebx
+ 620:	31 c0                	xor    %eax,%eax
+ 622:	eb db                	jmp    5ff <strcmp+0x2f>
+
+00000624 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 624:	b8 01 00 00 00       	mov    $0x1,%eax
+ 629:	cd 40                	int    $0x40
+ 62b:	c3                   	ret
+
+0000062c <exit>:
+SYSCALL(exit)
+ 62c:	b8 02 00 00 00       	mov    $0x2,%eax
+ 631:	cd 40                	int    $0x40
+ 633:	c3                   	ret
+
+00000634 <wait>:
+SYSCALL(wait)
+ 634:	b8 03 00 00 00       	mov    $0x3,%eax
+ 639:	cd 40                	int    $0x40
+ 63b:	c3                   	ret
+
+0000063c <pipe>:
+SYSCALL(pipe)
+ 63c:	b8 04 00 00 00       	mov    $0x4,%eax
+ 641:	cd 40                	int    $0x40
+ 643:	c3                   	ret
+
+00000644 <read>:
+SYSCALL(read)
+ 644:	b8 05 00 00 00       	mov    $0x5,%eax
+ 649:	cd 40                	int    $0x40
+ 64b:	c3                   	ret
+
+0000064c <write>:
+SYSCALL(write)
+ 64c:	b8 10 00 00 00       	mov    $0x10,%eax
+ 651:	cd 40                	int    $0x40
+ 653:	c3                   	ret
+
+00000654 <close>:
+SYSCALL(close)
+ 654:	b8 15 00 00 00       	mov    $0x15,%eax
+ 659:	cd 40                	int    $0x40
+ 65b:	c3                   	ret
+
+0000065c <kill>:
+SYSCALL(kill)
+ 65c:	b8 06 00 00 00       	mov    $0x6,%eax
+ 661:	cd 40                	int    $0x40
+ 663:	c3                   	ret
+
+00000664 <exec>:
+SYSCALL(exec)
+ 664:	b8 07 00 00 00       	mov    $0x7,%eax
+ 669:	cd 40                	int    $0x40
+ 66b:	c3                   	ret
+
+0000066c <open>:
+SYSCALL(open)
+ 66c:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 671:	cd 40                	int    $0x40
+ 673:	c3                   	ret
+
+00000674 <mknod>:
+SYSCALL(mknod)
+ 674:	b8 11 00 00 00       	mov    $0x11,%eax
+ 679:	cd 40                	int    $0x40
+ 67b:	c3                   	ret
+
+0000067c <unlink>:
+SYSCALL(unlink)
+ 67c:	b8 12 00 00 00       	mov    $0x12,%eax
+ 681:	cd 40                	int    $0x40
+ 683:	c3                   	ret
+
+00000684 <fstat>:
+SYSCALL(fstat)
+ 684:	b8 08 00 00 00       	mov    $0x8,%eax
+ 689:	cd 40                	int    $0x40
+ 68b:	c3                   	ret
+
+0000068c <link>:
+SYSCALL(link)
+ 68c:	b8 13 00 00 00       	mov    $0x13,%eax
+ 691:	cd 40                	int    $0x40
+ 693:	c3                   	ret
+
+00000694 <mkdir>:
+SYSCALL(mkdir)
+ 694:	b8 14 00 00 00       	mov    $0x14,%eax
+ 699:	cd 40                	int    $0x40
+ 69b:	c3                   	ret
+
+0000069c <chdir>:
+SYSCALL(chdir)
+ 69c:	b8 09 00 00 00       	mov    $0x9,%eax
+ 6a1:	cd 40                	int    $0x40
+ 6a3:	c3                   	ret
+
+000006a4 <dup>:
+SYSCALL(dup)
+ 6a4:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 6a9:	cd 40                	int    $0x40
+ 6ab:	c3                   	ret
+
+000006ac <getpid>:
+SYSCALL(getpid)
+ 6ac:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 6b1:	cd 40                	int    $0x40
+ 6b3:	c3                   	ret
+
+000006b4 <sbrk>:
+SYSCALL(sbrk)
+ 6b4:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 6b9:	cd 40                	int    $0x40
+ 6bb:	c3                   	ret
+
+000006bc <sleep>:
+SYSCALL(sleep)
+ 6bc:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 6c1:	cd 40                	int    $0x40
+ 6c3:	c3                   	ret
+
+000006c4 <uptime>:
+SYSCALL(uptime)
+ 6c4:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 6c9:	cd 40                	int    $0x40
+ 6cb:	c3                   	ret
+
+000006cc <arp>:
+SYSCALL(arp)
+ 6cc:	b8 16 00 00 00       	mov    $0x16,%eax
+ 6d1:	cd 40                	int    $0x40
+ 6d3:	c3                   	ret
+
+000006d4 <nicget>:
+SYSCALL(nicget)
+ 6d4:	b8 17 00 00 00       	mov    $0x17,%eax
+ 6d9:	cd 40                	int    $0x40
+ 6db:	c3                   	ret
+
+000006dc <nicset>:
+SYSCALL(nicset)
+ 6dc:	b8 18 00 00 00       	mov    $0x18,%eax
+ 6e1:	cd 40                	int    $0x40
+ 6e3:	c3                   	ret
+
+000006e4 <nicstats>:
+SYSCALL(nicstats)
+ 6e4:	b8 19 00 00 00       	mov    $0x19,%eax
+ 6e9:	cd 40                	int    $0x40
+ 6eb:	c3                   	ret
+
+000006ec <nicsend>:
+SYSCALL(nicsend)
+ 6ec:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 6f1:	cd 40                	int    $0x40
+ 6f3:	c3                   	ret
+
+000006f4 <nicrecv>:
+SYSCALL(nicrecv)
+ 6f4:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 6f9:	cd 40                	int    $0x40
+ 6fb:	c3                   	ret
+
+000006fc <arpdump>:
+SYSCALL(arpdump)
+ 6fc:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 701:	cd 40                	int    $0x40
+ 703:	c3                   	ret
+
+00000704 <arpflush>:
+SYSCALL(arpflush)
+ 704:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 709:	cd 40                	int    $0x40
+ 70b:	c3                   	ret
+
+0000070c <nicgetip>:
+SYSCALL(nicgetip)
+ 70c:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 711:	cd 40                	int    $0x40
+ 713:	c3                   	ret
+
+00000714 <nicsetip>:
+SYSCALL(nicsetip)
+ 714:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 719:	cd 40                	int    $0x40
+ 71b:	c3                   	ret
+
+0000071c <arpresolve>:
+SYSCALL(arpresolve)
+ 71c:	b8 20 00 00 00       	mov    $0x20,%eax
+ 721:	cd 40                	int    $0x40
+ 723:	c3                   	ret
+
+00000724 <arpresolvev>:
+SYSCALL(arpresolvev)
+ 724:	b8 21 00 00 00       	mov    $0x21,%eax
+ 729:	cd 40                	int    $0x40
+ 72b:	c3                   	ret
+
+0000072c <arpsend>:
+SYSCALL(arpsend)
+ 72c:	b8 22 00 00 00       	mov    $0x22,%eax
+ 731:	cd 40                	int    $0x40
+ 733:	c3                   	ret
+ 734:	66 90                	xchg   %ax,%ax
+ 736:	66 90                	xchg   %ax,%ax
+ 738:	66 90                	xchg   %ax,%ax
+ 73a:	66 90                	xchg   %ax,%ax
+ 73c:	66 90                	xchg   %ax,%ax
+ 73e:	66 90                	xchg   %ax,%ax
+
+00000740 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 740:	55                   	push   %ebp
+ 741:	89 e5                	mov    %esp,%ebp
+ 743:	57                   	push   %edi
+ 744:	56                   	push   %esi
+ 745:	53                   	push   %ebx
+ 746:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 748:	89 d1                	mov    %edx,%ecx
+{
+ 74a:	83 ec 3c             	sub    $0x3c,%esp
+ 74d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 750:	85 d2                	test   %edx,%edx
+ 752:	0f 89 80 00 00 00    	jns    7d8 <printint+0x98>
+ 758:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 75c:	74 7a                	je     7d8 <printint+0x98>
+    x = -xx;
+ 75e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 760:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 765:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 768:	31 f6                	xor    %esi,%esi
+ 76a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 770:	89 c8                	mov    %ecx,%eax
+ 772:	31 d2                	xor    %edx,%edx
+ 774:	89 f7                	mov    %esi,%edi
+ 776:	f7 f3                	div    %ebx
+ 778:	8d 76 01             	lea    0x1(%esi),%esi
+ 77b:	0f b6 92 c0 0c 00 00 	movzbl 0xcc0(%edx),%edx
+ 782:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 786:	89 ca                	mov    %ecx,%edx
+ 788:	89 c1                	mov    %eax,%ecx
+ 78a:	39 da                	cmp    %ebx,%edx
+ 78c:	73 e2                	jae    770 <printint+0x30>
+  if(neg)
+ 78e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 791:	85 c0                	test   %eax,%eax
+ 793:	74 07                	je     79c <printint+0x5c>
+    buf[i++] = '-';
+ 795:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 79a:	89 f7                	mov    %esi,%edi
+ 79c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 79f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 7a2:	01 df                	add    %ebx,%edi
+ 7a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 7a8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 7ab:	83 ec 04             	sub    $0x4,%esp
+ 7ae:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 7b1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 7b4:	6a 01                	push   $0x1
+ 7b6:	50                   	push   %eax
+ 7b7:	56                   	push   %esi
+ 7b8:	e8 8f fe ff ff       	call   64c <write>
+  while(--i >= 0)
+ 7bd:	89 f8                	mov    %edi,%eax
+ 7bf:	83 c4 10             	add    $0x10,%esp
+ 7c2:	83 ef 01             	sub    $0x1,%edi
+ 7c5:	39 d8                	cmp    %ebx,%eax
+ 7c7:	75 df                	jne    7a8 <printint+0x68>
+}
+ 7c9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 7cc:	5b                   	pop    %ebx
+ 7cd:	5e                   	pop    %esi
+ 7ce:	5f                   	pop    %edi
+ 7cf:	5d                   	pop    %ebp
+ 7d0:	c3                   	ret
+ 7d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 7d8:	31 c0                	xor    %eax,%eax
+ 7da:	eb 89                	jmp    765 <printint+0x25>
+ 7dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000007e0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 7e0:	55                   	push   %ebp
+ 7e1:	89 e5                	mov    %esp,%ebp
+ 7e3:	57                   	push   %edi
+ 7e4:	56                   	push   %esi
+ 7e5:	53                   	push   %ebx
+ 7e6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 7e9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 7ec:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 7ef:	0f b6 1e             	movzbl (%esi),%ebx
+ 7f2:	83 c6 01             	add    $0x1,%esi
+ 7f5:	84 db                	test   %bl,%bl
+ 7f7:	74 67                	je     860 <printf+0x80>
+ 7f9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 7fc:	31 d2                	xor    %edx,%edx
+ 7fe:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 801:	eb 34                	jmp    837 <printf+0x57>
+ 803:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 807:	90                   	nop
+ 808:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 80b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 810:	83 f8 25             	cmp    $0x25,%eax
+ 813:	74 18                	je     82d <printf+0x4d>
+  write(fd, &c, 1);
+ 815:	83 ec 04             	sub    $0x4,%esp
+ 818:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 81b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 81e:	6a 01                	push   $0x1
+ 820:	50                   	push   %eax
+ 821:	57                   	push   %edi
+ 822:	e8 25 fe ff ff       	call   64c <write>
+ 827:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 82a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 82d:	0f b6 1e             	movzbl (%esi),%ebx
+ 830:	83 c6 01             	add    $0x1,%esi
+ 833:	84 db                	test   %bl,%bl
+ 835:	74 29                	je     860 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 837:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 83a:	85 d2                	test   %edx,%edx
+ 83c:	74 ca                	je     808 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 83e:	83 fa 25             	cmp    $0x25,%edx
+ 841:	75 ea                	jne    82d <printf+0x4d>
+      if(c == 'd'){
+ 843:	83 f8 25             	cmp    $0x25,%eax
+ 846:	0f 84 24 01 00 00    	je     970 <printf+0x190>
+ 84c:	83 e8 63             	sub    $0x63,%eax
+ 84f:	83 f8 15             	cmp    $0x15,%eax
+ 852:	77 1c                	ja     870 <printf+0x90>
+ 854:	ff 24 85 68 0c 00 00 	jmp    *0xc68(,%eax,4)
+ 85b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 85f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 860:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 863:	5b                   	pop    %ebx
+ 864:	5e                   	pop    %esi
+ 865:	5f                   	pop    %edi
+ 866:	5d                   	pop    %ebp
+ 867:	c3                   	ret
+ 868:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 86f:	90                   	nop
+  write(fd, &c, 1);
+ 870:	83 ec 04             	sub    $0x4,%esp
+ 873:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 876:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 87a:	6a 01                	push   $0x1
+ 87c:	52                   	push   %edx
+ 87d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 880:	57                   	push   %edi
+ 881:	e8 c6 fd ff ff       	call   64c <write>
+ 886:	83 c4 0c             	add    $0xc,%esp
+ 889:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 88c:	6a 01                	push   $0x1
+ 88e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 891:	52                   	push   %edx
+ 892:	57                   	push   %edi
+ 893:	e8 b4 fd ff ff       	call   64c <write>
+        putc(fd, c);
+ 898:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 89b:	31 d2                	xor    %edx,%edx
+ 89d:	eb 8e                	jmp    82d <printf+0x4d>
+ 89f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 8a0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 8a3:	83 ec 0c             	sub    $0xc,%esp
+ 8a6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 8ab:	8b 13                	mov    (%ebx),%edx
+ 8ad:	6a 00                	push   $0x0
+ 8af:	89 f8                	mov    %edi,%eax
+        ap++;
+ 8b1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 8b4:	e8 87 fe ff ff       	call   740 <printint>
+        ap++;
+ 8b9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 8bc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 8bf:	31 d2                	xor    %edx,%edx
+ 8c1:	e9 67 ff ff ff       	jmp    82d <printf+0x4d>
+ 8c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8cd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 8d0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 8d3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 8d5:	83 c0 04             	add    $0x4,%eax
+ 8d8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 8db:	85 db                	test   %ebx,%ebx
+ 8dd:	0f 84 9d 00 00 00    	je     980 <printf+0x1a0>
+        while(*s != 0){
+ 8e3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 8e6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 8e8:	84 c0                	test   %al,%al
+ 8ea:	0f 84 3d ff ff ff    	je     82d <printf+0x4d>
+ 8f0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 8f3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 8f6:	89 de                	mov    %ebx,%esi
+ 8f8:	89 d3                	mov    %edx,%ebx
+ 8fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 900:	83 ec 04             	sub    $0x4,%esp
+ 903:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 906:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 909:	6a 01                	push   $0x1
+ 90b:	53                   	push   %ebx
+ 90c:	57                   	push   %edi
+ 90d:	e8 3a fd ff ff       	call   64c <write>
+        while(*s != 0){
+ 912:	0f b6 06             	movzbl (%esi),%eax
+ 915:	83 c4 10             	add    $0x10,%esp
+ 918:	84 c0                	test   %al,%al
+ 91a:	75 e4                	jne    900 <printf+0x120>
+      state = 0;
+ 91c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 91f:	31 d2                	xor    %edx,%edx
+ 921:	e9 07 ff ff ff       	jmp    82d <printf+0x4d>
+ 926:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 92d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 930:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 933:	83 ec 0c             	sub    $0xc,%esp
+ 936:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 93b:	8b 13                	mov    (%ebx),%edx
+ 93d:	6a 01                	push   $0x1
+ 93f:	e9 6b ff ff ff       	jmp    8af <printf+0xcf>
+ 944:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 948:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 94b:	83 ec 04             	sub    $0x4,%esp
+ 94e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 951:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 953:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 956:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 959:	6a 01                	push   $0x1
+ 95b:	52                   	push   %edx
+ 95c:	57                   	push   %edi
+ 95d:	e8 ea fc ff ff       	call   64c <write>
+        ap++;
+ 962:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 965:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 968:	31 d2                	xor    %edx,%edx
+ 96a:	e9 be fe ff ff       	jmp    82d <printf+0x4d>
+ 96f:	90                   	nop
+  write(fd, &c, 1);
+ 970:	83 ec 04             	sub    $0x4,%esp
+ 973:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 976:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 979:	6a 01                	push   $0x1
+ 97b:	e9 11 ff ff ff       	jmp    891 <printf+0xb1>
+ 980:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 985:	bb 60 0c 00 00       	mov    $0xc60,%ebx
+ 98a:	e9 61 ff ff ff       	jmp    8f0 <printf+0x110>
+ 98f:	90                   	nop
+
+00000990 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 990:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 991:	a1 58 56 00 00       	mov    0x5658,%eax
+{
+ 996:	89 e5                	mov    %esp,%ebp
+ 998:	57                   	push   %edi
+ 999:	56                   	push   %esi
+ 99a:	53                   	push   %ebx
+ 99b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 99e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 9a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9a8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 9aa:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 9ac:	39 ca                	cmp    %ecx,%edx
+ 9ae:	73 30                	jae    9e0 <free+0x50>
+ 9b0:	39 c1                	cmp    %eax,%ecx
+ 9b2:	72 04                	jb     9b8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 9b4:	39 c2                	cmp    %eax,%edx
+ 9b6:	72 f0                	jb     9a8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 9b8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 9bb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 9be:	39 f8                	cmp    %edi,%eax
+ 9c0:	74 2e                	je     9f0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 9c2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 9c5:	8b 42 04             	mov    0x4(%edx),%eax
+ 9c8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 9cb:	39 f1                	cmp    %esi,%ecx
+ 9cd:	74 38                	je     a07 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 9cf:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 9d1:	5b                   	pop    %ebx
+  freep = p;
+ 9d2:	89 15 58 56 00 00    	mov    %edx,0x5658
+}
+ 9d8:	5e                   	pop    %esi
+ 9d9:	5f                   	pop    %edi
+ 9da:	5d                   	pop    %ebp
+ 9db:	c3                   	ret
+ 9dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 9e0:	39 c1                	cmp    %eax,%ecx
+ 9e2:	72 d0                	jb     9b4 <free+0x24>
+ 9e4:	eb c2                	jmp    9a8 <free+0x18>
+ 9e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9ed:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 9f0:	03 70 04             	add    0x4(%eax),%esi
+ 9f3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 9f6:	8b 02                	mov    (%edx),%eax
+ 9f8:	8b 00                	mov    (%eax),%eax
+ 9fa:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 9fd:	8b 42 04             	mov    0x4(%edx),%eax
+ a00:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ a03:	39 f1                	cmp    %esi,%ecx
+ a05:	75 c8                	jne    9cf <free+0x3f>
+    p->s.size += bp->s.size;
+ a07:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ a0a:	89 15 58 56 00 00    	mov    %edx,0x5658
+    p->s.size += bp->s.size;
+ a10:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ a13:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ a16:	89 0a                	mov    %ecx,(%edx)
+}
+ a18:	5b                   	pop    %ebx
+ a19:	5e                   	pop    %esi
+ a1a:	5f                   	pop    %edi
+ a1b:	5d                   	pop    %ebp
+ a1c:	c3                   	ret
+ a1d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000a20 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ a20:	55                   	push   %ebp
+ a21:	89 e5                	mov    %esp,%ebp
+ a23:	57                   	push   %edi
+ a24:	56                   	push   %esi
+ a25:	53                   	push   %ebx
+ a26:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ a29:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ a2c:	8b 15 58 56 00 00    	mov    0x5658,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ a32:	8d 78 07             	lea    0x7(%eax),%edi
+ a35:	c1 ef 03             	shr    $0x3,%edi
+ a38:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ a3b:	85 d2                	test   %edx,%edx
+ a3d:	0f 84 8d 00 00 00    	je     ad0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a43:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ a45:	8b 48 04             	mov    0x4(%eax),%ecx
+ a48:	39 f9                	cmp    %edi,%ecx
+ a4a:	73 64                	jae    ab0 <malloc+0x90>
+  if(nu < 4096)
+ a4c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ a51:	39 df                	cmp    %ebx,%edi
+ a53:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ a56:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ a5d:	eb 0a                	jmp    a69 <malloc+0x49>
+ a5f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a60:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ a62:	8b 48 04             	mov    0x4(%eax),%ecx
+ a65:	39 f9                	cmp    %edi,%ecx
+ a67:	73 47                	jae    ab0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ a69:	89 c2                	mov    %eax,%edx
+ a6b:	39 05 58 56 00 00    	cmp    %eax,0x5658
+ a71:	75 ed                	jne    a60 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ a73:	83 ec 0c             	sub    $0xc,%esp
+ a76:	56                   	push   %esi
+ a77:	e8 38 fc ff ff       	call   6b4 <sbrk>
+  if(p == (char*)-1)
+ a7c:	83 c4 10             	add    $0x10,%esp
+ a7f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ a82:	74 1c                	je     aa0 <malloc+0x80>
+  hp->s.size = nu;
+ a84:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ a87:	83 ec 0c             	sub    $0xc,%esp
+ a8a:	83 c0 08             	add    $0x8,%eax
+ a8d:	50                   	push   %eax
+ a8e:	e8 fd fe ff ff       	call   990 <free>
+  return freep;
+ a93:	8b 15 58 56 00 00    	mov    0x5658,%edx
+      if((p = morecore(nunits)) == 0)
+ a99:	83 c4 10             	add    $0x10,%esp
+ a9c:	85 d2                	test   %edx,%edx
+ a9e:	75 c0                	jne    a60 <malloc+0x40>
+        return 0;
+  }
+}
+ aa0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ aa3:	31 c0                	xor    %eax,%eax
+}
+ aa5:	5b                   	pop    %ebx
+ aa6:	5e                   	pop    %esi
+ aa7:	5f                   	pop    %edi
+ aa8:	5d                   	pop    %ebp
+ aa9:	c3                   	ret
+ aaa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ ab0:	39 cf                	cmp    %ecx,%edi
+ ab2:	74 4c                	je     b00 <malloc+0xe0>
+        p->s.size -= nunits;
+ ab4:	29 f9                	sub    %edi,%ecx
+ ab6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ ab9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ abc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ abf:	89 15 58 56 00 00    	mov    %edx,0x5658
+}
+ ac5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ ac8:	83 c0 08             	add    $0x8,%eax
+}
+ acb:	5b                   	pop    %ebx
+ acc:	5e                   	pop    %esi
+ acd:	5f                   	pop    %edi
+ ace:	5d                   	pop    %ebp
+ acf:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ ad0:	c7 05 58 56 00 00 5c 	movl   $0x565c,0x5658
+ ad7:	56 00 00 
+    base.s.size = 0;
+ ada:	b8 5c 56 00 00       	mov    $0x565c,%eax
+    base.s.ptr = freep = prevp = &base;
+ adf:	c7 05 5c 56 00 00 5c 	movl   $0x565c,0x565c
+ ae6:	56 00 00 
+    base.s.size = 0;
+ ae9:	c7 05 60 56 00 00 00 	movl   $0x0,0x5660
+ af0:	00 00 00 
+    if(p->s.size >= nunits){
+ af3:	e9 54 ff ff ff       	jmp    a4c <malloc+0x2c>
+ af8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ aff:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ b00:	8b 08                	mov    (%eax),%ecx
+ b02:	89 0a                	mov    %ecx,(%edx)
+ b04:	eb b9                	jmp    abf <malloc+0x9f>
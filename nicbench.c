@@ -0,0 +1,122 @@
+/**
+ *NIC throughput and latency benchmark. Puts the interface in loopback,
+ *so it needs no network, and times raw frames going round.
+ *usage: nicbench interface [frames [size]]
+ */
+#include "types.h"
+#include "user.h"
+#include "nicctl.h"
+
+#define ETHR_HDR_LEN  14
+#define MAX_FRAME     (ETHR_HDR_LEN + 9000)
+//Frames in flight in the throughput run, below the kernel's raw queue limit
+#define WINDOW        64
+//Timer ticks per second
+#define HZ            100
+
+static uchar txbuf[MAX_FRAME];
+static uchar rxbuf[MAX_FRAME];
+static int errors;
+
+// Broadcast frame of the raw ether type, carrying its sequence number
+static void mkframe(int size) {
+  memset(txbuf, 0, size);
+  memset(txbuf, 0xff, 6);
+  txbuf[12] = 0x88;
+  txbuf[13] = 0xB5;
+  for(int i = ETHR_HDR_LEN + 4; i < size; i++)
+    txbuf[i] = i;
+}
+
+static int xmit(char *interface, int seq, int size) {
+  *(int*)&txbuf[ETHR_HDR_LEN] = seq;
+  return nicsend(interface, txbuf, size);
+}
+
+static int recv(char *interface, int seq) {
+  int n = nicrecv(interface, rxbuf, sizeof(rxbuf));
+  if(n < 0)
+    return -1;
+  if(*(int*)&rxbuf[ETHR_HDR_LEN] != seq)
+    errors++;
+  return n;
+}
+
+// Keep WINDOW frames in flight until all have come back
+static int throughput(char *interface, int frames, int size) {
+  int sent = 0, got = 0;
+  int start = uptime();
+
+  while(got < frames) {
+    while(sent < frames && sent - got < WINDOW) {
+      if(xmit(interface, sent, size) < 0)
+        return -1;
+      sent++;
+    }
+    if(recv(interface, got) < 0)
+      return -1;
+    got++;
+  }
+  return uptime() - start;
+}
+
+// One frame in flight at a time
+static int latency(char *interface, int frames, int size) {
+  int start = uptime();
+
+  for(int i = 0; i < frames; i++) {
+    if(xmit(interface, i, size) < 0 || recv(interface, i) < 0)
+      return -1;
+  }
+  return uptime() - start;
+}
+
+int main(int argc, char *argv[]) {
+  char *interface;
+  int frames = 1000, size = 1514, t;
+  uint mtu, loopback;
+
+  if(argc < 2 || argc > 4) {
+    printf(2, "usage: nicbench interface [frames [size]]\n");
+    exit();
+  }
+  interface = argv[1];
+  if(argc > 2)
+    frames = atoi(argv[2]);
+  if(argc > 3)
+    size = atoi(argv[3]);
+  if(nicget(interface, NICCTL_MTU, &mtu) < 0)
+    mtu = 0;
+  if(frames <= 0 || size < ETHR_HDR_LEN + 4 || size > ETHR_HDR_LEN + mtu) {
+    printf(2, "nicbench: bad frame count or size (mtu %d)\n", mtu);
+    exit();
+  }
+
+  if(nicget(interface, NICCTL_LOOPBACK, &loopback) < 0)
+    loopback = 0;
+  if(nicset(interface, NICCTL_LOOPBACK, 1) < 0) {
+    printf(2, "nicbench: %s can't loop back\n", interface);
+    exit();
+  }
+  mkframe(size);
+
+  printf(1, "%d frames of %d bytes, %d ticks/s\n", frames, size, HZ);
+  if((t = throughput(interface, frames, size)) < 0)
+    printf(2, "nicbench: throughput run failed\n");
+  else {
+    if(t == 0)
+      t = 1;
+    printf(1, "throughput: %d ticks, %d frames/s, %d KB/s\n",
+           t, frames * HZ / t, frames * (size / 16) / 64 * HZ / t);
+  }
+  if((t = latency(interface, frames, size)) < 0)
+    printf(2, "nicbench: latency run failed\n");
+  else
+    printf(1, "latency: %d ticks, %d us per round trip\n",
+           t, t * (1000000 / HZ) / frames);
+  if(errors)
+    printf(1, "%d frames came back out of order\n", errors);
+
+  nicset(interface, NICCTL_LOOPBACK, loopback);
+  exit();
+}
@@ -0,0 +1,1526 @@
+
+_nicctl:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+      printf(1, " %d Mb/s", speed);
+    printf(1, "\n");
+  }
+}
+
+int main(int argc, char *argv[]) {
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 28             	sub    $0x28,%esp
+  14:	8b 31                	mov    (%ecx),%esi
+  16:	8b 59 04             	mov    0x4(%ecx),%ebx
+  struct param *p;
+
+  if(argc > 4) {
+  19:	83 fe 04             	cmp    $0x4,%esi
+  1c:	7f 60                	jg     7e <main+0x7e>
+    printf(2, "usage: nicctl [interface [param [value]]]\n");
+    exit();
+  }
+
+  if(argc == 1) {
+  1e:	83 fe 01             	cmp    $0x1,%esi
+  21:	0f 84 8e 00 00 00    	je     b5 <main+0xb5>
+    for(p = params; p->name; p++)
+      show(argv[1], p);
+    exit();
+  }
+
+  for(p = params; p->name; p++)
+  27:	a1 c0 0e 00 00       	mov    0xec0,%eax
+  if(argc == 2) {
+  2c:	83 fe 02             	cmp    $0x2,%esi
+  2f:	74 60                	je     91 <main+0x91>
+  for(p = params; p->name; p++)
+  31:	bf c0 0e 00 00       	mov    $0xec0,%edi
+  36:	85 c0                	test   %eax,%eax
+  38:	75 10                	jne    4a <main+0x4a>
+  3a:	e9 2f 01 00 00       	jmp    16e <main+0x16e>
+  3f:	90                   	nop
+  40:	8b 47 08             	mov    0x8(%edi),%eax
+  43:	83 c7 08             	add    $0x8,%edi
+  46:	85 c0                	test   %eax,%eax
+  48:	74 13                	je     5d <main+0x5d>
+    if(strcmp(p->name, argv[2]) == 0)
+  4a:	83 ec 08             	sub    $0x8,%esp
+  4d:	ff 73 08             	push   0x8(%ebx)
+  50:	50                   	push   %eax
+  51:	e8 5a 04 00 00       	call   4b0 <strcmp>
+  56:	83 c4 10             	add    $0x10,%esp
+  59:	85 c0                	test   %eax,%eax
+  5b:	75 e3                	jne    40 <main+0x40>
+      break;
+  if(p->name == 0) {
+  5d:	83 3f 00             	cmpl   $0x0,(%edi)
+  60:	0f 84 08 01 00 00    	je     16e <main+0x16e>
+    printf(2, "nicctl: unknown param %s\n", argv[2]);
+    exit();
+  }
+
+  if(argc == 4 && nicset(argv[1], p->id, atoi(argv[3])) < 0)
+  66:	83 fe 04             	cmp    $0x4,%esi
+  69:	0f 84 14 01 00 00    	je     183 <main+0x183>
+    printf(2, "nicctl: failed to set %s\n", p->name);
+  show(argv[1], p);
+  6f:	8b 43 04             	mov    0x4(%ebx),%eax
+  72:	89 fa                	mov    %edi,%edx
+  74:	e8 47 01 00 00       	call   1c0 <show>
+  exit();
+  79:	e8 8e 04 00 00       	call   50c <exit>
+    printf(2, "usage: nicctl [interface [param [value]]]\n");
+  7e:	52                   	push   %edx
+  7f:	52                   	push   %edx
+  80:	68 00 0b 00 00       	push   $0xb00
+  85:	6a 02                	push   $0x2
+  87:	e8 34 06 00 00       	call   6c0 <printf>
+    exit();
+  8c:	e8 7b 04 00 00       	call   50c <exit>
+    for(p = params; p->name; p++)
+  91:	be c0 0e 00 00       	mov    $0xec0,%esi
+  96:	85 c0                	test   %eax,%eax
+  98:	74 df                	je     79 <main+0x79>
+  9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      show(argv[1], p);
+  a0:	8b 43 04             	mov    0x4(%ebx),%eax
+  a3:	89 f2                	mov    %esi,%edx
+    for(p = params; p->name; p++)
+  a5:	83 c6 08             	add    $0x8,%esi
+      show(argv[1], p);
+  a8:	e8 13 01 00 00       	call   1c0 <show>
+    for(p = params; p->name; p++)
+  ad:	8b 16                	mov    (%esi),%edx
+  af:	85 d2                	test   %edx,%edx
+  b1:	75 ed                	jne    a0 <main+0xa0>
+  b3:	eb c4                	jmp    79 <main+0x79>
+  strcpy(name, "eth0");
+  b5:	8d 5d e0             	lea    -0x20(%ebp),%ebx
+  b8:	50                   	push   %eax
+  b9:	8d 75 d4             	lea    -0x2c(%ebp),%esi
+  bc:	50                   	push   %eax
+    if(nicget(name, NICCTL_LINK, &link) < 0)
+  bd:	8d 7d d8             	lea    -0x28(%ebp),%edi
+  strcpy(name, "eth0");
+  c0:	68 0b 0a 00 00       	push   $0xa0b
+  c5:	53                   	push   %ebx
+  c6:	e8 85 01 00 00       	call   250 <strcpy>
+  for(; nicget(name, NICCTL_MTU, &mtu) >= 0; name[3]++) {
+  cb:	83 c4 10             	add    $0x10,%esp
+  ce:	eb 3f                	jmp    10f <main+0x10f>
+    printf(1, "%s: mtu %d, link %s", name, mtu, link ? "up" : "down");
+  d0:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  d4:	b8 03 0a 00 00       	mov    $0xa03,%eax
+  d9:	74 63                	je     13e <main+0x13e>
+  db:	83 ec 0c             	sub    $0xc,%esp
+  de:	50                   	push   %eax
+  df:	ff 75 d4             	push   -0x2c(%ebp)
+  e2:	53                   	push   %ebx
+  e3:	68 10 0a 00 00       	push   $0xa10
+  e8:	6a 01                	push   $0x1
+  ea:	e8 d1 05 00 00       	call   6c0 <printf>
+    if(link && nicget(name, NICCTL_SPEED, &speed) >= 0)
+  ef:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  f2:	83 c4 20             	add    $0x20,%esp
+  f5:	85 c0                	test   %eax,%eax
+  f7:	75 4c                	jne    145 <main+0x145>
+    printf(1, "\n");
+  f9:	83 ec 08             	sub    $0x8,%esp
+  fc:	68 ef 09 00 00       	push   $0x9ef
+ 101:	6a 01                	push   $0x1
+ 103:	e8 b8 05 00 00       	call   6c0 <printf>
+  for(; nicget(name, NICCTL_MTU, &mtu) >= 0; name[3]++) {
+ 108:	80 45 e3 01          	addb   $0x1,-0x1d(%ebp)
+ 10c:	83 c4 10             	add    $0x10,%esp
+ 10f:	83 ec 04             	sub    $0x4,%esp
+ 112:	56                   	push   %esi
+ 113:	6a 10                	push   $0x10
+ 115:	53                   	push   %ebx
+ 116:	e8 99 04 00 00       	call   5b4 <nicget>
+ 11b:	83 c4 10             	add    $0x10,%esp
+ 11e:	85 c0                	test   %eax,%eax
+ 120:	0f 88 53 ff ff ff    	js     79 <main+0x79>
+    if(nicget(name, NICCTL_LINK, &link) < 0)
+ 126:	83 ec 04             	sub    $0x4,%esp
+ 129:	57                   	push   %edi
+ 12a:	6a 13                	push   $0x13
+ 12c:	53                   	push   %ebx
+ 12d:	e8 82 04 00 00       	call   5b4 <nicget>
+ 132:	83 c4 10             	add    $0x10,%esp
+ 135:	85 c0                	test   %eax,%eax
+ 137:	79 97                	jns    d0 <main+0xd0>
+      link = 0;
+ 139:	31 c0                	xor    %eax,%eax
+ 13b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+    printf(1, "%s: mtu %d, link %s", name, mtu, link ? "up" : "down");
+ 13e:	b8 06 0a 00 00       	mov    $0xa06,%eax
+ 143:	eb 96                	jmp    db <main+0xdb>
+    if(link && nicget(name, NICCTL_SPEED, &speed) >= 0)
+ 145:	50                   	push   %eax
+ 146:	8d 45 dc             	lea    -0x24(%ebp),%eax
+ 149:	50                   	push   %eax
+ 14a:	6a 14                	push   $0x14
+ 14c:	53                   	push   %ebx
+ 14d:	e8 62 04 00 00       	call   5b4 <nicget>
+ 152:	83 c4 10             	add    $0x10,%esp
+ 155:	85 c0                	test   %eax,%eax
+ 157:	78 a0                	js     f9 <main+0xf9>
+      printf(1, " %d Mb/s", speed);
+ 159:	50                   	push   %eax
+ 15a:	ff 75 dc             	push   -0x24(%ebp)
+ 15d:	68 24 0a 00 00       	push   $0xa24
+ 162:	6a 01                	push   $0x1
+ 164:	e8 57 05 00 00       	call   6c0 <printf>
+ 169:	83 c4 10             	add    $0x10,%esp
+ 16c:	eb 8b                	jmp    f9 <main+0xf9>
+    printf(2, "nicctl: unknown param %s\n", argv[2]);
+ 16e:	51                   	push   %ecx
+ 16f:	ff 73 08             	push   0x8(%ebx)
+ 172:	68 2d 0a 00 00       	push   $0xa2d
+ 177:	6a 02                	push   $0x2
+ 179:	e8 42 05 00 00       	call   6c0 <printf>
+    exit();
+ 17e:	e8 89 03 00 00       	call   50c <exit>
+  if(argc == 4 && nicset(argv[1], p->id, atoi(argv[3])) < 0)
+ 183:	83 ec 0c             	sub    $0xc,%esp
+ 186:	ff 73 0c             	push   0xc(%ebx)
+ 189:	e8 e2 02 00 00       	call   470 <atoi>
+ 18e:	83 c4 0c             	add    $0xc,%esp
+ 191:	50                   	push   %eax
+ 192:	ff 77 04             	push   0x4(%edi)
+ 195:	ff 73 04             	push   0x4(%ebx)
+ 198:	e8 1f 04 00 00       	call   5bc <nicset>
+ 19d:	83 c4 10             	add    $0x10,%esp
+ 1a0:	85 c0                	test   %eax,%eax
+ 1a2:	0f 89 c7 fe ff ff    	jns    6f <main+0x6f>
+    printf(2, "nicctl: failed to set %s\n", p->name);
+ 1a8:	50                   	push   %eax
+ 1a9:	ff 37                	push   (%edi)
+ 1ab:	68 47 0a 00 00       	push   $0xa47
+ 1b0:	6a 02                	push   $0x2
+ 1b2:	e8 09 05 00 00       	call   6c0 <printf>
+ 1b7:	83 c4 10             	add    $0x10,%esp
+ 1ba:	e9 b0 fe ff ff       	jmp    6f <main+0x6f>
+ 1bf:	90                   	nop
+
+000001c0 <show>:
+static void show(char *interface, struct param *p) {
+ 1c0:	55                   	push   %ebp
+ 1c1:	89 e5                	mov    %esp,%ebp
+ 1c3:	53                   	push   %ebx
+ 1c4:	89 d3                	mov    %edx,%ebx
+  if(nicget(interface, p->id, &v) < 0)
+ 1c6:	8d 55 f4             	lea    -0xc(%ebp),%edx
+static void show(char *interface, struct param *p) {
+ 1c9:	83 ec 18             	sub    $0x18,%esp
+  if(nicget(interface, p->id, &v) < 0)
+ 1cc:	52                   	push   %edx
+ 1cd:	ff 73 04             	push   0x4(%ebx)
+ 1d0:	50                   	push   %eax
+ 1d1:	e8 de 03 00 00       	call   5b4 <nicget>
+ 1d6:	83 c4 10             	add    $0x10,%esp
+ 1d9:	85 c0                	test   %eax,%eax
+ 1db:	78 53                	js     230 <show+0x70>
+  else if(v / 10)   //printf has no unsigned %d
+ 1dd:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    printf(1, "%s: n/a\n", p->name);
+ 1e0:	8b 1b                	mov    (%ebx),%ebx
+  else if(v / 10)   //printf has no unsigned %d
+ 1e2:	83 f9 09             	cmp    $0x9,%ecx
+ 1e5:	77 19                	ja     200 <show+0x40>
+    printf(1, "%s: %d\n", p->name, v);
+ 1e7:	51                   	push   %ecx
+ 1e8:	53                   	push   %ebx
+ 1e9:	68 fb 09 00 00       	push   $0x9fb
+ 1ee:	6a 01                	push   $0x1
+ 1f0:	e8 cb 04 00 00       	call   6c0 <printf>
+}
+ 1f5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    printf(1, "%s: %d\n", p->name, v);
+ 1f8:	83 c4 10             	add    $0x10,%esp
+}
+ 1fb:	c9                   	leave
+ 1fc:	c3                   	ret
+ 1fd:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(1, "%s: %d%d\n", p->name, v / 10, v % 10);
+ 200:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+ 205:	83 ec 0c             	sub    $0xc,%esp
+ 208:	f7 e1                	mul    %ecx
+ 20a:	c1 ea 03             	shr    $0x3,%edx
+ 20d:	8d 04 92             	lea    (%edx,%edx,4),%eax
+ 210:	01 c0                	add    %eax,%eax
+ 212:	29 c1                	sub    %eax,%ecx
+ 214:	51                   	push   %ecx
+ 215:	52                   	push   %edx
+ 216:	53                   	push   %ebx
+ 217:	68 f1 09 00 00       	push   $0x9f1
+ 21c:	6a 01                	push   $0x1
+ 21e:	e8 9d 04 00 00       	call   6c0 <printf>
+}
+ 223:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 226:	83 c4 20             	add    $0x20,%esp
+ 229:	c9                   	leave
+ 22a:	c3                   	ret
+ 22b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 22f:	90                   	nop
+    printf(1, "%s: n/a\n", p->name);
+ 230:	83 ec 04             	sub    $0x4,%esp
+ 233:	ff 33                	push   (%ebx)
+ 235:	68 e8 09 00 00       	push   $0x9e8
+ 23a:	6a 01                	push   $0x1
+ 23c:	e8 7f 04 00 00       	call   6c0 <printf>
+}
+ 241:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 244:	83 c4 10             	add    $0x10,%esp
+ 247:	c9                   	leave
+ 248:	c3                   	ret
+ 249:	66 90                	xchg   %ax,%ax
+ 24b:	66 90                	xchg   %ax,%ax
+ 24d:	66 90                	xchg   %ax,%ax
+ 24f:	90                   	nop
+
+00000250 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 250:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 251:	31 c0                	xor    %eax,%eax
+{
+ 253:	89 e5                	mov    %esp,%ebp
+ 255:	53                   	push   %ebx
+ 256:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 259:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 25c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 260:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 264:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 267:	83 c0 01             	add    $0x1,%eax
+ 26a:	84 d2                	test   %dl,%dl
+ 26c:	75 f2                	jne    260 <strcpy+0x10>
+    ;
+  return os;
+}
+ 26e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 271:	89 c8                	mov    %ecx,%eax
+ 273:	c9                   	leave
+ 274:	c3                   	ret
+ 275:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 27c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000280 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 280:	55                   	push   %ebp
+ 281:	89 e5                	mov    %esp,%ebp
+ 283:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 286:	80 3a 00             	cmpb   $0x0,(%edx)
+ 289:	74 15                	je     2a0 <strlen+0x20>
+ 28b:	31 c0                	xor    %eax,%eax
+ 28d:	8d 76 00             	lea    0x0(%esi),%esi
+ 290:	83 c0 01             	add    $0x1,%eax
+ 293:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 297:	89 c1                	mov    %eax,%ecx
+ 299:	75 f5                	jne    290 <strlen+0x10>
+    ;
+  return n;
+}
+ 29b:	89 c8                	mov    %ecx,%eax
+ 29d:	5d                   	pop    %ebp
+ 29e:	c3                   	ret
+ 29f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 2a0:	31 c9                	xor    %ecx,%ecx
+}
+ 2a2:	5d                   	pop    %ebp
+ 2a3:	89 c8                	mov    %ecx,%eax
+ 2a5:	c3                   	ret
+ 2a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000002b0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 2b0:	55                   	push   %ebp
+ 2b1:	89 e5                	mov    %esp,%ebp
+ 2b3:	57                   	push   %edi
+ 2b4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 2b7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 2ba:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2bd:	89 d7                	mov    %edx,%edi
+ 2bf:	fc                   	cld
+ 2c0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 2c2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 2c5:	89 d0                	mov    %edx,%eax
+ 2c7:	c9                   	leave
+ 2c8:	c3                   	ret
+ 2c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000002d0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 2d0:	55                   	push   %ebp
+ 2d1:	89 e5                	mov    %esp,%ebp
+ 2d3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2d6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 2da:	0f b6 10             	movzbl (%eax),%edx
+ 2dd:	84 d2                	test   %dl,%dl
+ 2df:	75 12                	jne    2f3 <strchr+0x23>
+ 2e1:	eb 1d                	jmp    300 <strchr+0x30>
+ 2e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2e7:	90                   	nop
+ 2e8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 2ec:	83 c0 01             	add    $0x1,%eax
+ 2ef:	84 d2                	test   %dl,%dl
+ 2f1:	74 0d                	je     300 <strchr+0x30>
+    if(*s == c)
+ 2f3:	38 d1                	cmp    %dl,%cl
+ 2f5:	75 f1                	jne    2e8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 2f7:	5d                   	pop    %ebp
+ 2f8:	c3                   	ret
+ 2f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 300:	31 c0                	xor    %eax,%eax
+}
+ 302:	5d                   	pop    %ebp
+ 303:	c3                   	ret
+ 304:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 30b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 30f:	90                   	nop
+
+00000310 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 310:	55                   	push   %ebp
+ 311:	89 e5                	mov    %esp,%ebp
+ 313:	57                   	push   %edi
+ 314:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 315:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 318:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 319:	31 db                	xor    %ebx,%ebx
+{
+ 31b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 31e:	eb 27                	jmp    347 <gets+0x37>
+    cc = read(0, &c, 1);
+ 320:	83 ec 04             	sub    $0x4,%esp
+ 323:	6a 01                	push   $0x1
+ 325:	56                   	push   %esi
+ 326:	6a 00                	push   $0x0
+ 328:	e8 f7 01 00 00       	call   524 <read>
+    if(cc < 1)
+ 32d:	83 c4 10             	add    $0x10,%esp
+ 330:	85 c0                	test   %eax,%eax
+ 332:	7e 1d                	jle    351 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 334:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 338:	8b 55 08             	mov    0x8(%ebp),%edx
+ 33b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 33f:	3c 0a                	cmp    $0xa,%al
+ 341:	74 10                	je     353 <gets+0x43>
+ 343:	3c 0d                	cmp    $0xd,%al
+ 345:	74 0c                	je     353 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 347:	89 df                	mov    %ebx,%edi
+ 349:	83 c3 01             	add    $0x1,%ebx
+ 34c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 34f:	7c cf                	jl     320 <gets+0x10>
+ 351:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 353:	8b 45 08             	mov    0x8(%ebp),%eax
+ 356:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 35a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 35d:	5b                   	pop    %ebx
+ 35e:	5e                   	pop    %esi
+ 35f:	5f                   	pop    %edi
+ 360:	5d                   	pop    %ebp
+ 361:	c3                   	ret
+ 362:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 369:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000370 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 370:	55                   	push   %ebp
+ 371:	89 e5                	mov    %esp,%ebp
+ 373:	56                   	push   %esi
+ 374:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 375:	83 ec 08             	sub    $0x8,%esp
+ 378:	6a 00                	push   $0x0
+ 37a:	ff 75 08             	push   0x8(%ebp)
+ 37d:	e8 ca 01 00 00       	call   54c <open>
+  if(fd < 0)
+ 382:	83 c4 10             	add    $0x10,%esp
+ 385:	85 c0                	test   %eax,%eax
+ 387:	78 27                	js     3b0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 389:	83 ec 08             	sub    $0x8,%esp
+ 38c:	ff 75 0c             	push   0xc(%ebp)
+ 38f:	89 c3                	mov    %eax,%ebx
+ 391:	50                   	push   %eax
+ 392:	e8 cd 01 00 00       	call   564 <fstat>
+  close(fd);
+ 397:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 39a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 39c:	e8 93 01 00 00       	call   534 <close>
+  return r;
+ 3a1:	83 c4 10             	add    $0x10,%esp
+}
+ 3a4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 3a7:	89 f0                	mov    %esi,%eax
+ 3a9:	5b                   	pop    %ebx
+ 3aa:	5e                   	pop    %esi
+ 3ab:	5d                   	pop    %ebp
+ 3ac:	c3                   	ret
+ 3ad:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 3b0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 3b5:	eb ed                	jmp    3a4 <stat+0x34>
+ 3b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3be:	66 90                	xchg   %ax,%ax
+
+000003c0 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 3c0:	55                   	push   %ebp
+ 3c1:	89 e5                	mov    %esp,%ebp
+ 3c3:	57                   	push   %edi
+ 3c4:	56                   	push   %esi
+ 3c5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 3c8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3cb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 3ce:	85 c0                	test   %eax,%eax
+ 3d0:	7e 13                	jle    3e5 <memmove+0x25>
+ 3d2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 3d4:	89 d7                	mov    %edx,%edi
+ 3d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3dd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 3e0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 3e1:	39 f8                	cmp    %edi,%eax
+ 3e3:	75 fb                	jne    3e0 <memmove+0x20>
+  return vdst;
+}
+ 3e5:	5e                   	pop    %esi
+ 3e6:	89 d0                	mov    %edx,%eax
+ 3e8:	5f                   	pop    %edi
+ 3e9:	5d                   	pop    %ebp
+ 3ea:	c3                   	ret
+ 3eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3ef:	90                   	nop
+
+000003f0 <parseip>:
+
+// a.b.c.d to network byte order. -1 if malformed
+int
+parseip(char *s, uint *addr)
+{
+ 3f0:	55                   	push   %ebp
+ 3f1:	89 e5                	mov    %esp,%ebp
+ 3f3:	57                   	push   %edi
+  uint8_t *b = (uint8_t*)addr;
+  int v;
+
+  for(int i = 0; i < 4; i++) {
+ 3f4:	31 ff                	xor    %edi,%edi
+{
+ 3f6:	56                   	push   %esi
+ 3f7:	53                   	push   %ebx
+ 3f8:	8b 55 08             	mov    0x8(%ebp),%edx
+    if(*s < '0' || *s > '9')
+ 3fb:	0f be 02             	movsbl (%edx),%eax
+ 3fe:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 401:	80 f9 09             	cmp    $0x9,%cl
+ 404:	77 59                	ja     45f <parseip+0x6f>
+      return -1;
+    for(v = 0; *s >= '0' && *s <= '9'; s++)
+ 406:	31 c9                	xor    %ecx,%ecx
+ 408:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 40f:	90                   	nop
+      v = v * 10 + *s - '0';
+ 410:	89 d6                	mov    %edx,%esi
+ 412:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    for(v = 0; *s >= '0' && *s <= '9'; s++)
+ 415:	83 c2 01             	add    $0x1,%edx
+      v = v * 10 + *s - '0';
+ 418:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+    for(v = 0; *s >= '0' && *s <= '9'; s++)
+ 41c:	0f be 02             	movsbl (%edx),%eax
+ 41f:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 422:	80 fb 09             	cmp    $0x9,%bl
+ 425:	76 e9                	jbe    410 <parseip+0x20>
+    if(v > 255 || *s != (i < 3 ? '.' : '\0'))
+ 427:	81 f9 ff 00 00 00    	cmp    $0xff,%ecx
+ 42d:	7f 30                	jg     45f <parseip+0x6f>
+ 42f:	83 ff 03             	cmp    $0x3,%edi
+ 432:	74 1c                	je     450 <parseip+0x60>
+ 434:	83 f8 2e             	cmp    $0x2e,%eax
+ 437:	75 26                	jne    45f <parseip+0x6f>
+      return -1;
+    b[i] = v;
+ 439:	8b 45 0c             	mov    0xc(%ebp),%eax
+    s++;
+ 43c:	8d 56 02             	lea    0x2(%esi),%edx
+    b[i] = v;
+ 43f:	88 0c 38             	mov    %cl,(%eax,%edi,1)
+  for(int i = 0; i < 4; i++) {
+ 442:	83 c7 01             	add    $0x1,%edi
+ 445:	eb b4                	jmp    3fb <parseip+0xb>
+ 447:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 44e:	66 90                	xchg   %ax,%ax
+    if(v > 255 || *s != (i < 3 ? '.' : '\0'))
+ 450:	85 c0                	test   %eax,%eax
+ 452:	75 0b                	jne    45f <parseip+0x6f>
+    b[i] = v;
+ 454:	8b 7d 0c             	mov    0xc(%ebp),%edi
+ 457:	88 4f 03             	mov    %cl,0x3(%edi)
+  }
+  return 0;
+}
+ 45a:	5b                   	pop    %ebx
+ 45b:	5e                   	pop    %esi
+ 45c:	5f                   	pop    %edi
+ 45d:	5d                   	pop    %ebp
+ 45e:	c3                   	ret
+ 45f:	5b                   	pop    %ebx
+      return -1;
+ 460:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+ 465:	5e                   	pop    %esi
+ 466:	5f                   	pop    %edi
+ 467:	5d                   	pop    %ebp
+ 468:	c3                   	ret
+ 469:	66 90                	xchg   %ax,%ax
+ 46b:	66 90                	xchg   %ax,%ax
+ 46d:	66 90                	xchg   %ax,%ax
+ 46f:	90                   	nop
+
+00000470 <atoi>:
+#include "types.h"
+#include "util.h"
+
+int
+atoi(const char *s)
+{
+ 470:	55                   	push   %ebp
+ 471:	89 e5                	mov    %esp,%ebp
+ 473:	53                   	push   %ebx
+ 474:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 477:	0f be 02             	movsbl (%edx),%eax
+ 47a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 47d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 480:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 485:	77 1e                	ja     4a5 <atoi+0x35>
+ 487:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 48e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 490:	83 c2 01             	add    $0x1,%edx
+ 493:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 496:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 49a:	0f be 02             	movsbl (%edx),%eax
+ 49d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 4a0:	80 fb 09             	cmp    $0x9,%bl
+ 4a3:	76 eb                	jbe    490 <atoi+0x20>
+  return n;
+}
+ 4a5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 4a8:	89 c8                	mov    %ecx,%eax
+ 4aa:	c9                   	leave
+ 4ab:	c3                   	ret
+ 4ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000004b0 <strcmp>:
+
+
+int
+strcmp(const char *p, const char *q)
+{
+ 4b0:	55                   	push   %ebp
+ 4b1:	89 e5                	mov    %esp,%ebp
+ 4b3:	53                   	push   %ebx
+ 4b4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 4b7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 4ba:	0f b6 02             	movzbl (%edx),%eax
+ 4bd:	84 c0                	test   %al,%al
+ 4bf:	75 17                	jne    4d8 <strcmp+0x28>
+ 4c1:	eb 3a                	jmp    4fd <strcmp+0x4d>
+ 4c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4c7:	90                   	nop
+ 4c8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 4cc:	83 c2 01             	add    $0x1,%edx
+ 4cf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 4d2:	84 c0                	test   %al,%al
+ 4d4:	74 1a                	je     4f0 <strcmp+0x40>
+    p++, q++;
+ 4d6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 4d8:	0f b6 19             	movzbl (%ecx),%ebx
+ 4db:	38 c3                	cmp    %al,%bl
+ 4dd:	74 e9                	je     4c8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 4df:	29 d8                	sub    %ebx,%eax
+}
+ 4e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 4e4:	c9                   	leave
+ 4e5:	c3                   	ret
+ 4e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4ed:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 4f0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 4f4:	31 c0                	xor    %eax,%eax
+ 4f6:	29 d8                	sub    %ebx,%eax
+}
+ 4f8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 4fb:	c9                   	leave
+ 4fc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 4fd:	0f b6 19             	movzbl (%ecx),%ebx
+ 500:	31 c0                	xor    %eax,%eax
+ 502:	eb db                	jmp    4df <strcmp+0x2f>
+
+00000504 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 504:	b8 01 00 00 00       	mov    $0x1,%eax
+ 509:	cd 40                	int    $0x40
+ 50b:	c3                   	ret
+
+0000050c <exit>:
+SYSCALL(exit)
+ 50c:	b8 02 00 00 00       	mov    $0x2,%eax
+ 511:	cd 40                	int    $0x40
+ 513:	c3                   	ret
+
+00000514 <wait>:
+SYSCALL(wait)
+ 514:	b8 03 00 00 00       	mov    $0x3,%eax
+ 519:	cd 40                	int    $0x40
+ 51b:	c3                   	ret
+
+0000051c <pipe>:
+SYSCALL(pipe)
+ 51c:	b8 04 00 00 00       	mov    $0x4,%eax
+ 521:	cd 40                	int    $0x40
+ 523:	c3                   	ret
+
+00000524 <read>:
+SYSCALL(read)
+ 524:	b8 05 00 00 00       	mov    $0x5,%eax
+ 529:	cd 40                	int    $0x40
+ 52b:	c3                   	ret
+
+0000052c <write>:
+SYSCALL(write)
+ 52c:	b8 10 00 00 00       	mov    $0x10,%eax
+ 531:	cd 40                	int    $0x40
+ 533:	c3                   	ret
+
+00000534 <close>:
+SYSCALL(close)
+ 534:	b8 15 00 00 00       	mov    $0x15,%eax
+ 539:	cd 40                	int    $0x40
+ 53b:	c3                   	ret
+
+0000053c <kill>:
+SYSCALL(kill)
+ 53c:	b8 06 00 00 00       	mov    $0x6,%eax
+ 541:	cd 40                	int    $0x40
+ 543:	c3                   	ret
+
+00000544 <exec>:
+SYSCALL(exec)
+ 544:	b8 07 00 00 00       	mov    $0x7,%eax
+ 549:	cd 40                	int    $0x40
+ 54b:	c3                   	ret
+
+0000054c <open>:
+SYSCALL(open)
+ 54c:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 551:	cd 40                	int    $0x40
+ 553:	c3                   	ret
+
+00000554 <mknod>:
+SYSCALL(mknod)
+ 554:	b8 11 00 00 00       	mov    $0x11,%eax
+ 559:	cd 40                	int    $0x40
+ 55b:	c3                   	ret
+
+0000055c <unlink>:
+SYSCALL(unlink)
+ 55c:	b8 12 00 00 00       	mov    $0x12,%eax
+ 561:	cd 40                	int    $0x40
+ 563:	c3                   	ret
+
+00000564 <fstat>:
+SYSCALL(fstat)
+ 564:	b8 08 00 00 00       	mov    $0x8,%eax
+ 569:	cd 40                	int    $0x40
+ 56b:	c3                   	ret
+
+0000056c <link>:
+SYSCALL(link)
+ 56c:	b8 13 00 00 00       	mov    $0x13,%eax
+ 571:	cd 40                	int    $0x40
+ 573:	c3                   	ret
+
+00000574 <mkdir>:
+SYSCALL(mkdir)
+ 574:	b8 14 00 00 00       	mov    $0x14,%eax
+ 579:	cd 40                	int    $0x40
+ 57b:	c3                   	ret
+
+0000057c <chdir>:
+SYSCALL(chdir)
+ 57c:	b8 09 00 00 00       	mov    $0x9,%eax
+ 581:	cd 40                	int    $0x40
+ 583:	c3                   	ret
+
+00000584 <dup>:
+SYSCALL(dup)
+ 584:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 589:	cd 40                	int    $0x40
+ 58b:	c3                   	ret
+
+0000058c <getpid>:
+SYSCALL(getpid)
+ 58c:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 591:	cd 40                	int    $0x40
+ 593:	c3                   	ret
+
+00000594 <sbrk>:
+SYSCALL(sbrk)
+ 594:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 599:	cd 40                	int    $0x40
+ 59b:	c3                   	ret
+
+0000059c <sleep>:
+SYSCALL(sleep)
+ 59c:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 5a1:	cd 40                	int    $0x40
+ 5a3:	c3                   	ret
+
+000005a4 <uptime>:
+SYSCALL(uptime)
+ 5a4:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 5a9:	cd 40                	int    $0x40
+ 5ab:	c3                   	ret
+
+000005ac <arp>:
+SYSCALL(arp)
+ 5ac:	b8 16 00 00 00       	mov    $0x16,%eax
+ 5b1:	cd 40                	int    $0x40
+ 5b3:	c3                   	ret
+
+000005b4 <nicget>:
+SYSCALL(nicget)
+ 5b4:	b8 17 00 00 00       	mov    $0x17,%eax
+ 5b9:	cd 40                	int    $0x40
+ 5bb:	c3                   	ret
+
+000005bc <nicset>:
+SYSCALL(nicset)
+ 5bc:	b8 18 00 00 00       	mov    $0x18,%eax
+ 5c1:	cd 40                	int    $0x40
+ 5c3:	c3                   	ret
+
+000005c4 <nicstats>:
+SYSCALL(nicstats)
+ 5c4:	b8 19 00 00 00       	mov    $0x19,%eax
+ 5c9:	cd 40                	int    $0x40
+ 5cb:	c3                   	ret
+
+000005cc <nicsend>:
+SYSCALL(nicsend)
+ 5cc:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 5d1:	cd 40                	int    $0x40
+ 5d3:	c3                   	ret
+
+000005d4 <nicrecv>:
+SYSCALL(nicrecv)
+ 5d4:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 5d9:	cd 40                	int    $0x40
+ 5db:	c3                   	ret
+
+000005dc <arpdump>:
+SYSCALL(arpdump)
+ 5dc:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 5e1:	cd 40                	int    $0x40
+ 5e3:	c3                   	ret
+
+000005e4 <arpflush>:
+SYSCALL(arpflush)
+ 5e4:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 5e9:	cd 40                	int    $0x40
+ 5eb:	c3                   	ret
+
+000005ec <nicgetip>:
+SYSCALL(nicgetip)
+ 5ec:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 5f1:	cd 40                	int    $0x40
+ 5f3:	c3                   	ret
+
+000005f4 <nicsetip>:
+SYSCALL(nicsetip)
+ 5f4:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 5f9:	cd 40                	int    $0x40
+ 5fb:	c3                   	ret
+
+000005fc <arpresolve>:
+SYSCALL(arpresolve)
+ 5fc:	b8 20 00 00 00       	mov    $0x20,%eax
+ 601:	cd 40                	int    $0x40
+ 603:	c3                   	ret
+
+00000604 <arpresolvev>:
+SYSCALL(arpresolvev)
+ 604:	b8 21 00 00 00       	mov    $0x21,%eax
+ 609:	cd 40                	int    $0x40
+ 60b:	c3                   	ret
+
+0000060c <arpsend>:
+SYSCALL(arpsend)
+ 60c:	b8 22 00 00 00       	mov    $0x22,%eax
+ 611:	cd 40                	int    $0x40
+ 613:	c3                   	ret
+ 614:	66 90                	xchg   %ax,%ax
+ 616:	66 90                	xchg   %ax,%ax
+ 618:	66 90                	xchg   %ax,%ax
+ 61a:	66 90                	xchg   %ax,%ax
+ 61c:	66 90                	xchg   %ax,%ax
+ 61e:	66 90                	xchg   %ax,%ax
+
+00000620 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 620:	55                   	push   %ebp
+ 621:	89 e5                	mov    %esp,%ebp
+ 623:	57                   	push   %edi
+ 624:	56                   	push   %esi
+ 625:	53                   	push   %ebx
+ 626:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 628:	89 d1                	mov    %edx,%ecx
+{
+ 62a:	83 ec 3c             	sub    $0x3c,%esp
+ 62d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 630:	85 d2                	test   %edx,%edx
+ 632:	0f 89 80 00 00 00    	jns    6b8 <printint+0x98>
+ 638:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 63c:	74 7a                	je     6b8 <printint+0x98>
+    x = -xx;
+ 63e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 640:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 645:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 648:	31 f6                	xor    %esi,%esi
+ 64a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 650:	89 c8                	mov    %ecx,%eax
+ 652:	31 d2                	xor    %edx,%edx
+ 654:	89 f7                	mov    %esi,%edi
+ 656:	f7 f3                	div    %ebx
+ 658:	8d 76 01             	lea    0x1(%esi),%esi
+ 65b:	0f b6 92 8c 0b 00 00 	movzbl 0xb8c(%edx),%edx
+ 662:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 666:	89 ca                	mov    %ecx,%edx
+ 668:	89 c1                	mov    %eax,%ecx
+ 66a:	39 da                	cmp    %ebx,%edx
+ 66c:	73 e2                	jae    650 <printint+0x30>
+  if(neg)
+ 66e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 671:	85 c0                	test   %eax,%eax
+ 673:	74 07                	je     67c <printint+0x5c>
+    buf[i++] = '-';
+ 675:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 67a:	89 f7                	mov    %esi,%edi
+ 67c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 67f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 682:	01 df                	add    %ebx,%edi
+ 684:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 688:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 68b:	83 ec 04             	sub    $0x4,%esp
+ 68e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 691:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 694:	6a 01                	push   $0x1
+ 696:	50                   	push   %eax
+ 697:	56                   	push   %esi
+ 698:	e8 8f fe ff ff       	call   52c <write>
+  while(--i >= 0)
+ 69d:	89 f8                	mov    %edi,%eax
+ 69f:	83 c4 10             	add    $0x10,%esp
+ 6a2:	83 ef 01             	sub    $0x1,%edi
+ 6a5:	39 d8                	cmp    %ebx,%eax
+ 6a7:	75 df                	jne    688 <printint+0x68>
+}
+ 6a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6ac:	5b                   	pop    %ebx
+ 6ad:	5e                   	pop    %esi
+ 6ae:	5f                   	pop    %edi
+ 6af:	5d                   	pop    %ebp
+ 6b0:	c3                   	ret
+ 6b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 6b8:	31 c0                	xor    %eax,%eax
+ 6ba:	eb 89                	jmp    645 <printint+0x25>
+ 6bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000006c0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 6c0:	55                   	push   %ebp
+ 6c1:	89 e5                	mov    %esp,%ebp
+ 6c3:	57                   	push   %edi
+ 6c4:	56                   	push   %esi
+ 6c5:	53                   	push   %ebx
+ 6c6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 6c9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 6cc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 6cf:	0f b6 1e             	movzbl (%esi),%ebx
+ 6d2:	83 c6 01             	add    $0x1,%esi
+ 6d5:	84 db                	test   %bl,%bl
+ 6d7:	74 67                	je     740 <printf+0x80>
+ 6d9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 6dc:	31 d2                	xor    %edx,%edx
+ 6de:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 6e1:	eb 34                	jmp    717 <printf+0x57>
+ 6e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 6e7:	90                   	nop
+ 6e8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 6eb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 6f0:	83 f8 25             	cmp    $0x25,%eax
+ 6f3:	74 18                	je     70d <printf+0x4d>
+  write(fd, &c, 1);
+ 6f5:	83 ec 04             	sub    $0x4,%esp
+ 6f8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 6fb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 6fe:	6a 01                	push   $0x1
+ 700:	50                   	push   %eax
+ 701:	57                   	push   %edi
+ 702:	e8 25 fe ff ff       	call   52c <write>
+ 707:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 70a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 70d:	0f b6 1e             	movzbl (%esi),%ebx
+ 710:	83 c6 01             	add    $0x1,%esi
+ 713:	84 db                	test   %bl,%bl
+ 715:	74 29                	je     740 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 717:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 71a:	85 d2                	test   %edx,%edx
+ 71c:	74 ca                	je     6e8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 71e:	83 fa 25             	cmp    $0x25,%edx
+ 721:	75 ea                	jne    70d <printf+0x4d>
+      if(c == 'd'){
+ 723:	83 f8 25             	cmp    $0x25,%eax
+ 726:	0f 84 24 01 00 00    	je     850 <printf+0x190>
+ 72c:	83 e8 63             	sub    $0x63,%eax
+ 72f:	83 f8 15             	cmp    $0x15,%eax
+ 732:	77 1c                	ja     750 <printf+0x90>
+ 734:	ff 24 85 34 0b 00 00 	jmp    *0xb34(,%eax,4)
+ 73b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 73f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 740:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 743:	5b                   	pop    %ebx
+ 744:	5e                   	pop    %esi
+ 745:	5f                   	pop    %edi
+ 746:	5d                   	pop    %ebp
+ 747:	c3                   	ret
+ 748:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 74f:	90                   	nop
+  write(fd, &c, 1);
+ 750:	83 ec 04             	sub    $0x4,%esp
+ 753:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 756:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 75a:	6a 01                	push   $0x1
+ 75c:	52                   	push   %edx
+ 75d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 760:	57                   	push   %edi
+ 761:	e8 c6 fd ff ff       	call   52c <write>
+ 766:	83 c4 0c             	add    $0xc,%esp
+ 769:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 76c:	6a 01                	push   $0x1
+ 76e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 771:	52                   	push   %edx
+ 772:	57                   	push   %edi
+ 773:	e8 b4 fd ff ff       	call   52c <write>
+        putc(fd, c);
+ 778:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 77b:	31 d2                	xor    %edx,%edx
+ 77d:	eb 8e                	jmp    70d <printf+0x4d>
+ 77f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 780:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 783:	83 ec 0c             	sub    $0xc,%esp
+ 786:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 78b:	8b 13                	mov    (%ebx),%edx
+ 78d:	6a 00                	push   $0x0
+ 78f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 791:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 794:	e8 87 fe ff ff       	call   620 <printint>
+        ap++;
+ 799:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 79c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 79f:	31 d2                	xor    %edx,%edx
+ 7a1:	e9 67 ff ff ff       	jmp    70d <printf+0x4d>
+ 7a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7ad:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 7b0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 7b3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 7b5:	83 c0 04             	add    $0x4,%eax
+ 7b8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 7bb:	85 db                	test   %ebx,%ebx
+ 7bd:	0f 84 9d 00 00 00    	je     860 <printf+0x1a0>
+        while(*s != 0){
+ 7c3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 7c6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 7c8:	84 c0                	test   %al,%al
+ 7ca:	0f 84 3d ff ff ff    	je     70d <printf+0x4d>
+ 7d0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 7d3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 7d6:	89 de                	mov    %ebx,%esi
+ 7d8:	89 d3                	mov    %edx,%ebx
+ 7da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 7e0:	83 ec 04             	sub    $0x4,%esp
+ 7e3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 7e6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 7e9:	6a 01                	push   $0x1
+ 7eb:	53                   	push   %ebx
+ 7ec:	57                   	push   %edi
+ 7ed:	e8 3a fd ff ff       	call   52c <write>
+        while(*s != 0){
+ 7f2:	0f b6 06             	movzbl (%esi),%eax
+ 7f5:	83 c4 10             	add    $0x10,%esp
+ 7f8:	84 c0                	test   %al,%al
+ 7fa:	75 e4                	jne    7e0 <printf+0x120>
+      state = 0;
+ 7fc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 7ff:	31 d2                	xor    %edx,%edx
+ 801:	e9 07 ff ff ff       	jmp    70d <printf+0x4d>
+ 806:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 80d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 810:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 813:	83 ec 0c             	sub    $0xc,%esp
+ 816:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 81b:	8b 13                	mov    (%ebx),%edx
+ 81d:	6a 01                	push   $0x1
+ 81f:	e9 6b ff ff ff       	jmp    78f <printf+0xcf>
+ 824:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 828:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 82b:	83 ec 04             	sub    $0x4,%esp
+ 82e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 831:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 833:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 836:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 839:	6a 01                	push   $0x1
+ 83b:	52                   	push   %edx
+ 83c:	57                   	push   %edi
+ 83d:	e8 ea fc ff ff       	call   52c <write>
+        ap++;
+ 842:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 845:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 848:	31 d2                	xor    %edx,%edx
+ 84a:	e9 be fe ff ff       	jmp    70d <printf+0x4d>
+ 84f:	90                   	nop
+  write(fd, &c, 1);
+ 850:	83 ec 04             	sub    $0x4,%esp
+ 853:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 856:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 859:	6a 01                	push   $0x1
+ 85b:	e9 11 ff ff ff       	jmp    771 <printf+0xb1>
+ 860:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 865:	bb 2b 0b 00 00       	mov    $0xb2b,%ebx
+ 86a:	e9 61 ff ff ff       	jmp    7d0 <printf+0x110>
+ 86f:	90                   	nop
+
+00000870 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 870:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 871:	a1 78 0f 00 00       	mov    0xf78,%eax
+{
+ 876:	89 e5                	mov    %esp,%ebp
+ 878:	57                   	push   %edi
+ 879:	56                   	push   %esi
+ 87a:	53                   	push   %ebx
+ 87b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 87e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 881:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 888:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 88a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 88c:	39 ca                	cmp    %ecx,%edx
+ 88e:	73 30                	jae    8c0 <free+0x50>
+ 890:	39 c1                	cmp    %eax,%ecx
+ 892:	72 04                	jb     898 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 894:	39 c2                	cmp    %eax,%edx
+ 896:	72 f0                	jb     888 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 898:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 89b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 89e:	39 f8                	cmp    %edi,%eax
+ 8a0:	74 2e                	je     8d0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 8a2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 8a5:	8b 42 04             	mov    0x4(%edx),%eax
+ 8a8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 8ab:	39 f1                	cmp    %esi,%ecx
+ 8ad:	74 38                	je     8e7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 8af:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 8b1:	5b                   	pop    %ebx
+  freep = p;
+ 8b2:	89 15 78 0f 00 00    	mov    %edx,0xf78
+}
+ 8b8:	5e                   	pop    %esi
+ 8b9:	5f                   	pop    %edi
+ 8ba:	5d                   	pop    %ebp
+ 8bb:	c3                   	ret
+ 8bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 8c0:	39 c1                	cmp    %eax,%ecx
+ 8c2:	72 d0                	jb     894 <free+0x24>
+ 8c4:	eb c2                	jmp    888 <free+0x18>
+ 8c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8cd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 8d0:	03 70 04             	add    0x4(%eax),%esi
+ 8d3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 8d6:	8b 02                	mov    (%edx),%eax
+ 8d8:	8b 00                	mov    (%eax),%eax
+ 8da:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 8dd:	8b 42 04             	mov    0x4(%edx),%eax
+ 8e0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 8e3:	39 f1                	cmp    %esi,%ecx
+ 8e5:	75 c8                	jne    8af <free+0x3f>
+    p->s.size += bp->s.size;
+ 8e7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 8ea:	89 15 78 0f 00 00    	mov    %edx,0xf78
+    p->s.size += bp->s.size;
+ 8f0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 8f3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 8f6:	89 0a                	mov    %ecx,(%edx)
+}
+ 8f8:	5b                   	pop    %ebx
+ 8f9:	5e                   	pop    %esi
+ 8fa:	5f                   	pop    %edi
+ 8fb:	5d                   	pop    %ebp
+ 8fc:	c3                   	ret
+ 8fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000900 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 900:	55                   	push   %ebp
+ 901:	89 e5                	mov    %esp,%ebp
+ 903:	57                   	push   %edi
+ 904:	56                   	push   %esi
+ 905:	53                   	push   %ebx
+ 906:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 909:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 90c:	8b 15 78 0f 00 00    	mov    0xf78,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 912:	8d 78 07             	lea    0x7(%eax),%edi
+ 915:	c1 ef 03             	shr    $0x3,%edi
+ 918:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 91b:	85 d2                	test   %edx,%edx
+ 91d:	0f 84 8d 00 00 00    	je     9b0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 923:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 925:	8b 48 04             	mov    0x4(%eax),%ecx
+ 928:	39 f9                	cmp    %edi,%ecx
+ 92a:	73 64                	jae    990 <malloc+0x90>
+  if(nu < 4096)
+ 92c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 931:	39 df                	cmp    %ebx,%edi
+ 933:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 936:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 93d:	eb 0a                	jmp    949 <malloc+0x49>
+ 93f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 940:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 942:	8b 48 04             	mov    0x4(%eax),%ecx
+ 945:	39 f9                	cmp    %edi,%ecx
+ 947:	73 47                	jae    990 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 949:	89 c2                	mov    %eax,%edx
+ 94b:	39 05 78 0f 00 00    	cmp    %eax,0xf78
+ 951:	75 ed                	jne    940 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 953:	83 ec 0c             	sub    $0xc,%esp
+ 956:	56                   	push   %esi
+ 957:	e8 38 fc ff ff       	call   594 <sbrk>
+  if(p == (char*)-1)
+ 95c:	83 c4 10             	add    $0x10,%esp
+ 95f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 962:	74 1c                	je     980 <malloc+0x80>
+  hp->s.size = nu;
+ 964:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 967:	83 ec 0c             	sub    $0xc,%esp
+ 96a:	83 c0 08             	add    $0x8,%eax
+ 96d:	50                   	push   %eax
+ 96e:	e8 fd fe ff ff       	call   870 <free>
+  return freep;
+ 973:	8b 15 78 0f 00 00    	mov    0xf78,%edx
+      if((p = morecore(nunits)) == 0)
+ 979:	83 c4 10             	add    $0x10,%esp
+ 97c:	85 d2                	test   %edx,%edx
+ 97e:	75 c0                	jne    940 <malloc+0x40>
+        return 0;
+  }
+}
+ 980:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 983:	31 c0                	xor    %eax,%eax
+}
+ 985:	5b                   	pop    %ebx
+ 986:	5e                   	pop    %esi
+ 987:	5f                   	pop    %edi
+ 988:	5d                   	pop    %ebp
+ 989:	c3                   	ret
+ 98a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 990:	39 cf                	cmp    %ecx,%edi
+ 992:	74 4c                	je     9e0 <malloc+0xe0>
+        p->s.size -= nunits;
+ 994:	29 f9                	sub    %edi,%ecx
+ 996:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 999:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 99c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 99f:	89 15 78 0f 00 00    	mov    %edx,0xf78
+}
+ 9a5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 9a8:	83 c0 08             	add    $0x8,%eax
+}
+ 9ab:	5b                   	pop    %ebx
+ 9ac:	5e                   	pop    %esi
+ 9ad:	5f                   	pop    %edi
+ 9ae:	5d                   	pop    %ebp
+ 9af:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 9b0:	c7 05 78 0f 00 00 7c 	movl   $0xf7c,0xf78
+ 9b7:	0f 00 00 
+    base.s.size = 0;
+ 9ba:	b8 7c 0f 00 00       	mov    $0xf7c,%eax
+    base.s.ptr = freep = prevp = &base;
+ 9bf:	c7 05 7c 0f 00 00 7c 	movl   $0xf7c,0xf7c
+ 9c6:	0f 00 00 
+    base.s.size = 0;
+ 9c9:	c7 05 80 0f 00 00 00 	movl   $0x0,0xf80
+ 9d0:	00 00 00 
+    if(p->s.size >= nunits){
+ 9d3:	e9 54 ff ff ff       	jmp    92c <malloc+0x2c>
+ 9d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9df:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 9e0:	8b 08                	mov    (%eax),%ecx
+ 9e2:	89 0a                	mov    %ecx,(%edx)
+ 9e4:	eb b9                	jmp    99f <malloc+0x9f>
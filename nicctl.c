@@ -0,0 +1,100 @@
+/**
+ *read and tune NIC parameters
+ *usage: nicctl [interface [param [value]]]
+ *with no arguments, lists the interfaces
+ */
+#include "types.h"
+#include "user.h"
+#include "nicctl.h"
+
+struct param {
+  char *name;
+  int id;
+};
+
+static struct param params[] = {
+  { "itr", NICCTL_ITR },
+  { "rdtr", NICCTL_RDTR },
+  { "radv", NICCTL_RADV },
+  { "tidv", NICCTL_TIDV },
+  { "tadv", NICCTL_TADV },
+  { "budget", NICCTL_POLL_BUDGET },
+  { "rx_intr", NICCTL_RX_INTR },
+  { "rx_poll", NICCTL_RX_POLL },
+  { "rx_ring", NICCTL_RX_RING },
+  { "tx_ring", NICCTL_TX_RING },
+  { "rx_nobuf", NICCTL_RX_NOBUF },
+  { "rx_free", NICCTL_RX_FREE },
+  { "copybreak", NICCTL_COPYBREAK },
+  { "rx_copy", NICCTL_RX_COPY },
+  { "rx_flip", NICCTL_RX_FLIP },
+  { "mtu", NICCTL_MTU },
+  { "loopback", NICCTL_LOOPBACK },
+  { "raw_drops", NICCTL_RAW_DROPS },
+  { "link", NICCTL_LINK },
+  { "speed", NICCTL_SPEED },
+  { "duplex", NICCTL_DUPLEX },
+  { "arpq_drops", NICCTL_ARPQ_DROPS },
+  { 0, 0 },
+};
+
+static void show(char *interface, struct param *p) {
+  uint v;
+
+  if(nicget(interface, p->id, &v) < 0)
+    printf(1, "%s: n/a\n", p->name);
+  else if(v / 10)   //printf has no unsigned %d
+    printf(1, "%s: %d%d\n", p->name, v / 10, v % 10);
+  else
+    printf(1, "%s: %d\n", p->name, v);
+}
+
+// One line per interface. Registered ones are numbered without holes,
+// so the first ethN nicget doesn't know ends the list
+static void list(void) {
+  char name[8];
+  uint mtu, link, speed;
+
+  strcpy(name, "eth0");
+  for(; nicget(name, NICCTL_MTU, &mtu) >= 0; name[3]++) {
+    if(nicget(name, NICCTL_LINK, &link) < 0)
+      link = 0;
+    printf(1, "%s: mtu %d, link %s", name, mtu, link ? "up" : "down");
+    if(link && nicget(name, NICCTL_SPEED, &speed) >= 0)
+      printf(1, " %d Mb/s", speed);
+    printf(1, "\n");
+  }
+}
+
+int main(int argc, char *argv[]) {
+  struct param *p;
+
+  if(argc > 4) {
+    printf(2, "usage: nicctl [interface [param [value]]]\n");
+    exit();
+  }
+
+  if(argc == 1) {
+    list();
+    exit();
+  }
+
+  if(argc == 2) {
+    for(p = params; p->name; p++)
+      show(argv[1], p);
+    exit();
+  }
+
+  for(p = params; p->name; p++)
+    if(strcmp(p->name, argv[2]) == 0)
+      break;
+  if(p->name == 0) {
+    printf(2, "nicctl: unknown param %s\n", argv[2]);
+    exit();
+  }
+
+  if(argc == 4 && nicset(argv[1], p->id, atoi(argv[3])) < 0)
+    printf(2, "nicctl: failed to set %s\n", p->name);
+  show(argv[1], p);
+  exit();
+}
@@ -0,0 +1,52 @@
+#ifndef __XV6_NETSTACK_NICCTL_H__
+#define __XV6_NETSTACK_NICCTL_H__
+/**
+ *NIC tunables for the nicget/nicset system calls.
+ *shared by the kernel and user space
+ */
+
+//Interrupt moderation, in e1000 register units
+#define NICCTL_ITR        1   //min gap between interrupts, 256ns units. 0 = off
+#define NICCTL_RDTR       2   //receive interrupt delay timer, 1.024us units
+#define NICCTL_RADV       3   //receive absolute interrupt delay, 1.024us units
+#define NICCTL_TIDV       4   //transmit interrupt delay timer, 1.024us units
+#define NICCTL_TADV       5   //transmit absolute interrupt delay, 1.024us units
+
+//Hybrid interrupt/poll receive
+#define NICCTL_POLL_BUDGET  6   //frames per poll pass, 1..NIC_POLL_BUDGET_MAX
+#define NICCTL_RX_INTR      7   //frames handled in interrupt mode, read only
+#define NICCTL_RX_POLL      8   //frames handled in polled mode, read only
+
+//Descriptor ring sizes, read only. Chosen when the driver initialises
+#define NICCTL_RX_RING      9
+#define NICCTL_TX_RING      10
+
+//Receive buffer pool, read only
+#define NICCTL_RX_NOBUF     11  //frames dropped with no free buffer to refill
+#define NICCTL_RX_FREE      12  //buffers currently free in the pool
+
+//Receive copybreak
+#define NICCTL_COPYBREAK    13  //frames shorter than this many bytes are copied
+#define NICCTL_RX_COPY      14  //frames passed up in a copied small buffer, read only
+#define NICCTL_RX_FLIP      15  //frames passed up in their ring buffer, read only
+
+//Largest frame payload, NIC_MIN_MTU up to what the driver's receive
+//buffers hold (at most 9000)
+#define NICCTL_MTU          16
+
+//Loopback, 1 = transmitted frames come back in instead of going out
+#define NICCTL_LOOPBACK     17
+
+//Raw frames (see nicsend/nicrecv) dropped because nobody read them, read only
+#define NICCTL_RAW_DROPS    18
+
+//Link state, read only
+#define NICCTL_LINK         19  //1 if up
+#define NICCTL_SPEED        20  //Mb/s, 0 while down
+#define NICCTL_DUPLEX       21  //1 if full duplex
+
+//Frames dropped waiting for ARP: neighbor queue overflow, no buffer,
+//or the neighbor never answered. Read only
+#define NICCTL_ARPQ_DROPS   22
+
+#endif
@@ -0,0 +1,1416 @@
+
+_nicstat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+    buf[--pos] = '0' + r;
+  } while(!zero);
+  printf(1, "%s", &buf[pos]);
+}
+
+int main(int argc, char *argv[]) {
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	81 ec 48 01 00 00    	sub    $0x148,%esp
+  uint64_t stats[NICSTAT_COUNT];
+  int n;
+
+  if(argc != 2) {
+  17:	83 39 02             	cmpl   $0x2,(%ecx)
+int main(int argc, char *argv[]) {
+  1a:	8b 59 04             	mov    0x4(%ecx),%ebx
+  if(argc != 2) {
+  1d:	74 13                	je     32 <main+0x32>
+    printf(2, "usage: nicstat interface\n");
+  1f:	50                   	push   %eax
+  20:	50                   	push   %eax
+  21:	68 60 09 00 00       	push   $0x960
+  26:	6a 02                	push   $0x2
+  28:	e8 f3 05 00 00       	call   620 <printf>
+    exit();
+  2d:	e8 3a 04 00 00       	call   46c <exit>
+  }
+
+  if((n = nicstats(argv[1], stats, NICSTAT_COUNT)) < 0) {
+  32:	8d 85 d8 fe ff ff    	lea    -0x128(%ebp),%eax
+  38:	57                   	push   %edi
+  39:	6a 22                	push   $0x22
+  3b:	50                   	push   %eax
+  3c:	ff 73 04             	push   0x4(%ebx)
+  3f:	e8 e0 04 00 00       	call   524 <nicstats>
+  44:	83 c4 10             	add    $0x10,%esp
+  47:	89 85 a8 fe ff ff    	mov    %eax,-0x158(%ebp)
+  4d:	85 c0                	test   %eax,%eax
+  4f:	0f 88 3b 01 00 00    	js     190 <main+0x190>
+    printf(2, "nicstat: no statistics for %s\n", argv[1]);
+    exit();
+  }
+
+  printf(1, "NIC statistics:\n");
+  55:	53                   	push   %ebx
+  56:	53                   	push   %ebx
+  57:	68 7a 09 00 00       	push   $0x97a
+  5c:	6a 01                	push   $0x1
+  5e:	e8 bd 05 00 00       	call   620 <printf>
+  for(int i = 0; i < n; i++) {
+  63:	83 c4 10             	add    $0x10,%esp
+  66:	83 bd a8 fe ff ff 00 	cmpl   $0x0,-0x158(%ebp)
+  6d:	0f 84 18 01 00 00    	je     18b <main+0x18b>
+  73:	31 ff                	xor    %edi,%edi
+  75:	8d b5 c2 fe ff ff    	lea    -0x13e(%ebp),%esi
+    uint r = 0;
+  7b:	89 fb                	mov    %edi,%ebx
+  7d:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(1, "     %s: ", names[i]);
+  80:	83 ec 04             	sub    $0x4,%esp
+  83:	ff 34 9d e0 0b 00 00 	push   0xbe0(,%ebx,4)
+  8a:	68 8b 09 00 00       	push   $0x98b
+  8f:	6a 01                	push   $0x1
+  91:	e8 8a 05 00 00       	call   620 <printf>
+    print64(stats[i]);
+  96:	8b 8c dd dc fe ff ff 	mov    -0x124(%ebp,%ebx,8),%ecx
+  buf[pos] = 0;
+  9d:	83 c4 10             	add    $0x10,%esp
+    print64(stats[i]);
+  a0:	8b 94 dd d8 fe ff ff 	mov    -0x128(%ebp,%ebx,8),%edx
+  buf[pos] = 0;
+  a7:	c6 85 d7 fe ff ff 00 	movb   $0x0,-0x129(%ebp)
+    d[i] = (v >> (48 - 16*i)) & 0xffff;
+  ae:	89 c8                	mov    %ecx,%eax
+  b0:	89 95 b0 fe ff ff    	mov    %edx,-0x150(%ebp)
+  b6:	c1 e8 10             	shr    $0x10,%eax
+  b9:	66 89 8d bc fe ff ff 	mov    %cx,-0x144(%ebp)
+  c0:	66 89 85 ba fe ff ff 	mov    %ax,-0x146(%ebp)
+  c7:	89 d0                	mov    %edx,%eax
+  c9:	0f ac c8 10          	shrd   $0x10,%ecx,%eax
+  cd:	89 8d b4 fe ff ff    	mov    %ecx,-0x14c(%ebp)
+  d3:	66 89 85 be fe ff ff 	mov    %ax,-0x142(%ebp)
+  da:	0f b7 85 b0 fe ff ff 	movzwl -0x150(%ebp),%eax
+      d[i] = cur / 10;
+  e1:	89 9d ac fe ff ff    	mov    %ebx,-0x154(%ebp)
+    d[i] = (v >> (48 - 16*i)) & 0xffff;
+  e7:	66 89 85 c0 fe ff ff 	mov    %ax,-0x140(%ebp)
+  int i, pos = sizeof(buf) - 1, zero;
+  ee:	b8 14 00 00 00       	mov    $0x14,%eax
+  f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  f7:	90                   	nop
+    uint r = 0;
+  f8:	89 85 b0 fe ff ff    	mov    %eax,-0x150(%ebp)
+  fe:	8d 9d ba fe ff ff    	lea    -0x146(%ebp),%ebx
+    zero = 1;
+ 104:	bf 01 00 00 00       	mov    $0x1,%edi
+    uint r = 0;
+ 109:	31 c9                	xor    %ecx,%ecx
+      uint cur = (r << 16) | d[i];
+ 10b:	0f b7 03             	movzwl (%ebx),%eax
+ 10e:	c1 e1 10             	shl    $0x10,%ecx
+ 111:	09 c1                	or     %eax,%ecx
+      d[i] = cur / 10;
+ 113:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+ 118:	f7 e1                	mul    %ecx
+ 11a:	c1 ea 03             	shr    $0x3,%edx
+      r = cur % 10;
+ 11d:	8d 04 92             	lea    (%edx,%edx,4),%eax
+      d[i] = cur / 10;
+ 120:	66 89 13             	mov    %dx,(%ebx)
+      r = cur % 10;
+ 123:	01 c0                	add    %eax,%eax
+ 125:	29 c1                	sub    %eax,%ecx
+        zero = 0;
+ 127:	31 c0                	xor    %eax,%eax
+ 129:	66 85 d2             	test   %dx,%dx
+ 12c:	0f 45 f8             	cmovne %eax,%edi
+    for(i = 0; i < 4; i++) {
+ 12f:	83 c3 02             	add    $0x2,%ebx
+ 132:	39 f3                	cmp    %esi,%ebx
+ 134:	75 d5                	jne    10b <main+0x10b>
+    buf[--pos] = '0' + r;
+ 136:	8b 85 b0 fe ff ff    	mov    -0x150(%ebp),%eax
+ 13c:	83 c1 30             	add    $0x30,%ecx
+ 13f:	83 e8 01             	sub    $0x1,%eax
+ 142:	88 8c 05 c3 fe ff ff 	mov    %cl,-0x13d(%ebp,%eax,1)
+  } while(!zero);
+ 149:	85 ff                	test   %edi,%edi
+ 14b:	74 ab                	je     f8 <main+0xf8>
+  printf(1, "%s", &buf[pos]);
+ 14d:	8d bd c3 fe ff ff    	lea    -0x13d(%ebp),%edi
+ 153:	83 ec 04             	sub    $0x4,%esp
+ 156:	8b 9d ac fe ff ff    	mov    -0x154(%ebp),%ebx
+ 15c:	01 f8                	add    %edi,%eax
+ 15e:	50                   	push   %eax
+  for(int i = 0; i < n; i++) {
+ 15f:	83 c3 01             	add    $0x1,%ebx
+  printf(1, "%s", &buf[pos]);
+ 162:	68 95 09 00 00       	push   $0x995
+ 167:	6a 01                	push   $0x1
+ 169:	e8 b2 04 00 00       	call   620 <printf>
+    printf(1, "\n");
+ 16e:	58                   	pop    %eax
+ 16f:	5a                   	pop    %edx
+ 170:	68 89 09 00 00       	push   $0x989
+ 175:	6a 01                	push   $0x1
+ 177:	e8 a4 04 00 00       	call   620 <printf>
+  for(int i = 0; i < n; i++) {
+ 17c:	83 c4 10             	add    $0x10,%esp
+ 17f:	39 9d a8 fe ff ff    	cmp    %ebx,-0x158(%ebp)
+ 185:	0f 85 f5 fe ff ff    	jne    80 <main+0x80>
+  }
+  exit();
+ 18b:	e8 dc 02 00 00       	call   46c <exit>
+    printf(2, "nicstat: no statistics for %s\n", argv[1]);
+ 190:	56                   	push   %esi
+ 191:	ff 73 04             	push   0x4(%ebx)
+ 194:	68 b0 0b 00 00       	push   $0xbb0
+ 199:	6a 02                	push   $0x2
+ 19b:	e8 80 04 00 00       	call   620 <printf>
+    exit();
+ 1a0:	e8 c7 02 00 00       	call   46c <exit>
+ 1a5:	66 90                	xchg   %ax,%ax
+ 1a7:	66 90                	xchg   %ax,%ax
+ 1a9:	66 90                	xchg   %ax,%ax
+ 1ab:	66 90                	xchg   %ax,%ax
+ 1ad:	66 90                	xchg   %ax,%ax
+ 1af:	90                   	nop
+
+000001b0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 1b0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 1b1:	31 c0                	xor    %eax,%eax
+{
+ 1b3:	89 e5                	mov    %esp,%ebp
+ 1b5:	53                   	push   %ebx
+ 1b6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 1b9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 1bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 1c0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 1c4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 1c7:	83 c0 01             	add    $0x1,%eax
+ 1ca:	84 d2                	test   %dl,%dl
+ 1cc:	75 f2                	jne    1c0 <strcpy+0x10>
+    ;
+  return os;
+}
+ 1ce:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1d1:	89 c8                	mov    %ecx,%eax
+ 1d3:	c9                   	leave
+ 1d4:	c3                   	ret
+ 1d5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000001e0 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 1e0:	55                   	push   %ebp
+ 1e1:	89 e5                	mov    %esp,%ebp
+ 1e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 1e6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 1e9:	74 15                	je     200 <strlen+0x20>
+ 1eb:	31 c0                	xor    %eax,%eax
+ 1ed:	8d 76 00             	lea    0x0(%esi),%esi
+ 1f0:	83 c0 01             	add    $0x1,%eax
+ 1f3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 1f7:	89 c1                	mov    %eax,%ecx
+ 1f9:	75 f5                	jne    1f0 <strlen+0x10>
+    ;
+  return n;
+}
+ 1fb:	89 c8                	mov    %ecx,%eax
+ 1fd:	5d                   	pop    %ebp
+ 1fe:	c3                   	ret
+ 1ff:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 200:	31 c9                	xor    %ecx,%ecx
+}
+ 202:	5d                   	pop    %ebp
+ 203:	89 c8                	mov    %ecx,%eax
+ 205:	c3                   	ret
+ 206:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 20d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000210 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 210:	55                   	push   %ebp
+ 211:	89 e5                	mov    %esp,%ebp
+ 213:	57                   	push   %edi
+ 214:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 217:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 21a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 21d:	89 d7                	mov    %edx,%edi
+ 21f:	fc                   	cld
+ 220:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 222:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 225:	89 d0                	mov    %edx,%eax
+ 227:	c9                   	leave
+ 228:	c3                   	ret
+ 229:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000230 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 230:	55                   	push   %ebp
+ 231:	89 e5                	mov    %esp,%ebp
+ 233:	8b 45 08             	mov    0x8(%ebp),%eax
+ 236:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 23a:	0f b6 10             	movzbl (%eax),%edx
+ 23d:	84 d2                	test   %dl,%dl
+ 23f:	75 12                	jne    253 <strchr+0x23>
+ 241:	eb 1d                	jmp    260 <strchr+0x30>
+ 243:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 247:	90                   	nop
+ 248:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 24c:	83 c0 01             	add    $0x1,%eax
+ 24f:	84 d2                	test   %dl,%dl
+ 251:	74 0d                	je     260 <strchr+0x30>
+    if(*s == c)
+ 253:	38 d1                	cmp    %dl,%cl
+ 255:	75 f1                	jne    248 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 257:	5d                   	pop    %ebp
+ 258:	c3                   	ret
+ 259:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 260:	31 c0                	xor    %eax,%eax
+}
+ 262:	5d                   	pop    %ebp
+ 263:	c3                   	ret
+ 264:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 26b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 26f:	90                   	nop
+
+00000270 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 270:	55                   	push   %ebp
+ 271:	89 e5                	mov    %esp,%ebp
+ 273:	57                   	push   %edi
+ 274:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 275:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 278:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 279:	31 db                	xor    %ebx,%ebx
+{
+ 27b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 27e:	eb 27                	jmp    2a7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 280:	83 ec 04             	sub    $0x4,%esp
+ 283:	6a 01                	push   $0x1
+ 285:	56                   	push   %esi
+ 286:	6a 00                	push   $0x0
+ 288:	e8 f7 01 00 00       	call   484 <read>
+    if(cc < 1)
+ 28d:	83 c4 10             	add    $0x10,%esp
+ 290:	85 c0                	test   %eax,%eax
+ 292:	7e 1d                	jle    2b1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 294:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 298:	8b 55 08             	mov    0x8(%ebp),%edx
+ 29b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 29f:	3c 0a                	cmp    $0xa,%al
+ 2a1:	74 10                	je     2b3 <gets+0x43>
+ 2a3:	3c 0d                	cmp    $0xd,%al
+ 2a5:	74 0c                	je     2b3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 2a7:	89 df                	mov    %ebx,%edi
+ 2a9:	83 c3 01             	add    $0x1,%ebx
+ 2ac:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 2af:	7c cf                	jl     280 <gets+0x10>
+ 2b1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 2b3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2b6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 2ba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 2bd:	5b                   	pop    %ebx
+ 2be:	5e                   	pop    %esi
+ 2bf:	5f                   	pop    %edi
+ 2c0:	5d                   	pop    %ebp
+ 2c1:	c3                   	ret
+ 2c2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000002d0 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 2d0:	55                   	push   %ebp
+ 2d1:	89 e5                	mov    %esp,%ebp
+ 2d3:	56                   	push   %esi
+ 2d4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 2d5:	83 ec 08             	sub    $0x8,%esp
+ 2d8:	6a 00                	push   $0x0
+ 2da:	ff 75 08             	push   0x8(%ebp)
+ 2dd:	e8 ca 01 00 00       	call   4ac <open>
+  if(fd < 0)
+ 2e2:	83 c4 10             	add    $0x10,%esp
+ 2e5:	85 c0                	test   %eax,%eax
+ 2e7:	78 27                	js     310 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 2e9:	83 ec 08             	sub    $0x8,%esp
+ 2ec:	ff 75 0c             	push   0xc(%ebp)
+ 2ef:	89 c3                	mov    %eax,%ebx
+ 2f1:	50                   	push   %eax
+ 2f2:	e8 cd 01 00 00       	call   4c4 <fstat>
+  close(fd);
+ 2f7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 2fa:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 2fc:	e8 93 01 00 00       	call   494 <close>
+  return r;
+ 301:	83 c4 10             	add    $0x10,%esp
+}
+ 304:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 307:	89 f0                	mov    %esi,%eax
+ 309:	5b                   	pop    %ebx
+ 30a:	5e                   	pop    %esi
+ 30b:	5d                   	pop    %ebp
+ 30c:	c3                   	ret
+ 30d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 310:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 315:	eb ed                	jmp    304 <stat+0x34>
+ 317:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 31e:	66 90                	xchg   %ax,%ax
+
+00000320 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 320:	55                   	push   %ebp
+ 321:	89 e5                	mov    %esp,%ebp
+ 323:	57                   	push   %edi
+ 324:	56                   	push   %esi
+ 325:	8b 45 10             	mov    0x10(%ebp),%eax
+ 328:	8b 55 08             	mov    0x8(%ebp),%edx
+ 32b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 32e:	85 c0                	test   %eax,%eax
+ 330:	7e 13                	jle    345 <memmove+0x25>
+ 332:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 334:	89 d7                	mov    %edx,%edi
+ 336:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 33d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 340:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 341:	39 f8                	cmp    %edi,%eax
+ 343:	75 fb                	jne    340 <memmove+0x20>
+  return vdst;
+}
+ 345:	5e                   	pop    %esi
+ 346:	89 d0                	mov    %edx,%eax
+ 348:	5f                   	pop    %edi
+ 349:	5d                   	pop    %ebp
+ 34a:	c3                   	ret
+ 34b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 34f:	90                   	nop
+
+00000350 <parseip>:
+
+// a.b.c.d to network byte order. -1 if malformed
+int
+parseip(char *s, uint *addr)
+{
+ 350:	55                   	push   %ebp
+ 351:	89 e5                	mov    %esp,%ebp
+ 353:	57                   	push   %edi
+  uint8_t *b = (uint8_t*)addr;
+  int v;
+
+  for(int i = 0; i < 4; i++) {
+ 354:	31 ff                	xor    %edi,%edi
+{
+ 356:	56                   	push   %esi
+ 357:	53                   	push   %ebx
+ 358:	8b 55 08             	mov    0x8(%ebp),%edx
+    if(*s < '0' || *s > '9')
+ 35b:	0f be 02             	movsbl (%edx),%eax
+ 35e:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 361:	80 f9 09             	cmp    $0x9,%cl
+ 364:	77 59                	ja     3bf <parseip+0x6f>
+      return -1;
+    for(v = 0; *s >= '0' && *s <= '9'; s++)
+ 366:	31 c9                	xor    %ecx,%ecx
+ 368:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 36f:	90                   	nop
+      v = v * 10 + *s - '0';
+ 370:	89 d6                	mov    %edx,%esi
+ 372:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    for(v = 0; *s >= '0' && *s <= '9'; s++)
+ 375:	83 c2 01             	add    $0x1,%edx
+      v = v * 10 + *s - '0';
+ 378:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+    for(v = 0; *s >= '0' && *s <= '9'; s++)
+ 37c:	0f be 02             	movsbl (%edx),%eax
+ 37f:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 382:	80 fb 09             	cmp    $0x9,%bl
+ 385:	76 e9                	jbe    370 <parseip+0x20>
+    if(v > 255 || *s != (i < 3 ? '.' : '\0'))
+ 387:	81 f9 ff 00 00 00    	cmp    $0xff,%ecx
+ 38d:	7f 30                	jg     3bf <parseip+0x6f>
+ 38f:	83 ff 03             	cmp    $0x3,%edi
+ 392:	74 1c                	je     3b0 <parseip+0x60>
+ 394:	83 f8 2e             	cmp    $0x2e,%eax
+ 397:	75 26                	jne    3bf <parseip+0x6f>
+      return -1;
+    b[i] = v;
+ 399:	8b 45 0c             	mov    0xc(%ebp),%eax
+    s++;
+ 39c:	8d 56 02             	lea    0x2(%esi),%edx
+    b[i] = v;
+ 39f:	88 0c 38             	mov    %cl,(%eax,%edi,1)
+  for(int i = 0; i < 4; i++) {
+ 3a2:	83 c7 01             	add    $0x1,%edi
+ 3a5:	eb b4                	jmp    35b <parseip+0xb>
+ 3a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ae:	66 90                	xchg   %ax,%ax
+    if(v > 255 || *s != (i < 3 ? '.' : '\0'))
+ 3b0:	85 c0                	test   %eax,%eax
+ 3b2:	75 0b                	jne    3bf <parseip+0x6f>
+    b[i] = v;
+ 3b4:	8b 7d 0c             	mov    0xc(%ebp),%edi
+ 3b7:	88 4f 03             	mov    %cl,0x3(%edi)
+  }
+  return 0;
+}
+ 3ba:	5b                   	pop    %ebx
+ 3bb:	5e                   	pop    %esi
+ 3bc:	5f                   	pop    %edi
+ 3bd:	5d                   	pop    %ebp
+ 3be:	c3                   	ret
+ 3bf:	5b                   	pop    %ebx
+      return -1;
+ 3c0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+ 3c5:	5e                   	pop    %esi
+ 3c6:	5f                   	pop    %edi
+ 3c7:	5d                   	pop    %ebp
+ 3c8:	c3                   	ret
+ 3c9:	66 90                	xchg   %ax,%ax
+ 3cb:	66 90                	xchg   %ax,%ax
+ 3cd:	66 90                	xchg   %ax,%ax
+ 3cf:	90                   	nop
+
+000003d0 <atoi>:
+#include "types.h"
+#include "util.h"
+
+int
+atoi(const char *s)
+{
+ 3d0:	55                   	push   %ebp
+ 3d1:	89 e5                	mov    %esp,%ebp
+ 3d3:	53                   	push   %ebx
+ 3d4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 3d7:	0f be 02             	movsbl (%edx),%eax
+ 3da:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 3dd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 3e0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 3e5:	77 1e                	ja     405 <atoi+0x35>
+ 3e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ee:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 3f0:	83 c2 01             	add    $0x1,%edx
+ 3f3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 3f6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 3fa:	0f be 02             	movsbl (%edx),%eax
+ 3fd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 400:	80 fb 09             	cmp    $0x9,%bl
+ 403:	76 eb                	jbe    3f0 <atoi+0x20>
+  return n;
+}
+ 405:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 408:	89 c8                	mov    %ecx,%eax
+ 40a:	c9                   	leave
+ 40b:	c3                   	ret
+ 40c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000410 <strcmp>:
+
+
+int
+strcmp(const char *p, const char *q)
+{
+ 410:	55                   	push   %ebp
+ 411:	89 e5                	mov    %esp,%ebp
+ 413:	53                   	push   %ebx
+ 414:	8b 55 08             	mov    0x8(%ebp),%edx
+ 417:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 41a:	0f b6 02             	movzbl (%edx),%eax
+ 41d:	84 c0                	test   %al,%al
+ 41f:	75 17                	jne    438 <strcmp+0x28>
+ 421:	eb 3a                	jmp    45d <strcmp+0x4d>
+ 423:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 427:	90                   	nop
+ 428:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 42c:	83 c2 01             	add    $0x1,%edx
+ 42f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 432:	84 c0                	test   %al,%al
+ 434:	74 1a                	je     450 <strcmp+0x40>
+    p++, q++;
+ 436:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 438:	0f b6 19             	movzbl (%ecx),%ebx
+ 43b:	38 c3                	cmp    %al,%bl
+ 43d:	74 e9                	je     428 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 43f:	29 d8                	sub    %ebx,%eax
+}
+ 441:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 444:	c9                   	leave
+ 445:	c3                   	ret
+ 446:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 44d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 450:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 454:	31 c0                	xor    %eax,%eax
+ 456:	29 d8                	sub    %ebx,%eax
+}
+ 458:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 45b:	c9                   	leave
+ 45c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 45d:	0f b6 19             	movzbl (%ecx),%ebx
+ 460:	31 c0                	xor    %eax,%eax
+ 462:	eb db                	jmp    43f <strcmp+0x2f>
+
+00000464 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 464:	b8 01 00 00 00       	mov    $0x1,%eax
+ 469:	cd 40                	int    $0x40
+ 46b:	c3                   	ret
+
+0000046c <exit>:
+SYSCALL(exit)
+ 46c:	b8 02 00 00 00       	mov    $0x2,%eax
+ 471:	cd 40                	int    $0x40
+ 473:	c3                   	ret
+
+00000474 <wait>:
+SYSCALL(wait)
+ 474:	b8 03 00 00 00       	mov    $0x3,%eax
+ 479:	cd 40                	int    $0x40
+ 47b:	c3                   	ret
+
+0000047c <pipe>:
+SYSCALL(pipe)
+ 47c:	b8 04 00 00 00       	mov    $0x4,%eax
+ 481:	cd 40                	int    $0x40
+ 483:	c3                   	ret
+
+00000484 <read>:
+SYSCALL(read)
+ 484:	b8 05 00 00 00       	mov    $0x5,%eax
+ 489:	cd 40                	int    $0x40
+ 48b:	c3                   	ret
+
+0000048c <write>:
+SYSCALL(write)
+ 48c:	b8 10 00 00 00       	mov    $0x10,%eax
+ 491:	cd 40                	int    $0x40
+ 493:	c3                   	ret
+
+00000494 <close>:
+SYSCALL(close)
+ 494:	b8 15 00 00 00       	mov    $0x15,%eax
+ 499:	cd 40                	int    $0x40
+ 49b:	c3                   	ret
+
+0000049c <kill>:
+SYSCALL(kill)
+ 49c:	b8 06 00 00 00       	mov    $0x6,%eax
+ 4a1:	cd 40                	int    $0x40
+ 4a3:	c3                   	ret
+
+000004a4 <exec>:
+SYSCALL(exec)
+ 4a4:	b8 07 00 00 00       	mov    $0x7,%eax
+ 4a9:	cd 40                	int    $0x40
+ 4ab:	c3                   	ret
+
+000004ac <open>:
+SYSCALL(open)
+ 4ac:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 4b1:	cd 40                	int    $0x40
+ 4b3:	c3                   	ret
+
+000004b4 <mknod>:
+SYSCALL(mknod)
+ 4b4:	b8 11 00 00 00       	mov    $0x11,%eax
+ 4b9:	cd 40                	int    $0x40
+ 4bb:	c3                   	ret
+
+000004bc <unlink>:
+SYSCALL(unlink)
+ 4bc:	b8 12 00 00 00       	mov    $0x12,%eax
+ 4c1:	cd 40                	int    $0x40
+ 4c3:	c3                   	ret
+
+000004c4 <fstat>:
+SYSCALL(fstat)
+ 4c4:	b8 08 00 00 00       	mov    $0x8,%eax
+ 4c9:	cd 40                	int    $0x40
+ 4cb:	c3                   	ret
+
+000004cc <link>:
+SYSCALL(link)
+ 4cc:	b8 13 00 00 00       	mov    $0x13,%eax
+ 4d1:	cd 40                	int    $0x40
+ 4d3:	c3                   	ret
+
+000004d4 <mkdir>:
+SYSCALL(mkdir)
+ 4d4:	b8 14 00 00 00       	mov    $0x14,%eax
+ 4d9:	cd 40                	int    $0x40
+ 4db:	c3                   	ret
+
+000004dc <chdir>:
+SYSCALL(chdir)
+ 4dc:	b8 09 00 00 00       	mov    $0x9,%eax
+ 4e1:	cd 40                	int    $0x40
+ 4e3:	c3                   	ret
+
+000004e4 <dup>:
+SYSCALL(dup)
+ 4e4:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 4e9:	cd 40                	int    $0x40
+ 4eb:	c3                   	ret
+
+000004ec <getpid>:
+SYSCALL(getpid)
+ 4ec:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 4f1:	cd 40                	int    $0x40
+ 4f3:	c3                   	ret
+
+000004f4 <sbrk>:
+SYSCALL(sbrk)
+ 4f4:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 4f9:	cd 40                	int    $0x40
+ 4fb:	c3                   	ret
+
+000004fc <sleep>:
+SYSCALL(sleep)
+ 4fc:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 501:	cd 40                	int    $0x40
+ 503:	c3                   	ret
+
+00000504 <uptime>:
+SYSCALL(uptime)
+ 504:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 509:	cd 40                	int    $0x40
+ 50b:	c3                   	ret
+
+0000050c <arp>:
+SYSCALL(arp)
+ 50c:	b8 16 00 00 00       	mov    $0x16,%eax
+ 511:	cd 40                	int    $0x40
+ 513:	c3                   	ret
+
+00000514 <nicget>:
+SYSCALL(nicget)
+ 514:	b8 17 00 00 00       	mov    $0x17,%eax
+ 519:	cd 40                	int    $0x40
+ 51b:	c3                   	ret
+
+0000051c <nicset>:
+SYSCALL(nicset)
+ 51c:	b8 18 00 00 00       	mov    $0x18,%eax
+ 521:	cd 40                	int    $0x40
+ 523:	c3                   	ret
+
+00000524 <nicstats>:
+SYSCALL(nicstats)
+ 524:	b8 19 00 00 00       	mov    $0x19,%eax
+ 529:	cd 40                	int    $0x40
+ 52b:	c3                   	ret
+
+0000052c <nicsend>:
+SYSCALL(nicsend)
+ 52c:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 531:	cd 40                	int    $0x40
+ 533:	c3                   	ret
+
+00000534 <nicrecv>:
+SYSCALL(nicrecv)
+ 534:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 539:	cd 40                	int    $0x40
+ 53b:	c3                   	ret
+
+0000053c <arpdump>:
+SYSCALL(arpdump)
+ 53c:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 541:	cd 40                	int    $0x40
+ 543:	c3                   	ret
+
+00000544 <arpflush>:
+SYSCALL(arpflush)
+ 544:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 549:	cd 40                	int    $0x40
+ 54b:	c3                   	ret
+
+0000054c <nicgetip>:
+SYSCALL(nicgetip)
+ 54c:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 551:	cd 40                	int    $0x40
+ 553:	c3                   	ret
+
+00000554 <nicsetip>:
+SYSCALL(nicsetip)
+ 554:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 559:	cd 40                	int    $0x40
+ 55b:	c3                   	ret
+
+0000055c <arpresolve>:
+SYSCALL(arpresolve)
+ 55c:	b8 20 00 00 00       	mov    $0x20,%eax
+ 561:	cd 40                	int    $0x40
+ 563:	c3                   	ret
+
+00000564 <arpresolvev>:
+SYSCALL(arpresolvev)
+ 564:	b8 21 00 00 00       	mov    $0x21,%eax
+ 569:	cd 40                	int    $0x40
+ 56b:	c3                   	ret
+
+0000056c <arpsend>:
+SYSCALL(arpsend)
+ 56c:	b8 22 00 00 00       	mov    $0x22,%eax
+ 571:	cd 40                	int    $0x40
+ 573:	c3                   	ret
+ 574:	66 90                	xchg   %ax,%ax
+ 576:	66 90                	xchg   %ax,%ax
+ 578:	66 90                	xchg   %ax,%ax
+ 57a:	66 90                	xchg   %ax,%ax
+ 57c:	66 90                	xchg   %ax,%ax
+ 57e:	66 90                	xchg   %ax,%ax
+
+00000580 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 580:	55                   	push   %ebp
+ 581:	89 e5                	mov    %esp,%ebp
+ 583:	57                   	push   %edi
+ 584:	56                   	push   %esi
+ 585:	53                   	push   %ebx
+ 586:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 588:	89 d1                	mov    %edx,%ecx
+{
+ 58a:	83 ec 3c             	sub    $0x3c,%esp
+ 58d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 590:	85 d2                	test   %edx,%edx
+ 592:	0f 89 80 00 00 00    	jns    618 <printint+0x98>
+ 598:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 59c:	74 7a                	je     618 <printint+0x98>
+    x = -xx;
+ 59e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 5a0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 5a5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 5a8:	31 f6                	xor    %esi,%esi
+ 5aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 5b0:	89 c8                	mov    %ecx,%eax
+ 5b2:	31 d2                	xor    %edx,%edx
+ 5b4:	89 f7                	mov    %esi,%edi
+ 5b6:	f7 f3                	div    %ebx
+ 5b8:	8d 76 01             	lea    0x1(%esi),%esi
+ 5bb:	0f b6 92 c8 0c 00 00 	movzbl 0xcc8(%edx),%edx
+ 5c2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 5c6:	89 ca                	mov    %ecx,%edx
+ 5c8:	89 c1                	mov    %eax,%ecx
+ 5ca:	39 da                	cmp    %ebx,%edx
+ 5cc:	73 e2                	jae    5b0 <printint+0x30>
+  if(neg)
+ 5ce:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 5d1:	85 c0                	test   %eax,%eax
+ 5d3:	74 07                	je     5dc <printint+0x5c>
+    buf[i++] = '-';
+ 5d5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 5da:	89 f7                	mov    %esi,%edi
+ 5dc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 5df:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 5e2:	01 df                	add    %ebx,%edi
+ 5e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 5e8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 5eb:	83 ec 04             	sub    $0x4,%esp
+ 5ee:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 5f1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 5f4:	6a 01                	push   $0x1
+ 5f6:	50                   	push   %eax
+ 5f7:	56                   	push   %esi
+ 5f8:	e8 8f fe ff ff       	call   48c <write>
+  while(--i >= 0)
+ 5fd:	89 f8                	mov    %edi,%eax
+ 5ff:	83 c4 10             	add    $0x10,%esp
+ 602:	83 ef 01             	sub    $0x1,%edi
+ 605:	39 d8                	cmp    %ebx,%eax
+ 607:	75 df                	jne    5e8 <printint+0x68>
+}
+ 609:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 60c:	5b                   	pop    %ebx
+ 60d:	5e                   	pop    %esi
+ 60e:	5f                   	pop    %edi
+ 60f:	5d                   	pop    %ebp
+ 610:	c3                   	ret
+ 611:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 618:	31 c0                	xor    %eax,%eax
+ 61a:	eb 89                	jmp    5a5 <printint+0x25>
+ 61c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000620 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 620:	55                   	push   %ebp
+ 621:	89 e5                	mov    %esp,%ebp
+ 623:	57                   	push   %edi
+ 624:	56                   	push   %esi
+ 625:	53                   	push   %ebx
+ 626:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 629:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 62c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 62f:	0f b6 1e             	movzbl (%esi),%ebx
+ 632:	83 c6 01             	add    $0x1,%esi
+ 635:	84 db                	test   %bl,%bl
+ 637:	74 67                	je     6a0 <printf+0x80>
+ 639:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 63c:	31 d2                	xor    %edx,%edx
+ 63e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 641:	eb 34                	jmp    677 <printf+0x57>
+ 643:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 647:	90                   	nop
+ 648:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 64b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 650:	83 f8 25             	cmp    $0x25,%eax
+ 653:	74 18                	je     66d <printf+0x4d>
+  write(fd, &c, 1);
+ 655:	83 ec 04             	sub    $0x4,%esp
+ 658:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 65b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 65e:	6a 01                	push   $0x1
+ 660:	50                   	push   %eax
+ 661:	57                   	push   %edi
+ 662:	e8 25 fe ff ff       	call   48c <write>
+ 667:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 66a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 66d:	0f b6 1e             	movzbl (%esi),%ebx
+ 670:	83 c6 01             	add    $0x1,%esi
+ 673:	84 db                	test   %bl,%bl
+ 675:	74 29                	je     6a0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 677:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 67a:	85 d2                	test   %edx,%edx
+ 67c:	74 ca                	je     648 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 67e:	83 fa 25             	cmp    $0x25,%edx
+ 681:	75 ea                	jne    66d <printf+0x4d>
+      if(c == 'd'){
+ 683:	83 f8 25             	cmp    $0x25,%eax
+ 686:	0f 84 24 01 00 00    	je     7b0 <printf+0x190>
+ 68c:	83 e8 63             	sub    $0x63,%eax
+ 68f:	83 f8 15             	cmp    $0x15,%eax
+ 692:	77 1c                	ja     6b0 <printf+0x90>
+ 694:	ff 24 85 70 0c 00 00 	jmp    *0xc70(,%eax,4)
+ 69b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 69f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 6a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6a3:	5b                   	pop    %ebx
+ 6a4:	5e                   	pop    %esi
+ 6a5:	5f                   	pop    %edi
+ 6a6:	5d                   	pop    %ebp
+ 6a7:	c3                   	ret
+ 6a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6af:	90                   	nop
+  write(fd, &c, 1);
+ 6b0:	83 ec 04             	sub    $0x4,%esp
+ 6b3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 6b6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 6ba:	6a 01                	push   $0x1
+ 6bc:	52                   	push   %edx
+ 6bd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 6c0:	57                   	push   %edi
+ 6c1:	e8 c6 fd ff ff       	call   48c <write>
+ 6c6:	83 c4 0c             	add    $0xc,%esp
+ 6c9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 6cc:	6a 01                	push   $0x1
+ 6ce:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 6d1:	52                   	push   %edx
+ 6d2:	57                   	push   %edi
+ 6d3:	e8 b4 fd ff ff       	call   48c <write>
+        putc(fd, c);
+ 6d8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6db:	31 d2                	xor    %edx,%edx
+ 6dd:	eb 8e                	jmp    66d <printf+0x4d>
+ 6df:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 6e0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 6e3:	83 ec 0c             	sub    $0xc,%esp
+ 6e6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 6eb:	8b 13                	mov    (%ebx),%edx
+ 6ed:	6a 00                	push   $0x0
+ 6ef:	89 f8                	mov    %edi,%eax
+        ap++;
+ 6f1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 6f4:	e8 87 fe ff ff       	call   580 <printint>
+        ap++;
+ 6f9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 6fc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6ff:	31 d2                	xor    %edx,%edx
+ 701:	e9 67 ff ff ff       	jmp    66d <printf+0x4d>
+ 706:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 70d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 710:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 713:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 715:	83 c0 04             	add    $0x4,%eax
+ 718:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 71b:	85 db                	test   %ebx,%ebx
+ 71d:	0f 84 9d 00 00 00    	je     7c0 <printf+0x1a0>
+        while(*s != 0){
+ 723:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 726:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 728:	84 c0                	test   %al,%al
+ 72a:	0f 84 3d ff ff ff    	je     66d <printf+0x4d>
+ 730:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 733:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 736:	89 de                	mov    %ebx,%esi
+ 738:	89 d3                	mov    %edx,%ebx
+ 73a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 740:	83 ec 04             	sub    $0x4,%esp
+ 743:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 746:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 749:	6a 01                	push   $0x1
+ 74b:	53                   	push   %ebx
+ 74c:	57                   	push   %edi
+ 74d:	e8 3a fd ff ff       	call   48c <write>
+        while(*s != 0){
+ 752:	0f b6 06             	movzbl (%esi),%eax
+ 755:	83 c4 10             	add    $0x10,%esp
+ 758:	84 c0                	test   %al,%al
+ 75a:	75 e4                	jne    740 <printf+0x120>
+      state = 0;
+ 75c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 75f:	31 d2                	xor    %edx,%edx
+ 761:	e9 07 ff ff ff       	jmp    66d <printf+0x4d>
+ 766:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 76d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 770:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 773:	83 ec 0c             	sub    $0xc,%esp
+ 776:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 77b:	8b 13                	mov    (%ebx),%edx
+ 77d:	6a 01                	push   $0x1
+ 77f:	e9 6b ff ff ff       	jmp    6ef <printf+0xcf>
+ 784:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 788:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 78b:	83 ec 04             	sub    $0x4,%esp
+ 78e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 791:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 793:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 796:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 799:	6a 01                	push   $0x1
+ 79b:	52                   	push   %edx
+ 79c:	57                   	push   %edi
+ 79d:	e8 ea fc ff ff       	call   48c <write>
+        ap++;
+ 7a2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 7a5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 7a8:	31 d2                	xor    %edx,%edx
+ 7aa:	e9 be fe ff ff       	jmp    66d <printf+0x4d>
+ 7af:	90                   	nop
+  write(fd, &c, 1);
+ 7b0:	83 ec 04             	sub    $0x4,%esp
+ 7b3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 7b6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 7b9:	6a 01                	push   $0x1
+ 7bb:	e9 11 ff ff ff       	jmp    6d1 <printf+0xb1>
+ 7c0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 7c5:	bb 68 0c 00 00       	mov    $0xc68,%ebx
+ 7ca:	e9 61 ff ff ff       	jmp    730 <printf+0x110>
+ 7cf:	90                   	nop
+
+000007d0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 7d0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7d1:	a1 ac 0f 00 00       	mov    0xfac,%eax
+{
+ 7d6:	89 e5                	mov    %esp,%ebp
+ 7d8:	57                   	push   %edi
+ 7d9:	56                   	push   %esi
+ 7da:	53                   	push   %ebx
+ 7db:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 7de:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7e8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7ea:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7ec:	39 ca                	cmp    %ecx,%edx
+ 7ee:	73 30                	jae    820 <free+0x50>
+ 7f0:	39 c1                	cmp    %eax,%ecx
+ 7f2:	72 04                	jb     7f8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7f4:	39 c2                	cmp    %eax,%edx
+ 7f6:	72 f0                	jb     7e8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 7f8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 7fb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 7fe:	39 f8                	cmp    %edi,%eax
+ 800:	74 2e                	je     830 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 802:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 805:	8b 42 04             	mov    0x4(%edx),%eax
+ 808:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 80b:	39 f1                	cmp    %esi,%ecx
+ 80d:	74 38                	je     847 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 80f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 811:	5b                   	pop    %ebx
+  freep = p;
+ 812:	89 15 ac 0f 00 00    	mov    %edx,0xfac
+}
+ 818:	5e                   	pop    %esi
+ 819:	5f                   	pop    %edi
+ 81a:	5d                   	pop    %ebp
+ 81b:	c3                   	ret
+ 81c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 820:	39 c1                	cmp    %eax,%ecx
+ 822:	72 d0                	jb     7f4 <free+0x24>
+ 824:	eb c2                	jmp    7e8 <free+0x18>
+ 826:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 82d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 830:	03 70 04             	add    0x4(%eax),%esi
+ 833:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 836:	8b 02                	mov    (%edx),%eax
+ 838:	8b 00                	mov    (%eax),%eax
+ 83a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 83d:	8b 42 04             	mov    0x4(%edx),%eax
+ 840:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 843:	39 f1                	cmp    %esi,%ecx
+ 845:	75 c8                	jne    80f <free+0x3f>
+    p->s.size += bp->s.size;
+ 847:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 84a:	89 15 ac 0f 00 00    	mov    %edx,0xfac
+    p->s.size += bp->s.size;
+ 850:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 853:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 856:	89 0a                	mov    %ecx,(%edx)
+}
+ 858:	5b                   	pop    %ebx
+ 859:	5e                   	pop    %esi
+ 85a:	5f                   	pop    %edi
+ 85b:	5d                   	pop    %ebp
+ 85c:	c3                   	ret
+ 85d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000860 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 860:	55                   	push   %ebp
+ 861:	89 e5                	mov    %esp,%ebp
+ 863:	57                   	push   %edi
+ 864:	56                   	push   %esi
+ 865:	53                   	push   %ebx
+ 866:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 869:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 86c:	8b 15 ac 0f 00 00    	mov    0xfac,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 872:	8d 78 07             	lea    0x7(%eax),%edi
+ 875:	c1 ef 03             	shr    $0x3,%edi
+ 878:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 87b:	85 d2                	test   %edx,%edx
+ 87d:	0f 84 8d 00 00 00    	je     910 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 883:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 885:	8b 48 04             	mov    0x4(%eax),%ecx
+ 888:	39 f9                	cmp    %edi,%ecx
+ 88a:	73 64                	jae    8f0 <malloc+0x90>
+  if(nu < 4096)
+ 88c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 891:	39 df                	cmp    %ebx,%edi
+ 893:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 896:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 89d:	eb 0a                	jmp    8a9 <malloc+0x49>
+ 89f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 8a0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 8a2:	8b 48 04             	mov    0x4(%eax),%ecx
+ 8a5:	39 f9                	cmp    %edi,%ecx
+ 8a7:	73 47                	jae    8f0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 8a9:	89 c2                	mov    %eax,%edx
+ 8ab:	39 05 ac 0f 00 00    	cmp    %eax,0xfac
+ 8b1:	75 ed                	jne    8a0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 8b3:	83 ec 0c             	sub    $0xc,%esp
+ 8b6:	56                   	push   %esi
+ 8b7:	e8 38 fc ff ff       	call   4f4 <sbrk>
+  if(p == (char*)-1)
+ 8bc:	83 c4 10             	add    $0x10,%esp
+ 8bf:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 8c2:	74 1c                	je     8e0 <malloc+0x80>
+  hp->s.size = nu;
+ 8c4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 8c7:	83 ec 0c             	sub    $0xc,%esp
+ 8ca:	83 c0 08             	add    $0x8,%eax
+ 8cd:	50                   	push   %eax
+ 8ce:	e8 fd fe ff ff       	call   7d0 <free>
+  return freep;
+ 8d3:	8b 15 ac 0f 00 00    	mov    0xfac,%edx
+      if((p = morecore(nunits)) == 0)
+ 8d9:	83 c4 10             	add    $0x10,%esp
+ 8dc:	85 d2                	test   %edx,%edx
+ 8de:	75 c0                	jne    8a0 <malloc+0x40>
+        return 0;
+  }
+}
+ 8e0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 8e3:	31 c0                	xor    %eax,%eax
+}
+ 8e5:	5b                   	pop    %ebx
+ 8e6:	5e                   	pop    %esi
+ 8e7:	5f                   	pop    %edi
+ 8e8:	5d                   	pop    %ebp
+ 8e9:	c3                   	ret
+ 8ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 8f0:	39 cf                	cmp    %ecx,%edi
+ 8f2:	74 4c                	je     940 <malloc+0xe0>
+        p->s.size -= nunits;
+ 8f4:	29 f9                	sub    %edi,%ecx
+ 8f6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 8f9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 8fc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 8ff:	89 15 ac 0f 00 00    	mov    %edx,0xfac
+}
+ 905:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 908:	83 c0 08             	add    $0x8,%eax
+}
+ 90b:	5b                   	pop    %ebx
+ 90c:	5e                   	pop    %esi
+ 90d:	5f                   	pop    %edi
+ 90e:	5d                   	pop    %ebp
+ 90f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 910:	c7 05 ac 0f 00 00 b0 	movl   $0xfb0,0xfac
+ 917:	0f 00 00 
+    base.s.size = 0;
+ 91a:	b8 b0 0f 00 00       	mov    $0xfb0,%eax
+    base.s.ptr = freep = prevp = &base;
+ 91f:	c7 05 b0 0f 00 00 b0 	movl   $0xfb0,0xfb0
+ 926:	0f 00 00 
+    base.s.size = 0;
+ 929:	c7 05 b4 0f 00 00 00 	movl   $0x0,0xfb4
+ 930:	00 00 00 
+    if(p->s.size >= nunits){
+ 933:	e9 54 ff ff ff       	jmp    88c <malloc+0x2c>
+ 938:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 93f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 940:	8b 08                	mov    (%eax),%ecx
+ 942:	89 0a                	mov    %ecx,(%edx)
+ 944:	eb b9                	jmp    8ff <malloc+0x9f>
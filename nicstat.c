@@ -0,0 +1,92 @@
+/**
+ *dump NIC hardware statistics, like ethtool -S
+ *usage: nicstat interface
+ */
+#include "types.h"
+#include "user.h"
+#include "nicstat.h"
+
+static char *names[NICSTAT_COUNT] = {
+  [NICSTAT_RX_PACKETS]      "rx_packets",
+  [NICSTAT_RX_BYTES]        "rx_bytes",
+  [NICSTAT_RX_BROADCAST]    "rx_broadcast",
+  [NICSTAT_RX_MULTICAST]    "rx_multicast",
+  [NICSTAT_RX_TOTAL]        "rx_total_packets",
+  [NICSTAT_RX_MISSED]       "rx_missed_errors",
+  [NICSTAT_RX_NO_BUFFER]    "rx_no_buffer_count",
+  [NICSTAT_RX_CRC_ERRORS]   "rx_crc_errors",
+  [NICSTAT_RX_ALIGN_ERRORS] "rx_align_errors",
+  [NICSTAT_RX_SYMBOL_ERRORS] "rx_symbol_errors",
+  [NICSTAT_RX_ERRORS]       "rx_errors",
+  [NICSTAT_RX_LENGTH_ERRORS] "rx_length_errors",
+  [NICSTAT_RX_UNDERSIZE]    "rx_short_length_errors",
+  [NICSTAT_RX_FRAGMENTS]    "rx_fragments",
+  [NICSTAT_RX_OVERSIZE]     "rx_long_length_errors",
+  [NICSTAT_RX_JABBER]       "rx_jabbers",
+  [NICSTAT_RX_XON]          "rx_flow_control_xon",
+  [NICSTAT_RX_XOFF]         "rx_flow_control_xoff",
+  [NICSTAT_TX_PACKETS]      "tx_packets",
+  [NICSTAT_TX_BYTES]        "tx_bytes",
+  [NICSTAT_TX_BROADCAST]    "tx_broadcast",
+  [NICSTAT_TX_MULTICAST]    "tx_multicast",
+  [NICSTAT_TX_TOTAL]        "tx_total_packets",
+  [NICSTAT_TX_TSO]          "tx_tcp_seg_good",
+  [NICSTAT_TX_TSO_FAILED]   "tx_tcp_seg_failed",
+  [NICSTAT_TX_XON]          "tx_flow_control_xon",
+  [NICSTAT_TX_XOFF]         "tx_flow_control_xoff",
+  [NICSTAT_COLLISIONS]      "collisions",
+  [NICSTAT_SINGLE_COLL]     "tx_single_coll_ok",
+  [NICSTAT_MULTI_COLL]      "tx_multi_coll_ok",
+  [NICSTAT_LATE_COLL]       "tx_window_errors",
+  [NICSTAT_EXCESS_COLL]     "tx_aborted_errors",
+  [NICSTAT_DEFERRED]        "tx_deferred_ok",
+  [NICSTAT_NO_CRS]          "tx_carrier_errors",
+};
+
+// printf has no 64-bit conversions, and there is no 64-bit divide
+// without libgcc, so divide by 10 a 16-bit digit at a time.
+static void print64(uint64_t v) {
+  ushort d[4];
+  char buf[21];
+  int i, pos = sizeof(buf) - 1, zero;
+
+  for(i = 0; i < 4; i++)
+    d[i] = (v >> (48 - 16*i)) & 0xffff;
+  buf[pos] = 0;
+  do {
+    uint r = 0;
+    zero = 1;
+    for(i = 0; i < 4; i++) {
+      uint cur = (r << 16) | d[i];
+      d[i] = cur / 10;
+      r = cur % 10;
+      if(d[i])
+        zero = 0;
+    }
+    buf[--pos] = '0' + r;
+  } while(!zero);
+  printf(1, "%s", &buf[pos]);
+}
+
+int main(int argc, char *argv[]) {
+  uint64_t stats[NICSTAT_COUNT];
+  int n;
+
+  if(argc != 2) {
+    printf(2, "usage: nicstat interface\n");
+    exit();
+  }
+
+  if((n = nicstats(argv[1], stats, NICSTAT_COUNT)) < 0) {
+    printf(2, "nicstat: no statistics for %s\n", argv[1]);
+    exit();
+  }
+
+  printf(1, "NIC statistics:\n");
+  for(int i = 0; i < n; i++) {
+    printf(1, "     %s: ", names[i]);
+    print64(stats[i]);
+    printf(1, "\n");
+  }
+  exit();
+}
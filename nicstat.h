@@ -0,0 +1,50 @@
+#ifndef __XV6_NETSTACK_NICSTAT_H__
+#define __XV6_NETSTACK_NICSTAT_H__
+/**
+ *NIC hardware statistics for the nicstats system call, as indexes into
+ *the array of 64-bit counters it fills. shared by the kernel and user space
+ */
+
+//Receive
+#define NICSTAT_RX_PACKETS      0   //good packets received
+#define NICSTAT_RX_BYTES        1   //octets in good packets received
+#define NICSTAT_RX_BROADCAST    2
+#define NICSTAT_RX_MULTICAST    3
+#define NICSTAT_RX_TOTAL        4   //all packets received, bad ones too
+#define NICSTAT_RX_MISSED       5   //dropped for lack of FIFO space
+#define NICSTAT_RX_NO_BUFFER    6   //seen with no free receive descriptor
+#define NICSTAT_RX_CRC_ERRORS   7
+#define NICSTAT_RX_ALIGN_ERRORS 8
+#define NICSTAT_RX_SYMBOL_ERRORS 9
+#define NICSTAT_RX_ERRORS       10
+#define NICSTAT_RX_LENGTH_ERRORS 11
+#define NICSTAT_RX_UNDERSIZE    12
+#define NICSTAT_RX_FRAGMENTS    13
+#define NICSTAT_RX_OVERSIZE     14
+#define NICSTAT_RX_JABBER       15
+#define NICSTAT_RX_XON          16
+#define NICSTAT_RX_XOFF         17
+
+//Transmit
+#define NICSTAT_TX_PACKETS      18  //good packets sent
+#define NICSTAT_TX_BYTES        19  //octets in good packets sent
+#define NICSTAT_TX_BROADCAST    20
+#define NICSTAT_TX_MULTICAST    21
+#define NICSTAT_TX_TOTAL        22
+#define NICSTAT_TX_TSO          23  //TSO contexts sent
+#define NICSTAT_TX_TSO_FAILED   24
+#define NICSTAT_TX_XON          25
+#define NICSTAT_TX_XOFF         26
+
+//Collisions and deferrals
+#define NICSTAT_COLLISIONS      27
+#define NICSTAT_SINGLE_COLL     28
+#define NICSTAT_MULTI_COLL      29
+#define NICSTAT_LATE_COLL       30
+#define NICSTAT_EXCESS_COLL     31
+#define NICSTAT_DEFERRED        32
+#define NICSTAT_NO_CRS          33  //transmits with no carrier sense
+
+#define NICSTAT_COUNT           34
+
+#endif
@@ -111,10 +111,32 @@ void pci_enable_device(struct pci_func *f) {
 static int e1000_attach(struct pci_func *pcif) {
 	pci_enable_device(pcif);
 	struct nic_device nd;
-	e1000_init(pcif, &nd.driver, nd.mac_addr);
+	memset(&nd, 0, sizeof(nd));
+	if(e1000_init(pcif, &nd.driver, nd.mac_addr) < 0)
+		return -1;
+	nd.irq_line = pcif->irq_line;
+	nd.poll_budget = NIC_POLL_BUDGET;
+	nd.features = NIC_F_TXCSUM | NIC_F_RXCSUM | NIC_F_TSO;
+	e1000_get_param(nd.driver, NICCTL_MTU, &nd.mtu);
 	nd.send_packet = e1000_send;
+	nd.send_batch = e1000_send_batch;
+	nd.send_zc = e1000_send_zc;
+	nd.send_sg = e1000_send_sg;
+	nd.send_csum = e1000_send_csum;
+	nd.send_tso = e1000_send_tso;
 	nd.recv_packet = e1000_recv;
-	register_device(nd);
+	nd.intr = e1000_intr;
+	nd.enable_intr = e1000_enable_intr;
+	nd.add_addr = e1000_add_addr;
+	nd.del_addr = e1000_del_addr;
+	nd.update_stats = e1000_update_stats;
+	nd.get_stats = e1000_get_stats;
+	nd.get_param = e1000_get_param;
+	nd.set_param = e1000_set_param;
+	if(register_device(nd) < 0) {
+		cprintf("e1000: too many NICs, not registered\n");
+		return -1;
+	}
   return 0;
 }
 
@@ -143,6 +165,47 @@ static void pci_attach_nic(struct pci_func *pcif) {
 	}
 }
 
+//Buses found so far and the bridges leading to them, indexed by bus number
+static struct pci_bus pci_buses[MAX_PCI_BUS];
+static struct pci_func pci_bridges[MAX_PCI_BUS];
+//Highest bus number handed out
+static uint32_t pci_last_busno;
+
+static int pci_enumerate_bus(struct pci_bus *bus);
+
+/**
+ * Number the bus behind a PCI-to-PCI bridge and enumerate it, depth
+ * first. The secondary bus gets the next free number, the subordinate
+ * (highest bus reachable through the bridge) is only known once
+ * everything behind it is numbered; until then it is left wide open so
+ * config cycles for deeper buses get forwarded.
+ */
+static int pci_scan_bridge(struct pci_func *f) {
+	uint32_t busreg;
+	struct pci_bus *child;
+
+	if (pci_last_busno + 1 >= MAX_PCI_BUS) {
+		cprintf("PCI: out of bus numbers, not scanning behind %x:%x.%d\n",
+			f->bus->busno, f->dev, f->func);
+		return 0;
+	}
+	child = &pci_buses[++pci_last_busno];
+	pci_bridges[child->busno = pci_last_busno] = *f;
+	child->parent_bridge = &pci_bridges[child->busno];
+
+	busreg = pci_conf_read(f, PCI_BRIDGE_BUS_REG) & 0xff000000;
+	pci_conf_write(f, PCI_BRIDGE_BUS_REG, busreg |
+		PCI_BRIDGE_BUS_NUMBERS(f->bus->busno, child->busno, 0xff));
+
+	int ndev = pci_enumerate_bus(child);
+
+	pci_conf_write(f, PCI_BRIDGE_BUS_REG, busreg |
+		PCI_BRIDGE_BUS_NUMBERS(f->bus->busno, child->busno, pci_last_busno));
+	cprintf("PCI: bridge %x:%x.%d to bus %x-%x\n", f->bus->busno, f->dev, f->func,
+		child->busno, pci_last_busno);
+	return ndev;
+}
+
 static int pci_enumerate_bus(struct pci_bus *bus) {
 	int totaldev = 0;
 	struct pci_func df;
@@ -154,7 +217,7 @@ static int pci_enumerate_bus(struct pci_bus *bus) {
   // If yes, configure the device.
 	for (df.dev = 0; df.dev < MAX_DEVICE_PER_PCI_BUS; df.dev++) {
 		uint32_t bhlc = pci_conf_read(&df, PCI_BHLC_REG);
-		if (PCI_HDRTYPE_TYPE(bhlc) > 1)	// only supporting PCI-2-PCI bus which is HDRTYPE=1. Unsupported or no device
+		if (PCI_HDRTYPE_TYPE(bhlc) > PCI_HDRTYPE_PPB)	// only supporting PCI-2-PCI bus which is HDRTYPE=1. Unsupported or no device
 			continue;
 
 		totaldev++;
@@ -180,8 +243,14 @@ static int pci_enumerate_bus(struct pci_bus *bus) {
 
       pci_print_func(&af);  //print it for debugging
 
-      if(PCI_CLASS(af.dev_class) == PCI_DEVICE_CLASS_NETWORK_CONTROLLER)
-			   pci_attach_nic(&af);
+      if(PCI_CLASS(af.dev_class) == PCI_DEVICE_CLASS_NETWORK_CONTROLLER) {
+				nic_claim_irq(af.irq_line);
+				pci_attach_nic(&af);
+			}
+			else if (PCI_CLASS(af.dev_class) == PCI_DEVICE_CLASS_BRIDGE &&
+			         PCI_SUBCLASS(af.dev_class) == PCI_SUBCLASS_BRIDGE_PCI &&
+			         IS_PCI_HDRTYPE_PPB(pci_conf_read(&af, PCI_BHLC_REG)))
+				totaldev += pci_scan_bridge(&af);
 		}
 	}
 
@@ -189,8 +258,9 @@ static int pci_enumerate_bus(struct pci_bus *bus) {
 }
 
 int pci_init(void) {
-	static struct pci_bus root_bus;
-	memset(&root_bus, 0, sizeof(root_bus));
+	struct pci_bus *root_bus = &pci_buses[0];
+	memset(root_bus, 0, sizeof(*root_bus));
+	pci_last_busno = 0;
 
-	return pci_enumerate_bus(&root_bus);
+	return pci_enumerate_bus(root_bus);
 }
@@ -14,6 +14,8 @@
 // 5-bit for device , and 3-bit for function numbers for the device
 // So a total of 2^5 devices per bus
 #define MAX_DEVICE_PER_PCI_BUS 32
+// and 2^8 buses
+#define MAX_PCI_BUS 256
 
 
 // http://en.wikipedia.org/wiki/PCI_Configuration_Space#Software_implementation
@@ -24,7 +26,8 @@
 
 struct pci_func;
 /**
- * We consider only one PCI bus
+ * Bus 0 is the root bus, every other bus sits behind a PCI-to-PCI bridge
+ * (parent_bridge) and is numbered while enumerating
  */
 struct pci_bus {
     struct pci_func *parent_bridge;
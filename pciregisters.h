@@ -45,6 +45,9 @@
 #define	PCI_HDRTYPE_TYPE(bhlcr) \
 	    (PCI_HDRTYPE(bhlcr) & 0x7f)
 
+#define PCI_HDRTYPE_DEVICE    0x00
+#define PCI_HDRTYPE_PPB       0x01    //PCI-to-PCI bridge
+
 #define IS_PCI_HDRTYPE_PPB(bhlcr) \
       (PCI_HDRTYPE_TYPE(bhlcr) == PCI_HDRTYPE_PPB)
 
@@ -93,6 +96,22 @@
 	    (((cr) >> PCI_SUBCLASS_SHIFT) & PCI_SUBCLASS_MASK)
 
 #define PCI_DEVICE_CLASS_NETWORK_CONTROLLER 2
+#define PCI_DEVICE_CLASS_BRIDGE             6
+#define PCI_SUBCLASS_BRIDGE_PCI             4
+
+/*
+ * PCI-to-PCI bridge bus numbers register (header type 1 only).
+ */
+#define	PCI_BRIDGE_BUS_REG		0x18
+
+#define PCI_BRIDGE_BUS_PRIMARY(bbr) \
+      ((bbr) & 0xff)
+#define PCI_BRIDGE_BUS_SECONDARY(bbr) \
+      (((bbr) >> 8) & 0xff)
+#define PCI_BRIDGE_BUS_SUBORDINATE(bbr) \
+      (((bbr) >> 16) & 0xff)
+#define PCI_BRIDGE_BUS_NUMBERS(pri, sec, sub) \
+      (((pri) & 0xff) | (((sec) & 0xff) << 8) | (((sub) & 0xff) << 16))
 
 /*
  * Command and status register.
@@ -0,0 +1,80 @@
+/**
+ *packet buffer pools, see pktbuf.h
+ */
+
+#include "types.h"
+#include "defs.h"
+#include "mmu.h"
+#include "spinlock.h"
+#include "pktbuf.h"
+
+/**
+ * Carve nbufs buffers of bufsize bytes. Buffers up to a page are packed
+ * several to a page, larger ones get their own run of contiguous pages
+ * since the device DMAs into them. Buffers are never given back to
+ * kalloc(). Returns 0, or -1 if memory ran out.
+ */
+int pktpool_init(struct pktpool *pool, char *name, int nbufs, uint bufsize) {
+  int meta_pages = (nbufs * sizeof(struct pktbuf) + PGSIZE - 1) / PGSIZE;
+  struct pktbuf *pb = (struct pktbuf*)kallocn(meta_pages);
+  uint8_t *data = 0;
+  uint left = 0;
+
+  if(pb == 0 || bufsize == 0)
+    return -1;
+  initlock(&pool->lock, name);
+  pool->free = 0;
+  pool->bufsize = bufsize;
+  pool->nbufs = pool->nfree = 0;
+
+  for(int i = 0; i < nbufs; i++, pb++) {
+    if(bufsize > PGSIZE) {
+      data = (uint8_t*)kallocn((bufsize + PGSIZE - 1) / PGSIZE);
+      left = bufsize;
+    } else if(left < bufsize) {
+      data = (uint8_t*)kalloc();
+      left = PGSIZE;
+    }
+    if(data == 0)
+      return -1;
+    pb->pool = pool;
+    pb->len = 0;
+    pb->data = data;
+    pb->next = pool->free;
+    pool->free = pb;
+    pool->nbufs++;
+    pool->nfree++;
+    data += bufsize;
+    left -= bufsize;
+  }
+
+  return 0;
+}
+
+// Take a buffer from the pool. Returns 0 if the pool is empty.
+struct pktbuf* pktbuf_alloc(struct pktpool *pool) {
+  struct pktbuf *pb;
+
+  acquire(&pool->lock);
+  if((pb = pool->free) != 0) {
+    pool->free = pb->next;
+    pool->nfree--;
+  }
+  release(&pool->lock);
+
+  if(pb) {
+    pb->next = 0;
+    pb->len = 0;
+  }
+  return pb;
+}
+
+void pktbuf_free(struct pktbuf *pb) {
+  struct pktpool *pool = pb->pool;
+
+  acquire(&pool->lock);
+  pb->next = pool->free;
+  pool->free = pb;
+  pool->nfree++;
+  release(&pool->lock);
+}
@@ -0,0 +1,31 @@
+#ifndef __XV6_NETSTACK_PKTBUF_H__
+#define __XV6_NETSTACK_PKTBUF_H__
+/**
+ *pools of fixed size packet buffers. Drivers post them to receive rings
+ *and hand filled ones up the stack by reference; whoever ends up owning
+ *a buffer gives it back with pktbuf_free().
+ *Include spinlock.h first.
+ */
+
+struct pktpool;
+
+struct pktbuf {
+  struct pktbuf *next;    //free list link
+  struct pktpool *pool;   //pool to return to on free
+  uint16_t len;           //bytes of frame in data
+  uint8_t *data;          //bufsize bytes, physically contiguous
+};
+
+struct pktpool {
+  struct spinlock lock;
+  struct pktbuf *free;
+  uint bufsize;
+  int nbufs;
+  int nfree;
+};
+
+int pktpool_init(struct pktpool *pool, char *name, int nbufs, uint bufsize);
+struct pktbuf* pktbuf_alloc(struct pktpool *pool);
+void pktbuf_free(struct pktbuf *pb);
+
+#endif
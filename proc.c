@@ -153,6 +153,57 @@ userinit(void)
   release(&ptable.lock);
 }
 
+// A kernel thread's first scheduling switches here.
+// fn and arg were left on the stack by kthread().
+static void
+kthreadmain(void (*fn)(void*), void *arg)
+{
+  // Still holding ptable.lock from scheduler.
+  release(&ptable.lock);
+  fn(arg);
+  panic("kthread returned");
+}
+
+// Start a process that runs fn(arg) in the kernel and never
+// enters user space. fn must not return.
+int
+kthread(char *name, void (*fn)(void*), void *arg)
+{
+  struct proc *p;
+  char *sp;
+
+  if((p = allocproc()) == 0)
+    return -1;
+  if((p->pgdir = setupkvm()) == 0){
+    kfree(p->kstack);
+    p->kstack = 0;
+    p->state = UNUSED;
+    return -1;
+  }
+  p->sz = 0;
+  safestrcpy(p->name, name, sizeof(p->name));
+
+  // Replace the forkret/trapret frame from allocproc with a
+  // call to kthreadmain(fn, arg) that has a bogus return pc.
+  sp = p->kstack + KSTACKSIZE;
+  sp -= 4;
+  *(uint*)sp = (uint)arg;
+  sp -= 4;
+  *(uint*)sp = (uint)fn;
+  sp -= 4;
+  *(uint*)sp = 0;
+  sp -= sizeof *p->context;
+  p->context = (struct context*)sp;
+  memset(p->context, 0, sizeof *p->context);
+  p->context->eip = (uint)kthreadmain;
+
+  acquire(&ptable.lock);
+  p->state = RUNNABLE;
+  release(&ptable.lock);
+
+  return p->pid;
+}
+
 // Grow current process's memory by n bytes.
 // Return 0 on success, -1 on failure.
 int
@@ -0,0 +1,1376 @@
+
+_stressfs:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "fs.h"
+#include "fcntl.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+  int fd, i;
+  char path[] = "stressfs0";
+   7:	b8 30 00 00 00       	mov    $0x30,%eax
+{
+   c:	ff 71 fc             	push   -0x4(%ecx)
+   f:	55                   	push   %ebp
+  10:	89 e5                	mov    %esp,%ebp
+  12:	57                   	push   %edi
+  13:	56                   	push   %esi
+  char data[512];
+
+  printf(1, "stressfs starting\n");
+  memset(data, 'a', sizeof(data));
+  14:	8d b5 e8 fd ff ff    	lea    -0x218(%ebp),%esi
+{
+  1a:	53                   	push   %ebx
+
+  for(i = 0; i < 4; i++)
+  1b:	31 db                	xor    %ebx,%ebx
+{
+  1d:	51                   	push   %ecx
+  1e:	81 ec 20 02 00 00    	sub    $0x220,%esp
+  char path[] = "stressfs0";
+  24:	66 89 85 e6 fd ff ff 	mov    %ax,-0x21a(%ebp)
+  2b:	c7 85 de fd ff ff 73 	movl   $0x65727473,-0x222(%ebp)
+  32:	74 72 65 
+  35:	c7 85 e2 fd ff ff 73 	movl   $0x73667373,-0x21e(%ebp)
+  3c:	73 66 73 
+  printf(1, "stressfs starting\n");
+  3f:	68 b8 08 00 00       	push   $0x8b8
+  44:	6a 01                	push   $0x1
+  46:	e8 45 05 00 00       	call   590 <printf>
+  memset(data, 'a', sizeof(data));
+  4b:	83 c4 0c             	add    $0xc,%esp
+  4e:	68 00 02 00 00       	push   $0x200
+  53:	6a 61                	push   $0x61
+  55:	56                   	push   %esi
+  56:	e8 25 01 00 00       	call   180 <memset>
+  5b:	83 c4 10             	add    $0x10,%esp
+    if(fork() > 0)
+  5e:	e8 71 03 00 00       	call   3d4 <fork>
+  63:	85 c0                	test   %eax,%eax
+  65:	7f 08                	jg     6f <main+0x6f>
+  for(i = 0; i < 4; i++)
+  67:	83 c3 01             	add    $0x1,%ebx
+  6a:	83 fb 04             	cmp    $0x4,%ebx
+  6d:	75 ef                	jne    5e <main+0x5e>
+      break;
+
+  printf(1, "write %d\n", i);
+  6f:	83 ec 04             	sub    $0x4,%esp
+  72:	53                   	push   %ebx
+  73:	68 cb 08 00 00       	push   $0x8cb
+  78:	6a 01                	push   $0x1
+  7a:	e8 11 05 00 00       	call   590 <printf>
+
+  path[8] += i;
+  7f:	00 9d e6 fd ff ff    	add    %bl,-0x21a(%ebp)
+  fd = open(path, O_CREATE | O_RDWR);
+  85:	5f                   	pop    %edi
+  86:	bb 14 00 00 00       	mov    $0x14,%ebx
+  8b:	58                   	pop    %eax
+  8c:	8d 85 de fd ff ff    	lea    -0x222(%ebp),%eax
+  92:	68 02 02 00 00       	push   $0x202
+  97:	50                   	push   %eax
+  98:	e8 7f 03 00 00       	call   41c <open>
+  9d:	83 c4 10             	add    $0x10,%esp
+  a0:	89 c7                	mov    %eax,%edi
+  for(i = 0; i < 20; i++)
+  a2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+//    printf(fd, "%d\n", i);
+    write(fd, data, sizeof(data));
+  a8:	83 ec 04             	sub    $0x4,%esp
+  ab:	68 00 02 00 00       	push   $0x200
+  b0:	56                   	push   %esi
+  b1:	57                   	push   %edi
+  b2:	e8 45 03 00 00       	call   3fc <write>
+  for(i = 0; i < 20; i++)
+  b7:	83 c4 10             	add    $0x10,%esp
+  ba:	83 eb 01             	sub    $0x1,%ebx
+  bd:	75 e9                	jne    a8 <main+0xa8>
+  close(fd);
+  bf:	83 ec 0c             	sub    $0xc,%esp
+  c2:	57                   	push   %edi
+  c3:	e8 3c 03 00 00       	call   404 <close>
+
+  printf(1, "read\n");
+  c8:	58                   	pop    %eax
+  c9:	5a                   	pop    %edx
+  ca:	68 d5 08 00 00       	push   $0x8d5
+  cf:	6a 01                	push   $0x1
+  d1:	e8 ba 04 00 00       	call   590 <printf>
+
+  fd = open(path, O_RDONLY);
+  d6:	8d 85 de fd ff ff    	lea    -0x222(%ebp),%eax
+  dc:	59                   	pop    %ecx
+  dd:	5b                   	pop    %ebx
+  de:	6a 00                	push   $0x0
+  e0:	bb 14 00 00 00       	mov    $0x14,%ebx
+  e5:	50                   	push   %eax
+  e6:	e8 31 03 00 00       	call   41c <open>
+  eb:	83 c4 10             	add    $0x10,%esp
+  ee:	89 c7                	mov    %eax,%edi
+  for (i = 0; i < 20; i++)
+    read(fd, data, sizeof(data));
+  f0:	83 ec 04             	sub    $0x4,%esp
+  f3:	68 00 02 00 00       	push   $0x200
+  f8:	56                   	push   %esi
+  f9:	57                   	push   %edi
+  fa:	e8 f5 02 00 00       	call   3f4 <read>
+  for (i = 0; i < 20; i++)
+  ff:	83 c4 10             	add    $0x10,%esp
+ 102:	83 eb 01             	sub    $0x1,%ebx
+ 105:	75 e9                	jne    f0 <main+0xf0>
+  close(fd);
+ 107:	83 ec 0c             	sub    $0xc,%esp
+ 10a:	57                   	push   %edi
+ 10b:	e8 f4 02 00 00       	call   404 <close>
+
+  wait();
+ 110:	e8 cf 02 00 00       	call   3e4 <wait>
+
+  exit();
+ 115:	e8 c2 02 00 00       	call   3dc <exit>
+ 11a:	66 90                	xchg   %ax,%ax
+ 11c:	66 90                	xchg   %ax,%ax
+ 11e:	66 90                	xchg   %ax,%ax
+
+00000120 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 120:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 121:	31 c0                	xor    %eax,%eax
+{
+ 123:	89 e5                	mov    %esp,%ebp
+ 125:	53                   	push   %ebx
+ 126:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 129:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 12c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 130:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 134:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 137:	83 c0 01             	add    $0x1,%eax
+ 13a:	84 d2                	test   %dl,%dl
+ 13c:	75 f2                	jne    130 <strcpy+0x10>
+    ;
+  return os;
+}
+ 13e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 141:	89 c8                	mov    %ecx,%eax
+ 143:	c9                   	leave
+ 144:	c3                   	ret
+ 145:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 14c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000150 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 150:	55                   	push   %ebp
+ 151:	89 e5                	mov    %esp,%ebp
+ 153:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 156:	80 3a 00             	cmpb   $0x0,(%edx)
+ 159:	74 15                	je     170 <strlen+0x20>
+ 15b:	31 c0                	xor    %eax,%eax
+ 15d:	8d 76 00             	lea    0x0(%esi),%esi
+ 160:	83 c0 01             	add    $0x1,%eax
+ 163:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 167:	89 c1                	mov    %eax,%ecx
+ 169:	75 f5                	jne    160 <strlen+0x10>
+    ;
+  return n;
+}
+ 16b:	89 c8                	mov    %ecx,%eax
+ 16d:	5d                   	pop    %ebp
+ 16e:	c3                   	ret
+ 16f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 170:	31 c9                	xor    %ecx,%ecx
+}
+ 172:	5d                   	pop    %ebp
+ 173:	89 c8                	mov    %ecx,%eax
+ 175:	c3                   	ret
+ 176:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 17d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000180 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 180:	55                   	push   %ebp
+ 181:	89 e5                	mov    %esp,%ebp
+ 183:	57                   	push   %edi
+ 184:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 187:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 18a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 18d:	89 d7                	mov    %edx,%edi
+ 18f:	fc                   	cld
+ 190:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 192:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 195:	89 d0                	mov    %edx,%eax
+ 197:	c9                   	leave
+ 198:	c3                   	ret
+ 199:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001a0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 1a0:	55                   	push   %ebp
+ 1a1:	89 e5                	mov    %esp,%ebp
+ 1a3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1a6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 1aa:	0f b6 10             	movzbl (%eax),%edx
+ 1ad:	84 d2                	test   %dl,%dl
+ 1af:	75 12                	jne    1c3 <strchr+0x23>
+ 1b1:	eb 1d                	jmp    1d0 <strchr+0x30>
+ 1b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1b7:	90                   	nop
+ 1b8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 1bc:	83 c0 01             	add    $0x1,%eax
+ 1bf:	84 d2                	test   %dl,%dl
+ 1c1:	74 0d                	je     1d0 <strchr+0x30>
+    if(*s == c)
+ 1c3:	38 d1                	cmp    %dl,%cl
+ 1c5:	75 f1                	jne    1b8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 1c7:	5d                   	pop    %ebp
+ 1c8:	c3                   	ret
+ 1c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 1d0:	31 c0                	xor    %eax,%eax
+}
+ 1d2:	5d                   	pop    %ebp
+ 1d3:	c3                   	ret
+ 1d4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1df:	90                   	nop
+
+000001e0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 1e0:	55                   	push   %ebp
+ 1e1:	89 e5                	mov    %esp,%ebp
+ 1e3:	57                   	push   %edi
+ 1e4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 1e5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 1e8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 1e9:	31 db                	xor    %ebx,%ebx
+{
+ 1eb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 1ee:	eb 27                	jmp    217 <gets+0x37>
+    cc = read(0, &c, 1);
+ 1f0:	83 ec 04             	sub    $0x4,%esp
+ 1f3:	6a 01                	push   $0x1
+ 1f5:	56                   	push   %esi
+ 1f6:	6a 00                	push   $0x0
+ 1f8:	e8 f7 01 00 00       	call   3f4 <read>
+    if(cc < 1)
+ 1fd:	83 c4 10             	add    $0x10,%esp
+ 200:	85 c0                	test   %eax,%eax
+ 202:	7e 1d                	jle    221 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 204:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 208:	8b 55 08             	mov    0x8(%ebp),%edx
+ 20b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 20f:	3c 0a                	cmp    $0xa,%al
+ 211:	74 10                	je     223 <gets+0x43>
+ 213:	3c 0d                	cmp    $0xd,%al
+ 215:	74 0c                	je     223 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 217:	89 df                	mov    %ebx,%edi
+ 219:	83 c3 01             	add    $0x1,%ebx
+ 21c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 21f:	7c cf                	jl     1f0 <gets+0x10>
+ 221:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 223:	8b 45 08             	mov    0x8(%ebp),%eax
+ 226:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 22a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 22d:	5b                   	pop    %ebx
+ 22e:	5e                   	pop    %esi
+ 22f:	5f                   	pop    %edi
+ 230:	5d                   	pop    %ebp
+ 231:	c3                   	ret
+ 232:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 239:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000240 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 240:	55                   	push   %ebp
+ 241:	89 e5                	mov    %esp,%ebp
+ 243:	56                   	push   %esi
+ 244:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 245:	83 ec 08             	sub    $0x8,%esp
+ 248:	6a 00                	push   $0x0
+ 24a:	ff 75 08             	push   0x8(%ebp)
+ 24d:	e8 ca 01 00 00       	call   41c <open>
+  if(fd < 0)
+ 252:	83 c4 10             	add    $0x10,%esp
+ 255:	85 c0                	test   %eax,%eax
+ 257:	78 27                	js     280 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 259:	83 ec 08             	sub    $0x8,%esp
+ 25c:	ff 75 0c             	push   0xc(%ebp)
+ 25f:	89 c3                	mov    %eax,%ebx
+ 261:	50                   	push   %eax
+ 262:	e8 cd 01 00 00       	call   434 <fstat>
+  close(fd);
+ 267:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 26a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 26c:	e8 93 01 00 00       	call   404 <close>
+  return r;
+ 271:	83 c4 10             	add    $0x10,%esp
+}
+ 274:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 277:	89 f0                	mov    %esi,%eax
+ 279:	5b                   	pop    %ebx
+ 27a:	5e                   	pop    %esi
+ 27b:	5d                   	pop    %ebp
+ 27c:	c3                   	ret
+ 27d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 280:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 285:	eb ed                	jmp    274 <stat+0x34>
+ 287:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 28e:	66 90                	xchg   %ax,%ax
+
+00000290 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 290:	55                   	push   %ebp
+ 291:	89 e5                	mov    %esp,%ebp
+ 293:	57                   	push   %edi
+ 294:	56                   	push   %esi
+ 295:	8b 45 10             	mov    0x10(%ebp),%eax
+ 298:	8b 55 08             	mov    0x8(%ebp),%edx
+ 29b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 29e:	85 c0                	test   %eax,%eax
+ 2a0:	7e 13                	jle    2b5 <memmove+0x25>
+ 2a2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 2a4:	89 d7                	mov    %edx,%edi
+ 2a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ad:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 2b0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 2b1:	39 f8                	cmp    %edi,%eax
+ 2b3:	75 fb                	jne    2b0 <memmove+0x20>
+  return vdst;
+}
+ 2b5:	5e                   	pop    %esi
+ 2b6:	89 d0                	mov    %edx,%eax
+ 2b8:	5f                   	pop    %edi
+ 2b9:	5d                   	pop    %ebp
+ 2ba:	c3                   	ret
+ 2bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2bf:	90                   	nop
+
+000002c0 <parseip>:
+
+// a.b.c.d to network byte order. -1 if malformed
+int
+parseip(char *s, uint *addr)
+{
+ 2c0:	55                   	push   %ebp
+ 2c1:	89 e5                	mov    %esp,%ebp
+ 2c3:	57                   	push   %edi
+  uint8_t *b = (uint8_t*)addr;
+  int v;
+
+  for(int i = 0; i < 4; i++) {
+ 2c4:	31 ff                	xor    %edi,%edi
+{
+ 2c6:	56                   	push   %esi
+ 2c7:	53                   	push   %ebx
+ 2c8:	8b 55 08             	mov    0x8(%ebp),%edx
+    if(*s < '0' || *s > '9')
+ 2cb:	0f be 02             	movsbl (%edx),%eax
+ 2ce:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 2d1:	80 f9 09             	cmp    $0x9,%cl
+ 2d4:	77 59                	ja     32f <parseip+0x6f>
+      return -1;
+    for(v = 0; *s >= '0' && *s <= '9'; s++)
+ 2d6:	31 c9                	xor    %ecx,%ecx
+ 2d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2df:	90                   	nop
+      v = v * 10 + *s - '0';
+ 2e0:	89 d6                	mov    %edx,%esi
+ 2e2:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    for(v = 0; *s >= '0' && *s <= '9'; s++)
+ 2e5:	83 c2 01             	add    $0x1,%edx
+      v = v * 10 + *s - '0';
+ 2e8:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+    for(v = 0; *s >= '0' && *s <= '9'; s++)
+ 2ec:	0f be 02             	movsbl (%edx),%eax
+ 2ef:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 2f2:	80 fb 09             	cmp    $0x9,%bl
+ 2f5:	76 e9                	jbe    2e0 <parseip+0x20>
+    if(v > 255 || *s != (i < 3 ? '.' : '\0'))
+ 2f7:	81 f9 ff 00 00 00    	cmp    $0xff,%ecx
+ 2fd:	7f 30                	jg     32f <parseip+0x6f>
+ 2ff:	83 ff 03             	cmp    $0x3,%edi
+ 302:	74 1c                	je     320 <parseip+0x60>
+ 304:	83 f8 2e             	cmp    $0x2e,%eax
+ 307:	75 26                	jne    32f <parseip+0x6f>
+      return -1;
+    b[i] = v;
+ 309:	8b 45 0c             	mov    0xc(%ebp),%eax
+    s++;
+ 30c:	8d 56 02             	lea    0x2(%esi),%edx
+    b[i] = v;
+ 30f:	88 0c 38             	mov    %cl,(%eax,%edi,1)
+  for(int i = 0; i < 4; i++) {
+ 312:	83 c7 01             	add    $0x1,%edi
+ 315:	eb b4                	jmp    2cb <parseip+0xb>
+ 317:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 31e:	66 90                	xchg   %ax,%ax
+    if(v > 255 || *s != (i < 3 ? '.' : '\0'))
+ 320:	85 c0                	test   %eax,%eax
+ 322:	75 0b                	jne    32f <parseip+0x6f>
+    b[i] = v;
+ 324:	8b 7d 0c             	mov    0xc(%ebp),%edi
+ 327:	88 4f 03             	mov    %cl,0x3(%edi)
+  }
+  return 0;
+}
+ 32a:	5b                   	pop    %ebx
+ 32b:	5e                   	pop    %esi
+ 32c:	5f                   	pop    %edi
+ 32d:	5d                   	pop    %ebp
+ 32e:	c3                   	ret
+ 32f:	5b                   	pop    %ebx
+      return -1;
+ 330:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+ 335:	5e                   	pop    %esi
+ 336:	5f                   	pop    %edi
+ 337:	5d                   	pop    %ebp
+ 338:	c3                   	ret
+ 339:	66 90                	xchg   %ax,%ax
+ 33b:	66 90                	xchg   %ax,%ax
+ 33d:	66 90                	xchg   %ax,%ax
+ 33f:	90                   	nop
+
+00000340 <atoi>:
+#include "types.h"
+#include "util.h"
+
+int
+atoi(const char *s)
+{
+ 340:	55                   	push   %ebp
+ 341:	89 e5                	mov    %esp,%ebp
+ 343:	53                   	push   %ebx
+ 344:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 347:	0f be 02             	movsbl (%edx),%eax
+ 34a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 34d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 350:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 355:	77 1e                	ja     375 <atoi+0x35>
+ 357:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 35e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 360:	83 c2 01             	add    $0x1,%edx
+ 363:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 366:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 36a:	0f be 02             	movsbl (%edx),%eax
+ 36d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 370:	80 fb 09             	cmp    $0x9,%bl
+ 373:	76 eb                	jbe    360 <atoi+0x20>
+  return n;
+}
+ 375:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 378:	89 c8                	mov    %ecx,%eax
+ 37a:	c9                   	leave
+ 37b:	c3                   	ret
+ 37c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000380 <strcmp>:
+
+
+int
+strcmp(const char *p, const char *q)
+{
+ 380:	55                   	push   %ebp
+ 381:	89 e5                	mov    %esp,%ebp
+ 383:	53                   	push   %ebx
+ 384:	8b 55 08             	mov    0x8(%ebp),%edx
+ 387:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 38a:	0f b6 02             	movzbl (%edx),%eax
+ 38d:	84 c0                	test   %al,%al
+ 38f:	75 17                	jne    3a8 <strcmp+0x28>
+ 391:	eb 3a                	jmp    3cd <strcmp+0x4d>
+ 393:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 397:	90                   	nop
+ 398:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 39c:	83 c2 01             	add    $0x1,%edx
+ 39f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 3a2:	84 c0                	test   %al,%al
+ 3a4:	74 1a                	je     3c0 <strcmp+0x40>
+    p++, q++;
+ 3a6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 3a8:	0f b6 19             	movzbl (%ecx),%ebx
+ 3ab:	38 c3                	cmp    %al,%bl
+ 3ad:	74 e9                	je     398 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 3af:	29 d8                	sub    %ebx,%eax
+}
+ 3b1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3b4:	c9                   	leave
+ 3b5:	c3                   	ret
+ 3b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3bd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 3c0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 3c4:	31 c0                	xor    %eax,%eax
+ 3c6:	29 d8                	sub    %ebx,%eax
+}
+ 3c8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3cb:	c9                   	leave
+ 3cc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 3cd:	0f b6 19             	movzbl (%ecx),%ebx
+ 3d0:	31 c0                	xor    %eax,%eax
+ 3d2:	eb db                	jmp    3af <strcmp+0x2f>
+
+000003d4 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 3d4:	b8 01 00 00 00       	mov    $0x1,%eax
+ 3d9:	cd 40                	int    $0x40
+ 3db:	c3                   	ret
+
+000003dc <exit>:
+SYSCALL(exit)
+ 3dc:	b8 02 00 00 00       	mov    $0x2,%eax
+ 3e1:	cd 40                	int    $0x40
+ 3e3:	c3                   	ret
+
+000003e4 <wait>:
+SYSCALL(wait)
+ 3e4:	b8 03 00 00 00       	mov    $0x3,%eax
+ 3e9:	cd 40                	int    $0x40
+ 3eb:	c3                   	ret
+
+000003ec <pipe>:
+SYSCALL(pipe)
+ 3ec:	b8 04 00 00 00       	mov    $0x4,%eax
+ 3f1:	cd 40                	int    $0x40
+ 3f3:	c3                   	ret
+
+000003f4 <read>:
+SYSCALL(read)
+ 3f4:	b8 05 00 00 00       	mov    $0x5,%eax
+ 3f9:	cd 40                	int    $0x40
+ 3fb:	c3                   	ret
+
+000003fc <write>:
+SYSCALL(write)
+ 3fc:	b8 10 00 00 00       	mov    $0x10,%eax
+ 401:	cd 40                	int    $0x40
+ 403:	c3                   	ret
+
+00000404 <close>:
+SYSCALL(close)
+ 404:	b8 15 00 00 00       	mov    $0x15,%eax
+ 409:	cd 40                	int    $0x40
+ 40b:	c3                   	ret
+
+0000040c <kill>:
+SYSCALL(kill)
+ 40c:	b8 06 00 00 00       	mov    $0x6,%eax
+ 411:	cd 40                	int    $0x40
+ 413:	c3                   	ret
+
+00000414 <exec>:
+SYSCALL(exec)
+ 414:	b8 07 00 00 00       	mov    $0x7,%eax
+ 419:	cd 40                	int    $0x40
+ 41b:	c3                   	ret
+
+0000041c <open>:
+SYSCALL(open)
+ 41c:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 421:	cd 40                	int    $0x40
+ 423:	c3                   	ret
+
+00000424 <mknod>:
+SYSCALL(mknod)
+ 424:	b8 11 00 00 00       	mov    $0x11,%eax
+ 429:	cd 40                	int    $0x40
+ 42b:	c3                   	ret
+
+0000042c <unlink>:
+SYSCALL(unlink)
+ 42c:	b8 12 00 00 00       	mov    $0x12,%eax
+ 431:	cd 40                	int    $0x40
+ 433:	c3                   	ret
+
+00000434 <fstat>:
+SYSCALL(fstat)
+ 434:	b8 08 00 00 00       	mov    $0x8,%eax
+ 439:	cd 40                	int    $0x40
+ 43b:	c3                   	ret
+
+0000043c <link>:
+SYSCALL(link)
+ 43c:	b8 13 00 00 00       	mov    $0x13,%eax
+ 441:	cd 40                	int    $0x40
+ 443:	c3                   	ret
+
+00000444 <mkdir>:
+SYSCALL(mkdir)
+ 444:	b8 14 00 00 00       	mov    $0x14,%eax
+ 449:	cd 40                	int    $0x40
+ 44b:	c3                   	ret
+
+0000044c <chdir>:
+SYSCALL(chdir)
+ 44c:	b8 09 00 00 00       	mov    $0x9,%eax
+ 451:	cd 40                	int    $0x40
+ 453:	c3                   	ret
+
+00000454 <dup>:
+SYSCALL(dup)
+ 454:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 459:	cd 40                	int    $0x40
+ 45b:	c3                   	ret
+
+0000045c <getpid>:
+SYSCALL(getpid)
+ 45c:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 461:	cd 40                	int    $0x40
+ 463:	c3                   	ret
+
+00000464 <sbrk>:
+SYSCALL(sbrk)
+ 464:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 469:	cd 40                	int    $0x40
+ 46b:	c3                   	ret
+
+0000046c <sleep>:
+SYSCALL(sleep)
+ 46c:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 471:	cd 40                	int    $0x40
+ 473:	c3                   	ret
+
+00000474 <uptime>:
+SYSCALL(uptime)
+ 474:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 479:	cd 40                	int    $0x40
+ 47b:	c3                   	ret
+
+0000047c <arp>:
+SYSCALL(arp)
+ 47c:	b8 16 00 00 00       	mov    $0x16,%eax
+ 481:	cd 40                	int    $0x40
+ 483:	c3                   	ret
+
+00000484 <nicget>:
+SYSCALL(nicget)
+ 484:	b8 17 00 00 00       	mov    $0x17,%eax
+ 489:	cd 40                	int    $0x40
+ 48b:	c3                   	ret
+
+0000048c <nicset>:
+SYSCALL(nicset)
+ 48c:	b8 18 00 00 00       	mov    $0x18,%eax
+ 491:	cd 40                	int    $0x40
+ 493:	c3                   	ret
+
+00000494 <nicstats>:
+SYSCALL(nicstats)
+ 494:	b8 19 00 00 00       	mov    $0x19,%eax
+ 499:	cd 40                	int    $0x40
+ 49b:	c3                   	ret
+
+0000049c <nicsend>:
+SYSCALL(nicsend)
+ 49c:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 4a1:	cd 40                	int    $0x40
+ 4a3:	c3                   	ret
+
+000004a4 <nicrecv>:
+SYSCALL(nicrecv)
+ 4a4:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 4a9:	cd 40                	int    $0x40
+ 4ab:	c3                   	ret
+
+000004ac <arpdump>:
+SYSCALL(arpdump)
+ 4ac:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 4b1:	cd 40                	int    $0x40
+ 4b3:	c3                   	ret
+
+000004b4 <arpflush>:
+SYSCALL(arpflush)
+ 4b4:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 4b9:	cd 40                	int    $0x40
+ 4bb:	c3                   	ret
+
+000004bc <nicgetip>:
+SYSCALL(nicgetip)
+ 4bc:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 4c1:	cd 40                	int    $0x40
+ 4c3:	c3                   	ret
+
+000004c4 <nicsetip>:
+SYSCALL(nicsetip)
+ 4c4:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 4c9:	cd 40                	int    $0x40
+ 4cb:	c3                   	ret
+
+000004cc <arpresolve>:
+SYSCALL(arpresolve)
+ 4cc:	b8 20 00 00 00       	mov    $0x20,%eax
+ 4d1:	cd 40                	int    $0x40
+ 4d3:	c3                   	ret
+
+000004d4 <arpresolvev>:
+SYSCALL(arpresolvev)
+ 4d4:	b8 21 00 00 00       	mov    $0x21,%eax
+ 4d9:	cd 40                	int    $0x40
+ 4db:	c3                   	ret
+
+000004dc <arpsend>:
+SYSCALL(arpsend)
+ 4dc:	b8 22 00 00 00       	mov    $0x22,%eax
+ 4e1:	cd 40                	int    $0x40
+ 4e3:	c3                   	ret
+ 4e4:	66 90                	xchg   %ax,%ax
+ 4e6:	66 90                	xchg   %ax,%ax
+ 4e8:	66 90                	xchg   %ax,%ax
+ 4ea:	66 90                	xchg   %ax,%ax
+ 4ec:	66 90                	xchg   %ax,%ax
+ 4ee:	66 90                	xchg   %ax,%ax
+
+000004f0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 4f0:	55                   	push   %ebp
+ 4f1:	89 e5                	mov    %esp,%ebp
+ 4f3:	57                   	push   %edi
+ 4f4:	56                   	push   %esi
+ 4f5:	53                   	push   %ebx
+ 4f6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 4f8:	89 d1                	mov    %edx,%ecx
+{
+ 4fa:	83 ec 3c             	sub    $0x3c,%esp
+ 4fd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 500:	85 d2                	test   %edx,%edx
+ 502:	0f 89 80 00 00 00    	jns    588 <printint+0x98>
+ 508:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 50c:	74 7a                	je     588 <printint+0x98>
+    x = -xx;
+ 50e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 510:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 515:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 518:	31 f6                	xor    %esi,%esi
+ 51a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 520:	89 c8                	mov    %ecx,%eax
+ 522:	31 d2                	xor    %edx,%edx
+ 524:	89 f7                	mov    %esi,%edi
+ 526:	f7 f3                	div    %ebx
+ 528:	8d 76 01             	lea    0x1(%esi),%esi
+ 52b:	0f b6 92 3c 09 00 00 	movzbl 0x93c(%edx),%edx
+ 532:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 536:	89 ca                	mov    %ecx,%edx
+ 538:	89 c1                	mov    %eax,%ecx
+ 53a:	39 da                	cmp    %ebx,%edx
+ 53c:	73 e2                	jae    520 <printint+0x30>
+  if(neg)
+ 53e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 541:	85 c0                	test   %eax,%eax
+ 543:	74 07                	je     54c <printint+0x5c>
+    buf[i++] = '-';
+ 545:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 54a:	89 f7                	mov    %esi,%edi
+ 54c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 54f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 552:	01 df                	add    %ebx,%edi
+ 554:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 558:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 55b:	83 ec 04             	sub    $0x4,%esp
+ 55e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 561:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 564:	6a 01                	push   $0x1
+ 566:	50                   	push   %eax
+ 567:	56                   	push   %esi
+ 568:	e8 8f fe ff ff       	call   3fc <write>
+  while(--i >= 0)
+ 56d:	89 f8                	mov    %edi,%eax
+ 56f:	83 c4 10             	add    $0x10,%esp
+ 572:	83 ef 01             	sub    $0x1,%edi
+ 575:	39 d8                	cmp    %ebx,%eax
+ 577:	75 df                	jne    558 <printint+0x68>
+}
+ 579:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 57c:	5b                   	pop    %ebx
+ 57d:	5e                   	pop    %esi
+ 57e:	5f                   	pop    %edi
+ 57f:	5d                   	pop    %ebp
+ 580:	c3                   	ret
+ 581:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 588:	31 c0                	xor    %eax,%eax
+ 58a:	eb 89                	jmp    515 <printint+0x25>
+ 58c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000590 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 590:	55                   	push   %ebp
+ 591:	89 e5                	mov    %esp,%ebp
+ 593:	57                   	push   %edi
+ 594:	56                   	push   %esi
+ 595:	53                   	push   %ebx
+ 596:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 599:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 59c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 59f:	0f b6 1e             	movzbl (%esi),%ebx
+ 5a2:	83 c6 01             	add    $0x1,%esi
+ 5a5:	84 db                	test   %bl,%bl
+ 5a7:	74 67                	je     610 <printf+0x80>
+ 5a9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 5ac:	31 d2                	xor    %edx,%edx
+ 5ae:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 5b1:	eb 34                	jmp    5e7 <printf+0x57>
+ 5b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5b7:	90                   	nop
+ 5b8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 5bb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 5c0:	83 f8 25             	cmp    $0x25,%eax
+ 5c3:	74 18                	je     5dd <printf+0x4d>
+  write(fd, &c, 1);
+ 5c5:	83 ec 04             	sub    $0x4,%esp
+ 5c8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 5cb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 5ce:	6a 01                	push   $0x1
+ 5d0:	50                   	push   %eax
+ 5d1:	57                   	push   %edi
+ 5d2:	e8 25 fe ff ff       	call   3fc <write>
+ 5d7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 5da:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 5dd:	0f b6 1e             	movzbl (%esi),%ebx
+ 5e0:	83 c6 01             	add    $0x1,%esi
+ 5e3:	84 db                	test   %bl,%bl
+ 5e5:	74 29                	je     610 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 5e7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 5ea:	85 d2                	test   %edx,%edx
+ 5ec:	74 ca                	je     5b8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 5ee:	83 fa 25             	cmp    $0x25,%edx
+ 5f1:	75 ea                	jne    5dd <printf+0x4d>
+      if(c == 'd'){
+ 5f3:	83 f8 25             	cmp    $0x25,%eax
+ 5f6:	0f 84 24 01 00 00    	je     720 <printf+0x190>
+ 5fc:	83 e8 63             	sub    $0x63,%eax
+ 5ff:	83 f8 15             	cmp    $0x15,%eax
+ 602:	77 1c                	ja     620 <printf+0x90>
+ 604:	ff 24 85 e4 08 00 00 	jmp    *0x8e4(,%eax,4)
+ 60b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 60f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 610:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 613:	5b                   	pop    %ebx
+ 614:	5e                   	pop    %esi
+ 615:	5f                   	pop    %edi
+ 616:	5d                   	pop    %ebp
+ 617:	c3                   	ret
+ 618:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 61f:	90                   	nop
+  write(fd, &c, 1);
+ 620:	83 ec 04             	sub    $0x4,%esp
+ 623:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 626:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 62a:	6a 01                	push   $0x1
+ 62c:	52                   	push   %edx
+ 62d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 630:	57                   	push   %edi
+ 631:	e8 c6 fd ff ff       	call   3fc <write>
+ 636:	83 c4 0c             	add    $0xc,%esp
+ 639:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 63c:	6a 01                	push   $0x1
+ 63e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 641:	52                   	push   %edx
+ 642:	57                   	push   %edi
+ 643:	e8 b4 fd ff ff       	call   3fc <write>
+        putc(fd, c);
+ 648:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 64b:	31 d2                	xor    %edx,%edx
+ 64d:	eb 8e                	jmp    5dd <printf+0x4d>
+ 64f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 650:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 653:	83 ec 0c             	sub    $0xc,%esp
+ 656:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 65b:	8b 13                	mov    (%ebx),%edx
+ 65d:	6a 00                	push   $0x0
+ 65f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 661:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 664:	e8 87 fe ff ff       	call   4f0 <printint>
+        ap++;
+ 669:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 66c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 66f:	31 d2                	xor    %edx,%edx
+ 671:	e9 67 ff ff ff       	jmp    5dd <printf+0x4d>
+ 676:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 67d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 680:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 683:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 685:	83 c0 04             	add    $0x4,%eax
+ 688:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 68b:	85 db                	test   %ebx,%ebx
+ 68d:	0f 84 9d 00 00 00    	je     730 <printf+0x1a0>
+        while(*s != 0){
+ 693:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 696:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 698:	84 c0                	test   %al,%al
+ 69a:	0f 84 3d ff ff ff    	je     5dd <printf+0x4d>
+ 6a0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 6a3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 6a6:	89 de                	mov    %ebx,%esi
+ 6a8:	89 d3                	mov    %edx,%ebx
+ 6aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 6b0:	83 ec 04             	sub    $0x4,%esp
+ 6b3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 6b6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 6b9:	6a 01                	push   $0x1
+ 6bb:	53                   	push   %ebx
+ 6bc:	57                   	push   %edi
+ 6bd:	e8 3a fd ff ff       	call   3fc <write>
+        while(*s != 0){
+ 6c2:	0f b6 06             	movzbl (%esi),%eax
+ 6c5:	83 c4 10             	add    $0x10,%esp
+ 6c8:	84 c0                	test   %al,%al
+ 6ca:	75 e4                	jne    6b0 <printf+0x120>
+      state = 0;
+ 6cc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 6cf:	31 d2                	xor    %edx,%edx
+ 6d1:	e9 07 ff ff ff       	jmp    5dd <printf+0x4d>
+ 6d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6dd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 6e0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 6e3:	83 ec 0c             	sub    $0xc,%esp
+ 6e6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 6eb:	8b 13                	mov    (%ebx),%edx
+ 6ed:	6a 01                	push   $0x1
+ 6ef:	e9 6b ff ff ff       	jmp    65f <printf+0xcf>
+ 6f4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 6f8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 6fb:	83 ec 04             	sub    $0x4,%esp
+ 6fe:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 701:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 703:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 706:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 709:	6a 01                	push   $0x1
+ 70b:	52                   	push   %edx
+ 70c:	57                   	push   %edi
+ 70d:	e8 ea fc ff ff       	call   3fc <write>
+        ap++;
+ 712:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 715:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 718:	31 d2                	xor    %edx,%edx
+ 71a:	e9 be fe ff ff       	jmp    5dd <printf+0x4d>
+ 71f:	90                   	nop
+  write(fd, &c, 1);
+ 720:	83 ec 04             	sub    $0x4,%esp
+ 723:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 726:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 729:	6a 01                	push   $0x1
+ 72b:	e9 11 ff ff ff       	jmp    641 <printf+0xb1>
+ 730:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 735:	bb db 08 00 00       	mov    $0x8db,%ebx
+ 73a:	e9 61 ff ff ff       	jmp    6a0 <printf+0x110>
+ 73f:	90                   	nop
+
+00000740 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 740:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 741:	a1 24 0c 00 00       	mov    0xc24,%eax
+{
+ 746:	89 e5                	mov    %esp,%ebp
+ 748:	57                   	push   %edi
+ 749:	56                   	push   %esi
+ 74a:	53                   	push   %ebx
+ 74b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 74e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 751:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 758:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 75a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 75c:	39 ca                	cmp    %ecx,%edx
+ 75e:	73 30                	jae    790 <free+0x50>
+ 760:	39 c1                	cmp    %eax,%ecx
+ 762:	72 04                	jb     768 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 764:	39 c2                	cmp    %eax,%edx
+ 766:	72 f0                	jb     758 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 768:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 76b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 76e:	39 f8                	cmp    %edi,%eax
+ 770:	74 2e                	je     7a0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 772:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 775:	8b 42 04             	mov    0x4(%edx),%eax
+ 778:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 77b:	39 f1                	cmp    %esi,%ecx
+ 77d:	74 38                	je     7b7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 77f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 781:	5b                   	pop    %ebx
+  freep = p;
+ 782:	89 15 24 0c 00 00    	mov    %edx,0xc24
+}
+ 788:	5e                   	pop    %esi
+ 789:	5f                   	pop    %edi
+ 78a:	5d                   	pop    %ebp
+ 78b:	c3                   	ret
+ 78c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 790:	39 c1                	cmp    %eax,%ecx
+ 792:	72 d0                	jb     764 <free+0x24>
+ 794:	eb c2                	jmp    758 <free+0x18>
+ 796:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 79d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 7a0:	03 70 04             	add    0x4(%eax),%esi
+ 7a3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 7a6:	8b 02                	mov    (%edx),%eax
+ 7a8:	8b 00                	mov    (%eax),%eax
+ 7aa:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 7ad:	8b 42 04             	mov    0x4(%edx),%eax
+ 7b0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 7b3:	39 f1                	cmp    %esi,%ecx
+ 7b5:	75 c8                	jne    77f <free+0x3f>
+    p->s.size += bp->s.size;
+ 7b7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 7ba:	89 15 24 0c 00 00    	mov    %edx,0xc24
+    p->s.size += bp->s.size;
+ 7c0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 7c3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 7c6:	89 0a                	mov    %ecx,(%edx)
+}
+ 7c8:	5b                   	pop    %ebx
+ 7c9:	5e                   	pop    %esi
+ 7ca:	5f                   	pop    %edi
+ 7cb:	5d                   	pop    %ebp
+ 7cc:	c3                   	ret
+ 7cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000007d0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 7d0:	55                   	push   %ebp
+ 7d1:	89 e5                	mov    %esp,%ebp
+ 7d3:	57                   	push   %edi
+ 7d4:	56                   	push   %esi
+ 7d5:	53                   	push   %ebx
+ 7d6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 7d9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 7dc:	8b 15 24 0c 00 00    	mov    0xc24,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 7e2:	8d 78 07             	lea    0x7(%eax),%edi
+ 7e5:	c1 ef 03             	shr    $0x3,%edi
+ 7e8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 7eb:	85 d2                	test   %edx,%edx
+ 7ed:	0f 84 8d 00 00 00    	je     880 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 7f3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 7f5:	8b 48 04             	mov    0x4(%eax),%ecx
+ 7f8:	39 f9                	cmp    %edi,%ecx
+ 7fa:	73 64                	jae    860 <malloc+0x90>
+  if(nu < 4096)
+ 7fc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 801:	39 df                	cmp    %ebx,%edi
+ 803:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 806:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 80d:	eb 0a                	jmp    819 <malloc+0x49>
+ 80f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 810:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 812:	8b 48 04             	mov    0x4(%eax),%ecx
+ 815:	39 f9                	cmp    %edi,%ecx
+ 817:	73 47                	jae    860 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 819:	89 c2                	mov    %eax,%edx
+ 81b:	39 05 24 0c 00 00    	cmp    %eax,0xc24
+ 821:	75 ed                	jne    810 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 823:	83 ec 0c             	sub    $0xc,%esp
+ 826:	56                   	push   %esi
+ 827:	e8 38 fc ff ff       	call   464 <sbrk>
+  if(p == (char*)-1)
+ 82c:	83 c4 10             	add    $0x10,%esp
+ 82f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 832:	74 1c                	je     850 <malloc+0x80>
+  hp->s.size = nu;
+ 834:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 837:	83 ec 0c             	sub    $0xc,%esp
+ 83a:	83 c0 08             	add    $0x8,%eax
+ 83d:	50                   	push   %eax
+ 83e:	e8 fd fe ff ff       	call   740 <free>
+  return freep;
+ 843:	8b 15 24 0c 00 00    	mov    0xc24,%edx
+      if((p = morecore(nunits)) == 0)
+ 849:	83 c4 10             	add    $0x10,%esp
+ 84c:	85 d2                	test   %edx,%edx
+ 84e:	75 c0                	jne    810 <malloc+0x40>
+        return 0;
+  }
+}
+ 850:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 853:	31 c0                	xor    %eax,%eax
+}
+ 855:	5b                   	pop    %ebx
+ 856:	5e                   	pop    %esi
+ 857:	5f                   	pop    %edi
+ 858:	5d                   	pop    %ebp
+ 859:	c3                   	ret
+ 85a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 860:	39 cf                	cmp    %ecx,%edi
+ 862:	74 4c                	je     8b0 <malloc+0xe0>
+        p->s.size -= nunits;
+ 864:	29 f9                	sub    %edi,%ecx
+ 866:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 869:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 86c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 86f:	89 15 24 0c 00 00    	mov    %edx,0xc24
+}
+ 875:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 878:	83 c0 08             	add    $0x8,%eax
+}
+ 87b:	5b                   	pop    %ebx
+ 87c:	5e                   	pop    %esi
+ 87d:	5f                   	pop    %edi
+ 87e:	5d                   	pop    %ebp
+ 87f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 880:	c7 05 24 0c 00 00 28 	movl   $0xc28,0xc24
+ 887:	0c 00 00 
+    base.s.size = 0;
+ 88a:	b8 28 0c 00 00       	mov    $0xc28,%eax
+    base.s.ptr = freep = prevp = &base;
+ 88f:	c7 05 28 0c 00 00 28 	movl   $0xc28,0xc28
+ 896:	0c 00 00 
+    base.s.size = 0;
+ 899:	c7 05 2c 0c 00 00 00 	movl   $0x0,0xc2c
+ 8a0:	00 00 00 
+    if(p->s.size >= nunits){
+ 8a3:	e9 54 ff ff ff       	jmp    7fc <malloc+0x2c>
+ 8a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8af:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 8b0:	8b 08                	mov    (%eax),%ecx
+ 8b2:	89 0a                	mov    %ecx,(%edx)
+ 8b4:	eb b9                	jmp    86f <malloc+0x9f>
@@ -3,10 +3,14 @@
  *
  *system call to send an ARP request
  *expects a char* IP address as argument
+ *and system calls to read and flush the ARP cache
+ *and to resolve binary addresses or send to one, see arpctl.h
  */
 
 #include "types.h"
 #include "defs.h"
+#include "arpctl.h"
+#include "nic.h"
 
 int sys_arp(void) {
   char *ipAddr, *interface, *arpResp;
@@ -24,3 +28,89 @@ int sys_arp(void) {
 
   return 0;
 }
+
+// arpdump(ents, n): copy up to n ARP cache entries, returns how many
+int sys_arpdump(void) {
+  struct arpent *ents;
+  int n;
+
+  if(argint(1, &n) < 0 || n < 0)
+    return -1;
+  //the cache never holds more, and a huge n would wrap the argptr size
+  if(n > ARP_CACHE_SIZE)
+    n = ARP_CACHE_SIZE;
+  if(argptr(0, (char**)&ents, n * sizeof(struct arpent)) < 0)
+    return -1;
+
+  return arp_cache_dump(ents, n);
+}
+
+int sys_arpflush(void) {
+  arp_cache_flush();
+  return 0;
+}
+
+// arpresolve(interface, ip, mac, flags): ip in network byte order, mac
+// gets 6 bytes. Returns 0, ARP_EAGAIN, ARP_EUNREACH or -1
+int sys_arpresolve(void) {
+  char *interface;
+  uint8_t *mac;
+  int ip, flags;
+  struct nic_device *nd;
+
+  if(argstr(0, &interface) < 0 || argint(1, &ip) < 0 ||
+     argptr(2, (char**)&mac, 6) < 0 || argint(3, &flags) < 0)
+    return -1;
+  if(get_device(interface, &nd) < 0)
+    return -1;
+
+  return arp_lookup(nd, ip, mac, flags);
+}
+
+// arpresolvev(interface, reqs, n, flags): resolve n addresses, each
+// arpreq gets its own status. As many requests as there are pending
+// slots go out before we wait on any, so their replies come back in
+// parallel; when blocking, the rest wait for a slot. Returns how many
+// resolved.
+int sys_arpresolvev(void) {
+  char *interface;
+  struct arpreq *reqs;
+  int n, flags, resolved = 0;
+  struct nic_device *nd;
+
+  if(argstr(0, &interface) < 0 || argint(2, &n) < 0 || n < 0 || n > ARP_BATCH_MAX ||
+     argptr(1, (char**)&reqs, n * sizeof(struct arpreq)) < 0 || argint(3, &flags) < 0)
+    return -1;
+  if(get_device(interface, &nd) < 0)
+    return -1;
+
+  for(int i = 0; i < n; i++)
+    reqs[i].status = arp_lookup(nd, reqs[i].ip, reqs[i].mac, ARP_NONBLOCK);
+  for(int i = 0; i < n; i++) {
+    //-1 here mostly means no free pending slot, a blocking lookup waits for one
+    if((reqs[i].status == ARP_EAGAIN || reqs[i].status == -1) && (flags & ARP_NONBLOCK) == 0)
+      reqs[i].status = arp_lookup(nd, reqs[i].ip, reqs[i].mac, flags);
+    if(reqs[i].status == 0)
+      resolved++;
+  }
+  return resolved;
+}
+
+// arpsend(interface, ip, frame, length): send a whole Ethernet frame to
+// ip, which may not be resolved yet; the destination address is filled
+// in, in frame too. Returns 0 if sent or queued, -1 if dropped
+int sys_arpsend(void) {
+  char *interface, *frame;
+  int ip, length;
+  struct nic_device *nd;
+
+  if(argstr(0, &interface) < 0 || argint(1, &ip) < 0 || argint(3, &length) < 0 ||
+     length < 0 || argptr(2, &frame, length) < 0)
+    return -1;
+  if(get_device(interface, &nd) < 0)
+    return -1;
+  if(length > ETHR_HDR_LEN + nd->mtu)
+    return -1;
+
+  return arp_output(nd, ip, (uint8_t*)frame, length);
+}
@@ -104,6 +104,18 @@ extern int sys_wait(void);
 extern int sys_write(void);
 extern int sys_uptime(void);
 extern int sys_arp(void);
+extern int sys_nicget(void);
+extern int sys_nicset(void);
+extern int sys_nicstats(void);
+extern int sys_nicsend(void);
+extern int sys_nicrecv(void);
+extern int sys_arpdump(void);
+extern int sys_arpflush(void);
+extern int sys_nicgetip(void);
+extern int sys_nicsetip(void);
+extern int sys_arpresolve(void);
+extern int sys_arpresolvev(void);
+extern int sys_arpsend(void);
 
 static int (*syscalls[])(void) = {
 [SYS_fork]    sys_fork,
@@ -127,7 +139,19 @@ static int (*syscalls[])(void) = {
 [SYS_link]    sys_link,
 [SYS_mkdir]   sys_mkdir,
 [SYS_close]   sys_close,
-[SYS_arp] sys_arp
+[SYS_arp] sys_arp,
+[SYS_nicget] sys_nicget,
+[SYS_nicset] sys_nicset,
+[SYS_nicstats] sys_nicstats,
+[SYS_nicsend] sys_nicsend,
+[SYS_nicrecv] sys_nicrecv,
+[SYS_arpdump] sys_arpdump,
+[SYS_arpflush] sys_arpflush,
+[SYS_nicgetip] sys_nicgetip,
+[SYS_nicsetip] sys_nicsetip,
+[SYS_arpresolve] sys_arpresolve,
+[SYS_arpresolvev] sys_arpresolvev,
+[SYS_arpsend] sys_arpsend,
 };
 
 void
@@ -21,3 +21,15 @@
 #define SYS_mkdir  20
 #define SYS_close  21
 #define SYS_arp 22
+#define SYS_nicget 23
+#define SYS_nicset 24
+#define SYS_nicstats 25
+#define SYS_nicsend 26
+#define SYS_nicrecv 27
+#define SYS_arpdump 28
+#define SYS_arpflush 29
+#define SYS_nicgetip 30
+#define SYS_nicsetip 31
+#define SYS_arpresolve 32
+#define SYS_arpresolvev 33
+#define SYS_arpsend 34
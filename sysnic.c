@@ -0,0 +1,127 @@
+/**
+ *system calls on NIC interfaces, named eth0, eth1...:
+ *nicget/nicset read and tune NICCTL_* parameters (nicctl.h),
+ *nicstats reads NICSTAT_* counters (nicstat.h),
+ *nicsend/nicrecv move raw Ethernet frames,
+ *nicgetip/nicsetip read and set the IPv4 address
+ */
+
+#include "types.h"
+#include "defs.h"
+#include "nic.h"
+#include "nicstat.h"
+
+// nicget(interface, param, &value): values are unsigned and may use
+// all 32 bits, so they come back through value, not the return code
+int sys_nicget(void) {
+  char *interface;
+  int param;
+  uint32_t *value;
+  struct nic_device *nd;
+
+  if(argstr(0, &interface) < 0 || argint(1, &param) < 0 ||
+     argptr(2, (char**)&value, sizeof(*value)) < 0)
+    return -1;
+  if(get_device(interface, &nd) < 0)
+    return -1;
+
+  return nic_get_param(nd, param, value) < 0 ? -1 : 0;
+}
+
+int sys_nicset(void) {
+  char *interface;
+  int param, value;
+  struct nic_device *nd;
+
+  if(argstr(0, &interface) < 0 || argint(1, &param) < 0 || argint(2, &value) < 0)
+    return -1;
+  if(value < 0)
+    return -1;
+  if(get_device(interface, &nd) < 0)
+    return -1;
+
+  return nic_set_param(nd, param, value);
+}
+
+// nicstats(interface, stats, n): fill in up to n NICSTAT_* counters,
+// returns how many.
+int sys_nicstats(void) {
+  char *interface;
+  uint64_t *stats;
+  int n;
+  struct nic_device *nd;
+
+  if(argstr(0, &interface) < 0 || argint(2, &n) < 0 || n < 0)
+    return -1;
+  //counters past NICSTAT_COUNT don't exist; capping also keeps the
+  //byte count for argptr from wrapping
+  if(n > NICSTAT_COUNT)
+    n = NICSTAT_COUNT;
+  if(argptr(1, (char**)&stats, n * sizeof(uint64_t)) < 0)
+    return -1;
+  if(get_device(interface, &nd) < 0)
+    return -1;
+
+  return nic_get_stats(nd, stats, n);
+}
+
+// nicsend(interface, frame, length): transmit a whole Ethernet frame
+int sys_nicsend(void) {
+  char *interface, *frame;
+  int length;
+  struct nic_device *nd;
+
+  if(argstr(0, &interface) < 0 || argint(2, &length) < 0 || length < 0 ||
+     argptr(1, &frame, length) < 0)
+    return -1;
+  if(get_device(interface, &nd) < 0)
+    return -1;
+
+  return nic_raw_send(nd, (uint8_t*)frame, length);
+}
+
+// nicrecv(interface, buf, length): wait for an ETHR_TYPE_RAW frame,
+// returns its length
+int sys_nicrecv(void) {
+  char *interface, *buf;
+  int length;
+  struct nic_device *nd;
+
+  if(argstr(0, &interface) < 0 || argint(2, &length) < 0 || length < 0 ||
+     argptr(1, &buf, length) < 0)
+    return -1;
+  if(get_device(interface, &nd) < 0)
+    return -1;
+
+  return nic_raw_recv(nd, (uint8_t*)buf, length);
+}
+
+// nicgetip(interface, &addr): IPv4 address, network byte order, 0 if none
+int sys_nicgetip(void) {
+  char *interface;
+  uint32_t *addr;
+  struct nic_device *nd;
+
+  if(argstr(0, &interface) < 0 || argptr(1, (char**)&addr, sizeof(*addr)) < 0)
+    return -1;
+  if(get_device(interface, &nd) < 0)
+    return -1;
+
+  *addr = nd->ipaddr;
+  return 0;
+}
+
+// nicsetip(interface, addr): set the IPv4 address, 0 removes it
+int sys_nicsetip(void) {
+  char *interface;
+  int addr;
+  struct nic_device *nd;
+
+  if(argstr(0, &interface) < 0 || argint(1, &addr) < 0)
+    return -1;
+  if(get_device(interface, &nd) < 0)
+    return -1;
+
+  nic_set_ipaddr(nd, addr);
+  return 0;
+}
@@ -53,6 +53,7 @@ trap(struct trapframe *tf)
       ticks++;
       wakeup(&ticks);
       release(&tickslock);
+      nic_tick(ticks);
     }
     lapiceoi();
     break;
@@ -80,6 +81,13 @@ trap(struct trapframe *tf)
 
   //PAGEBREAK: 13
   default:
+    // PCI NICs get their irq line assigned by the BIOS, so they
+    // can't have a case of their own.
+    if(tf->trapno >= T_IRQ0 && tf->trapno < T_IRQ0 + IRQ_ERROR &&
+       nic_intr(tf->trapno - T_IRQ0) == 0){
+      lapiceoi();
+      break;
+    }
     if(myproc() == 0 || (tf->cs&3) == 0){
       // In kernel, it must be our mistake.
       cprintf("unexpected trap %d from cpu %d eip %x (cr2=0x%x)\n",
@@ -0,0 +1,125 @@
+// Time stamp counter based delays and clock.
+//
+// tscinit() measures the TSC rate against PIT channel 2 at boot. After
+// that udelay()/ndelay() spin for an accurate time and nsecs() is a
+// monotonic nanosecond clock. Before calibration delays return at once,
+// as microdelay() always used to.
+//
+// There is no 64-bit division in the kernel (no libgcc), so conversions
+// are multiply and shift by factors computed once at boot.
+
+#include "types.h"
+#include "defs.h"
+#include "x86.h"
+
+#define PIT_HZ          1193182
+#define PIT_CH2         0x42
+#define PIT_MODE        0x43
+#define PIT_GATE        0x61      // bit 0 gates channel 2, bit 5 is its output
+#define CAL_MS          10        // length of one calibration run
+#define CAL_RUNS        3
+#define CAL_SPINS       1000000   // port reads before giving up on the PIT, ~100x CAL_MS
+#define DEFAULT_KHZ     2000000   // assumed if the PIT never answers
+
+#define SHIFT           22        // fixed point fraction bits of the factors
+
+static uint tsc_khz;
+static uint ns_mult;              // ns per cycle << SHIFT
+static uint cyc_mult;             // cycles per ns << SHIFT
+static uint64_t tsc_base;
+
+// n / d by shift and subtract. Only used at boot.
+static uint64_t
+div64(uint64_t n, uint d)
+{
+  uint64_t q = 0, r = 0;
+  int i;
+
+  for(i = 63; i >= 0; i--){
+    r = (r << 1) | ((n >> i) & 1);
+    if(r >= d){
+      r -= d;
+      q |= 1ULL << i;
+    }
+  }
+  return q;
+}
+
+// TSC cycles during CAL_MS, counted down by PIT channel 2 in mode 0.
+// 0 if the output never went high (no PIT, as on some VMs).
+static uint
+calibrate(void)
+{
+  uint latch = PIT_HZ / (1000 / CAL_MS);
+  uint64_t t0, t1;
+  int spins = 0;
+
+  // gate on, speaker off
+  outb(PIT_GATE, (inb(PIT_GATE) & ~0x02) | 0x01);
+  // channel 2, lobyte/hibyte, mode 0: output goes high at terminal count
+  outb(PIT_MODE, 0xB0);
+  outb(PIT_CH2, latch & 0xff);
+  outb(PIT_CH2, latch >> 8);
+  t0 = rdtsc();
+  while((inb(PIT_GATE) & 0x20) == 0)
+    if(++spins == CAL_SPINS)
+      return 0;
+  t1 = rdtsc();
+  return t1 - t0;
+}
+
+void
+tscinit(void)
+{
+  uint cyc, best = 0;
+  int i;
+
+  // shortest run is the one least disturbed by SMIs and VM exits
+  for(i = 0; i < CAL_RUNS; i++){
+    if((cyc = calibrate()) == 0)
+      break;
+    if(best == 0 || cyc < best)
+      best = cyc;
+  }
+  tsc_khz = best / CAL_MS;
+  if(i < CAL_RUNS || tsc_khz == 0){
+    cprintf("tsc: PIT calibration timed out, assuming %d kHz\n", DEFAULT_KHZ);
+    tsc_khz = DEFAULT_KHZ;
+  }
+  ns_mult = div64(1000000ULL << SHIFT, tsc_khz);
+  cyc_mult = div64((uint64_t)tsc_khz << SHIFT, 1000000);
+  tsc_base = rdtsc();
+  cprintf("tsc: %d kHz\n", tsc_khz);
+}
+
+// Nanoseconds since tscinit(), never goes backwards.
+uint64_t
+nsecs(void)
+{
+  uint64_t cyc = rdtsc() - tsc_base;
+
+  // cyc * ns_mult would overflow after a few hours, split it
+  return (((cyc >> 32) * ns_mult) << (32 - SHIFT)) +
+         (((cyc & 0xffffffff) * ns_mult) >> SHIFT);
+}
+
+// Spin for at least ns nanoseconds.
+void
+ndelay(uint ns)
+{
+  uint64_t start = rdtsc();
+  uint64_t cyc = ((uint64_t)ns * cyc_mult) >> SHIFT;
+
+  while(rdtsc() - start < cyc)
+    pause();
+}
+
+// Spin for at least us microseconds.
+void
+udelay(uint us)
+{
+  // stay clear of overflowing ndelay's argument
+  for(; us > 1000000; us -= 1000000)
+    ndelay(1000000000);
+  ndelay(us * 1000);
+}
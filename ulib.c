@@ -84,3 +84,23 @@ memmove(void *vdst, void *vsrc, int n)
     *dst++ = *src++;
   return vdst;
 }
+
+// a.b.c.d to network byte order. -1 if malformed
+int
+parseip(char *s, uint *addr)
+{
+  uint8_t *b = (uint8_t*)addr;
+  int v;
+
+  for(int i = 0; i < 4; i++) {
+    if(*s < '0' || *s > '9')
+      return -1;
+    for(v = 0; *s >= '0' && *s <= '9'; s++)
+      v = v * 10 + *s - '0';
+    if(v > 255 || *s != (i < 3 ? '.' : '\0'))
+      return -1;
+    b[i] = v;
+    s++;
+  }
+  return 0;
+}
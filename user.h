@@ -2,6 +2,8 @@
 
 struct stat;
 struct rtcdate;
+struct arpent;
+struct arpreq;
 
 // system calls
 int fork(void);
@@ -26,6 +28,18 @@ char* sbrk(int);
 int sleep(int);
 int uptime(void);
 int arp(char*, char*, char*, int);
+int nicget(char*, int, uint*);
+int nicset(char*, int, int);
+int nicstats(char*, uint64_t*, int);
+int nicsend(char*, void*, int);
+int nicrecv(char*, void*, int);
+int arpdump(struct arpent*, int);
+int arpflush(void);
+int nicgetip(char*, uint*);
+int nicsetip(char*, uint);
+int arpresolve(char*, uint, uint8_t*, int);
+int arpresolvev(char*, struct arpreq*, int, int);
+int arpsend(char*, uint, void*, int);
 
 // ulib.c
 int stat(char*, struct stat*);
@@ -38,3 +52,4 @@ uint strlen(char*);
 void* memset(void*, int, uint);
 void* malloc(uint);
 void free(void*);
+int parseip(char*, uint*);
@@ -26,6 +26,21 @@ insl(int port, void *addr, int cnt)
                "memory", "cc");
 }
 
+static inline uint64_t
+rdtsc(void)
+{
+  uint64_t tsc;
+
+  asm volatile("rdtsc" : "=A" (tsc));
+  return tsc;
+}
+
+static inline void
+pause(void)
+{
+  asm volatile("pause");
+}
+
 static inline void
 outb(ushort port, uchar data)
 {
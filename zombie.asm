@@ -0,0 +1,1267 @@
+
+_zombie:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(void)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+   e:	83 ec 04             	sub    $0x4,%esp
+  if(fork() > 0)
+  11:	e8 ce 02 00 00       	call   2e4 <fork>
+  16:	85 c0                	test   %eax,%eax
+  18:	7e 0d                	jle    27 <main+0x27>
+    sleep(5);  // Let child exit before parent.
+  1a:	83 ec 0c             	sub    $0xc,%esp
+  1d:	6a 05                	push   $0x5
+  1f:	e8 58 03 00 00       	call   37c <sleep>
+  24:	83 c4 10             	add    $0x10,%esp
+  exit();
+  27:	e8 c0 02 00 00       	call   2ec <exit>
+  2c:	66 90                	xchg   %ax,%ax
+  2e:	66 90                	xchg   %ax,%ax
+
+00000030 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+  30:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  31:	31 c0                	xor    %eax,%eax
+{
+  33:	89 e5                	mov    %esp,%ebp
+  35:	53                   	push   %ebx
+  36:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  39:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  40:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  44:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  47:	83 c0 01             	add    $0x1,%eax
+  4a:	84 d2                	test   %dl,%dl
+  4c:	75 f2                	jne    40 <strcpy+0x10>
+    ;
+  return os;
+}
+  4e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  51:	89 c8                	mov    %ecx,%eax
+  53:	c9                   	leave
+  54:	c3                   	ret
+  55:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000060 <strlen>:
+
+uint
+strlen(char *s)
+{
+  60:	55                   	push   %ebp
+  61:	89 e5                	mov    %esp,%ebp
+  63:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+  66:	80 3a 00             	cmpb   $0x0,(%edx)
+  69:	74 15                	je     80 <strlen+0x20>
+  6b:	31 c0                	xor    %eax,%eax
+  6d:	8d 76 00             	lea    0x0(%esi),%esi
+  70:	83 c0 01             	add    $0x1,%eax
+  73:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  77:	89 c1                	mov    %eax,%ecx
+  79:	75 f5                	jne    70 <strlen+0x10>
+    ;
+  return n;
+}
+  7b:	89 c8                	mov    %ecx,%eax
+  7d:	5d                   	pop    %ebp
+  7e:	c3                   	ret
+  7f:	90                   	nop
+  for(n = 0; s[n]; n++)
+  80:	31 c9                	xor    %ecx,%ecx
+}
+  82:	5d                   	pop    %ebp
+  83:	89 c8                	mov    %ecx,%eax
+  85:	c3                   	ret
+  86:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000090 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+  90:	55                   	push   %ebp
+  91:	89 e5                	mov    %esp,%ebp
+  93:	57                   	push   %edi
+  94:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+  97:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  9a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  9d:	89 d7                	mov    %edx,%edi
+  9f:	fc                   	cld
+  a0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+  a2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  a5:	89 d0                	mov    %edx,%eax
+  a7:	c9                   	leave
+  a8:	c3                   	ret
+  a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000000b0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+  b0:	55                   	push   %ebp
+  b1:	89 e5                	mov    %esp,%ebp
+  b3:	8b 45 08             	mov    0x8(%ebp),%eax
+  b6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+  ba:	0f b6 10             	movzbl (%eax),%edx
+  bd:	84 d2                	test   %dl,%dl
+  bf:	75 12                	jne    d3 <strchr+0x23>
+  c1:	eb 1d                	jmp    e0 <strchr+0x30>
+  c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  c7:	90                   	nop
+  c8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+  cc:	83 c0 01             	add    $0x1,%eax
+  cf:	84 d2                	test   %dl,%dl
+  d1:	74 0d                	je     e0 <strchr+0x30>
+    if(*s == c)
+  d3:	38 d1                	cmp    %dl,%cl
+  d5:	75 f1                	jne    c8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+  d7:	5d                   	pop    %ebp
+  d8:	c3                   	ret
+  d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+  e0:	31 c0                	xor    %eax,%eax
+}
+  e2:	5d                   	pop    %ebp
+  e3:	c3                   	ret
+  e4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  ef:	90                   	nop
+
+000000f0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+  f0:	55                   	push   %ebp
+  f1:	89 e5                	mov    %esp,%ebp
+  f3:	57                   	push   %edi
+  f4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+  f5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+  f8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+  f9:	31 db                	xor    %ebx,%ebx
+{
+  fb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+  fe:	eb 27                	jmp    127 <gets+0x37>
+    cc = read(0, &c, 1);
+ 100:	83 ec 04             	sub    $0x4,%esp
+ 103:	6a 01                	push   $0x1
+ 105:	56                   	push   %esi
+ 106:	6a 00                	push   $0x0
+ 108:	e8 f7 01 00 00       	call   304 <read>
+    if(cc < 1)
+ 10d:	83 c4 10             	add    $0x10,%esp
+ 110:	85 c0                	test   %eax,%eax
+ 112:	7e 1d                	jle    131 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 114:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 118:	8b 55 08             	mov    0x8(%ebp),%edx
+ 11b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 11f:	3c 0a                	cmp    $0xa,%al
+ 121:	74 10                	je     133 <gets+0x43>
+ 123:	3c 0d                	cmp    $0xd,%al
+ 125:	74 0c                	je     133 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 127:	89 df                	mov    %ebx,%edi
+ 129:	83 c3 01             	add    $0x1,%ebx
+ 12c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 12f:	7c cf                	jl     100 <gets+0x10>
+ 131:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 133:	8b 45 08             	mov    0x8(%ebp),%eax
+ 136:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 13a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 13d:	5b                   	pop    %ebx
+ 13e:	5e                   	pop    %esi
+ 13f:	5f                   	pop    %edi
+ 140:	5d                   	pop    %ebp
+ 141:	c3                   	ret
+ 142:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 149:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000150 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 150:	55                   	push   %ebp
+ 151:	89 e5                	mov    %esp,%ebp
+ 153:	56                   	push   %esi
+ 154:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 155:	83 ec 08             	sub    $0x8,%esp
+ 158:	6a 00                	push   $0x0
+ 15a:	ff 75 08             	push   0x8(%ebp)
+ 15d:	e8 ca 01 00 00       	call   32c <open>
+  if(fd < 0)
+ 162:	83 c4 10             	add    $0x10,%esp
+ 165:	85 c0                	test   %eax,%eax
+ 167:	78 27                	js     190 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 169:	83 ec 08             	sub    $0x8,%esp
+ 16c:	ff 75 0c             	push   0xc(%ebp)
+ 16f:	89 c3                	mov    %eax,%ebx
+ 171:	50                   	push   %eax
+ 172:	e8 cd 01 00 00       	call   344 <fstat>
+  close(fd);
+ 177:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 17a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 17c:	e8 93 01 00 00       	call   314 <close>
+  return r;
+ 181:	83 c4 10             	add    $0x10,%esp
+}
+ 184:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 187:	89 f0                	mov    %esi,%eax
+ 189:	5b                   	pop    %ebx
+ 18a:	5e                   	pop    %esi
+ 18b:	5d                   	pop    %ebp
+ 18c:	c3                   	ret
+ 18d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 190:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 195:	eb ed                	jmp    184 <stat+0x34>
+ 197:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 19e:	66 90                	xchg   %ax,%ax
+
+000001a0 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 1a0:	55                   	push   %ebp
+ 1a1:	89 e5                	mov    %esp,%ebp
+ 1a3:	57                   	push   %edi
+ 1a4:	56                   	push   %esi
+ 1a5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 1a8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1ab:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 1ae:	85 c0                	test   %eax,%eax
+ 1b0:	7e 13                	jle    1c5 <memmove+0x25>
+ 1b2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 1b4:	89 d7                	mov    %edx,%edi
+ 1b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1bd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 1c0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 1c1:	39 f8                	cmp    %edi,%eax
+ 1c3:	75 fb                	jne    1c0 <memmove+0x20>
+  return vdst;
+}
+ 1c5:	5e                   	pop    %esi
+ 1c6:	89 d0                	mov    %edx,%eax
+ 1c8:	5f                   	pop    %edi
+ 1c9:	5d                   	pop    %ebp
+ 1ca:	c3                   	ret
+ 1cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1cf:	90                   	nop
+
+000001d0 <parseip>:
+
+// a.b.c.d to network byte order. -1 if malformed
+int
+parseip(char *s, uint *addr)
+{
+ 1d0:	55                   	push   %ebp
+ 1d1:	89 e5                	mov    %esp,%ebp
+ 1d3:	57                   	push   %edi
+  uint8_t *b = (uint8_t*)addr;
+  int v;
+
+  for(int i = 0; i < 4; i++) {
+ 1d4:	31 ff                	xor    %edi,%edi
+{
+ 1d6:	56                   	push   %esi
+ 1d7:	53                   	push   %ebx
+ 1d8:	8b 55 08             	mov    0x8(%ebp),%edx
+    if(*s < '0' || *s > '9')
+ 1db:	0f be 02             	movsbl (%edx),%eax
+ 1de:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 1e1:	80 f9 09             	cmp    $0x9,%cl
+ 1e4:	77 59                	ja     23f <parseip+0x6f>
+      return -1;
+    for(v = 0; *s >= '0' && *s <= '9'; s++)
+ 1e6:	31 c9                	xor    %ecx,%ecx
+ 1e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ef:	90                   	nop
+      v = v * 10 + *s - '0';
+ 1f0:	89 d6                	mov    %edx,%esi
+ 1f2:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    for(v = 0; *s >= '0' && *s <= '9'; s++)
+ 1f5:	83 c2 01             	add    $0x1,%edx
+      v = v * 10 + *s - '0';
+ 1f8:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+    for(v = 0; *s >= '0' && *s <= '9'; s++)
+ 1fc:	0f be 02             	movsbl (%edx),%eax
+ 1ff:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 202:	80 fb 09             	cmp    $0x9,%bl
+ 205:	76 e9                	jbe    1f0 <parseip+0x20>
+    if(v > 255 || *s != (i < 3 ? '.' : '\0'))
+ 207:	81 f9 ff 00 00 00    	cmp    $0xff,%ecx
+ 20d:	7f 30                	jg     23f <parseip+0x6f>
+ 20f:	83 ff 03             	cmp    $0x3,%edi
+ 212:	74 1c                	je     230 <parseip+0x60>
+ 214:	83 f8 2e             	cmp    $0x2e,%eax
+ 217:	75 26                	jne    23f <parseip+0x6f>
+      return -1;
+    b[i] = v;
+ 219:	8b 45 0c             	mov    0xc(%ebp),%eax
+    s++;
+ 21c:	8d 56 02             	lea    0x2(%esi),%edx
+    b[i] = v;
+ 21f:	88 0c 38             	mov    %cl,(%eax,%edi,1)
+  for(int i = 0; i < 4; i++) {
+ 222:	83 c7 01             	add    $0x1,%edi
+ 225:	eb b4                	jmp    1db <parseip+0xb>
+ 227:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 22e:	66 90                	xchg   %ax,%ax
+    if(v > 255 || *s != (i < 3 ? '.' : '\0'))
+ 230:	85 c0                	test   %eax,%eax
+ 232:	75 0b                	jne    23f <parseip+0x6f>
+    b[i] = v;
+ 234:	8b 7d 0c             	mov    0xc(%ebp),%edi
+ 237:	88 4f 03             	mov    %cl,0x3(%edi)
+  }
+  return 0;
+}
+ 23a:	5b                   	pop    %ebx
+ 23b:	5e                   	pop    %esi
+ 23c:	5f                   	pop    %edi
+ 23d:	5d                   	pop    %ebp
+ 23e:	c3                   	ret
+ 23f:	5b                   	pop    %ebx
+      return -1;
+ 240:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+ 245:	5e                   	pop    %esi
+ 246:	5f                   	pop    %edi
+ 247:	5d                   	pop    %ebp
+ 248:	c3                   	ret
+ 249:	66 90                	xchg   %ax,%ax
+ 24b:	66 90                	xchg   %ax,%ax
+ 24d:	66 90                	xchg   %ax,%ax
+ 24f:	90                   	nop
+
+00000250 <atoi>:
+#include "types.h"
+#include "util.h"
+
+int
+atoi(const char *s)
+{
+ 250:	55                   	push   %ebp
+ 251:	89 e5                	mov    %esp,%ebp
+ 253:	53                   	push   %ebx
+ 254:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 257:	0f be 02             	movsbl (%edx),%eax
+ 25a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 25d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 260:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 265:	77 1e                	ja     285 <atoi+0x35>
+ 267:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 26e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 270:	83 c2 01             	add    $0x1,%edx
+ 273:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 276:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 27a:	0f be 02             	movsbl (%edx),%eax
+ 27d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 280:	80 fb 09             	cmp    $0x9,%bl
+ 283:	76 eb                	jbe    270 <atoi+0x20>
+  return n;
+}
+ 285:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 288:	89 c8                	mov    %ecx,%eax
+ 28a:	c9                   	leave
+ 28b:	c3                   	ret
+ 28c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000290 <strcmp>:
+
+
+int
+strcmp(const char *p, const char *q)
+{
+ 290:	55                   	push   %ebp
+ 291:	89 e5                	mov    %esp,%ebp
+ 293:	53                   	push   %ebx
+ 294:	8b 55 08             	mov    0x8(%ebp),%edx
+ 297:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 29a:	0f b6 02             	movzbl (%edx),%eax
+ 29d:	84 c0                	test   %al,%al
+ 29f:	75 17                	jne    2b8 <strcmp+0x28>
+ 2a1:	eb 3a                	jmp    2dd <strcmp+0x4d>
+ 2a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2a7:	90                   	nop
+ 2a8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 2ac:	83 c2 01             	add    $0x1,%edx
+ 2af:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 2b2:	84 c0                	test   %al,%al
+ 2b4:	74 1a                	je     2d0 <strcmp+0x40>
+    p++, q++;
+ 2b6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 2b8:	0f b6 19             	movzbl (%ecx),%ebx
+ 2bb:	38 c3                	cmp    %al,%bl
+ 2bd:	74 e9                	je     2a8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 2bf:	29 d8                	sub    %ebx,%eax
+}
+ 2c1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2c4:	c9                   	leave
+ 2c5:	c3                   	ret
+ 2c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2cd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 2d0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 2d4:	31 c0                	xor    %eax,%eax
+ 2d6:	29 d8                	sub    %ebx,%eax
+}
+ 2d8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2db:	c9                   	leave
+ 2dc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 2dd:	0f b6 19             	movzbl (%ecx),%ebx
+ 2e0:	31 c0                	xor    %eax,%eax
+ 2e2:	eb db                	jmp    2bf <strcmp+0x2f>
+
+000002e4 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 2e4:	b8 01 00 00 00       	mov    $0x1,%eax
+ 2e9:	cd 40                	int    $0x40
+ 2eb:	c3                   	ret
+
+000002ec <exit>:
+SYSCALL(exit)
+ 2ec:	b8 02 00 00 00       	mov    $0x2,%eax
+ 2f1:	cd 40                	int    $0x40
+ 2f3:	c3                   	ret
+
+000002f4 <wait>:
+SYSCALL(wait)
+ 2f4:	b8 03 00 00 00       	mov    $0x3,%eax
+ 2f9:	cd 40                	int    $0x40
+ 2fb:	c3                   	ret
+
+000002fc <pipe>:
+SYSCALL(pipe)
+ 2fc:	b8 04 00 00 00       	mov    $0x4,%eax
+ 301:	cd 40                	int    $0x40
+ 303:	c3                   	ret
+
+00000304 <read>:
+SYSCALL(read)
+ 304:	b8 05 00 00 00       	mov    $0x5,%eax
+ 309:	cd 40                	int    $0x40
+ 30b:	c3                   	ret
+
+0000030c <write>:
+SYSCALL(write)
+ 30c:	b8 10 00 00 00       	mov    $0x10,%eax
+ 311:	cd 40                	int    $0x40
+ 313:	c3                   	ret
+
+00000314 <close>:
+SYSCALL(close)
+ 314:	b8 15 00 00 00       	mov    $0x15,%eax
+ 319:	cd 40                	int    $0x40
+ 31b:	c3                   	ret
+
+0000031c <kill>:
+SYSCALL(kill)
+ 31c:	b8 06 00 00 00       	mov    $0x6,%eax
+ 321:	cd 40                	int    $0x40
+ 323:	c3                   	ret
+
+00000324 <exec>:
+SYSCALL(exec)
+ 324:	b8 07 00 00 00       	mov    $0x7,%eax
+ 329:	cd 40                	int    $0x40
+ 32b:	c3                   	ret
+
+0000032c <open>:
+SYSCALL(open)
+ 32c:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 331:	cd 40                	int    $0x40
+ 333:	c3                   	ret
+
+00000334 <mknod>:
+SYSCALL(mknod)
+ 334:	b8 11 00 00 00       	mov    $0x11,%eax
+ 339:	cd 40                	int    $0x40
+ 33b:	c3                   	ret
+
+0000033c <unlink>:
+SYSCALL(unlink)
+ 33c:	b8 12 00 00 00       	mov    $0x12,%eax
+ 341:	cd 40                	int    $0x40
+ 343:	c3                   	ret
+
+00000344 <fstat>:
+SYSCALL(fstat)
+ 344:	b8 08 00 00 00       	mov    $0x8,%eax
+ 349:	cd 40                	int    $0x40
+ 34b:	c3                   	ret
+
+0000034c <link>:
+SYSCALL(link)
+ 34c:	b8 13 00 00 00       	mov    $0x13,%eax
+ 351:	cd 40                	int    $0x40
+ 353:	c3                   	ret
+
+00000354 <mkdir>:
+SYSCALL(mkdir)
+ 354:	b8 14 00 00 00       	mov    $0x14,%eax
+ 359:	cd 40                	int    $0x40
+ 35b:	c3                   	ret
+
+0000035c <chdir>:
+SYSCALL(chdir)
+ 35c:	b8 09 00 00 00       	mov    $0x9,%eax
+ 361:	cd 40                	int    $0x40
+ 363:	c3                   	ret
+
+00000364 <dup>:
+SYSCALL(dup)
+ 364:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 369:	cd 40                	int    $0x40
+ 36b:	c3                   	ret
+
+0000036c <getpid>:
+SYSCALL(getpid)
+ 36c:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 371:	cd 40                	int    $0x40
+ 373:	c3                   	ret
+
+00000374 <sbrk>:
+SYSCALL(sbrk)
+ 374:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 379:	cd 40                	int    $0x40
+ 37b:	c3                   	ret
+
+0000037c <sleep>:
+SYSCALL(sleep)
+ 37c:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 381:	cd 40                	int    $0x40
+ 383:	c3                   	ret
+
+00000384 <uptime>:
+SYSCALL(uptime)
+ 384:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 389:	cd 40                	int    $0x40
+ 38b:	c3                   	ret
+
+0000038c <arp>:
+SYSCALL(arp)
+ 38c:	b8 16 00 00 00       	mov    $0x16,%eax
+ 391:	cd 40                	int    $0x40
+ 393:	c3                   	ret
+
+00000394 <nicget>:
+SYSCALL(nicget)
+ 394:	b8 17 00 00 00       	mov    $0x17,%eax
+ 399:	cd 40                	int    $0x40
+ 39b:	c3                   	ret
+
+0000039c <nicset>:
+SYSCALL(nicset)
+ 39c:	b8 18 00 00 00       	mov    $0x18,%eax
+ 3a1:	cd 40                	int    $0x40
+ 3a3:	c3                   	ret
+
+000003a4 <nicstats>:
+SYSCALL(nicstats)
+ 3a4:	b8 19 00 00 00       	mov    $0x19,%eax
+ 3a9:	cd 40                	int    $0x40
+ 3ab:	c3                   	ret
+
+000003ac <nicsend>:
+SYSCALL(nicsend)
+ 3ac:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 3b1:	cd 40                	int    $0x40
+ 3b3:	c3                   	ret
+
+000003b4 <nicrecv>:
+SYSCALL(nicrecv)
+ 3b4:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 3b9:	cd 40                	int    $0x40
+ 3bb:	c3                   	ret
+
+000003bc <arpdump>:
+SYSCALL(arpdump)
+ 3bc:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 3c1:	cd 40                	int    $0x40
+ 3c3:	c3                   	ret
+
+000003c4 <arpflush>:
+SYSCALL(arpflush)
+ 3c4:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 3c9:	cd 40                	int    $0x40
+ 3cb:	c3                   	ret
+
+000003cc <nicgetip>:
+SYSCALL(nicgetip)
+ 3cc:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 3d1:	cd 40                	int    $0x40
+ 3d3:	c3                   	ret
+
+000003d4 <nicsetip>:
+SYSCALL(nicsetip)
+ 3d4:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 3d9:	cd 40                	int    $0x40
+ 3db:	c3                   	ret
+
+000003dc <arpresolve>:
+SYSCALL(arpresolve)
+ 3dc:	b8 20 00 00 00       	mov    $0x20,%eax
+ 3e1:	cd 40                	int    $0x40
+ 3e3:	c3                   	ret
+
+000003e4 <arpresolvev>:
+SYSCALL(arpresolvev)
+ 3e4:	b8 21 00 00 00       	mov    $0x21,%eax
+ 3e9:	cd 40                	int    $0x40
+ 3eb:	c3                   	ret
+
+000003ec <arpsend>:
+SYSCALL(arpsend)
+ 3ec:	b8 22 00 00 00       	mov    $0x22,%eax
+ 3f1:	cd 40                	int    $0x40
+ 3f3:	c3                   	ret
+ 3f4:	66 90                	xchg   %ax,%ax
+ 3f6:	66 90                	xchg   %ax,%ax
+ 3f8:	66 90                	xchg   %ax,%ax
+ 3fa:	66 90                	xchg   %ax,%ax
+ 3fc:	66 90                	xchg   %ax,%ax
+ 3fe:	66 90                	xchg   %ax,%ax
+
+00000400 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 400:	55                   	push   %ebp
+ 401:	89 e5                	mov    %esp,%ebp
+ 403:	57                   	push   %edi
+ 404:	56                   	push   %esi
+ 405:	53                   	push   %ebx
+ 406:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 408:	89 d1                	mov    %edx,%ecx
+{
+ 40a:	83 ec 3c             	sub    $0x3c,%esp
+ 40d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 410:	85 d2                	test   %edx,%edx
+ 412:	0f 89 80 00 00 00    	jns    498 <printint+0x98>
+ 418:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 41c:	74 7a                	je     498 <printint+0x98>
+    x = -xx;
+ 41e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 420:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 425:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 428:	31 f6                	xor    %esi,%esi
+ 42a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 430:	89 c8                	mov    %ecx,%eax
+ 432:	31 d2                	xor    %edx,%edx
+ 434:	89 f7                	mov    %esi,%edi
+ 436:	f7 f3                	div    %ebx
+ 438:	8d 76 01             	lea    0x1(%esi),%esi
+ 43b:	0f b6 92 28 08 00 00 	movzbl 0x828(%edx),%edx
+ 442:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 446:	89 ca                	mov    %ecx,%edx
+ 448:	89 c1                	mov    %eax,%ecx
+ 44a:	39 da                	cmp    %ebx,%edx
+ 44c:	73 e2                	jae    430 <printint+0x30>
+  if(neg)
+ 44e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 451:	85 c0                	test   %eax,%eax
+ 453:	74 07                	je     45c <printint+0x5c>
+    buf[i++] = '-';
+ 455:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 45a:	89 f7                	mov    %esi,%edi
+ 45c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 45f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 462:	01 df                	add    %ebx,%edi
+ 464:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 468:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 46b:	83 ec 04             	sub    $0x4,%esp
+ 46e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 471:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 474:	6a 01                	push   $0x1
+ 476:	50                   	push   %eax
+ 477:	56                   	push   %esi
+ 478:	e8 8f fe ff ff       	call   30c <write>
+  while(--i >= 0)
+ 47d:	89 f8                	mov    %edi,%eax
+ 47f:	83 c4 10             	add    $0x10,%esp
+ 482:	83 ef 01             	sub    $0x1,%edi
+ 485:	39 d8                	cmp    %ebx,%eax
+ 487:	75 df                	jne    468 <printint+0x68>
+}
+ 489:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 48c:	5b                   	pop    %ebx
+ 48d:	5e                   	pop    %esi
+ 48e:	5f                   	pop    %edi
+ 48f:	5d                   	pop    %ebp
+ 490:	c3                   	ret
+ 491:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 498:	31 c0                	xor    %eax,%eax
+ 49a:	eb 89                	jmp    425 <printint+0x25>
+ 49c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000004a0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 4a0:	55                   	push   %ebp
+ 4a1:	89 e5                	mov    %esp,%ebp
+ 4a3:	57                   	push   %edi
+ 4a4:	56                   	push   %esi
+ 4a5:	53                   	push   %ebx
+ 4a6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 4a9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 4ac:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 4af:	0f b6 1e             	movzbl (%esi),%ebx
+ 4b2:	83 c6 01             	add    $0x1,%esi
+ 4b5:	84 db                	test   %bl,%bl
+ 4b7:	74 67                	je     520 <printf+0x80>
+ 4b9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 4bc:	31 d2                	xor    %edx,%edx
+ 4be:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 4c1:	eb 34                	jmp    4f7 <printf+0x57>
+ 4c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4c7:	90                   	nop
+ 4c8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 4cb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 4d0:	83 f8 25             	cmp    $0x25,%eax
+ 4d3:	74 18                	je     4ed <printf+0x4d>
+  write(fd, &c, 1);
+ 4d5:	83 ec 04             	sub    $0x4,%esp
+ 4d8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 4db:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 4de:	6a 01                	push   $0x1
+ 4e0:	50                   	push   %eax
+ 4e1:	57                   	push   %edi
+ 4e2:	e8 25 fe ff ff       	call   30c <write>
+ 4e7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 4ea:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 4ed:	0f b6 1e             	movzbl (%esi),%ebx
+ 4f0:	83 c6 01             	add    $0x1,%esi
+ 4f3:	84 db                	test   %bl,%bl
+ 4f5:	74 29                	je     520 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 4f7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 4fa:	85 d2                	test   %edx,%edx
+ 4fc:	74 ca                	je     4c8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 4fe:	83 fa 25             	cmp    $0x25,%edx
+ 501:	75 ea                	jne    4ed <printf+0x4d>
+      if(c == 'd'){
+ 503:	83 f8 25             	cmp    $0x25,%eax
+ 506:	0f 84 24 01 00 00    	je     630 <printf+0x190>
+ 50c:	83 e8 63             	sub    $0x63,%eax
+ 50f:	83 f8 15             	cmp    $0x15,%eax
+ 512:	77 1c                	ja     530 <printf+0x90>
+ 514:	ff 24 85 d0 07 00 00 	jmp    *0x7d0(,%eax,4)
+ 51b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 51f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 520:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 523:	5b                   	pop    %ebx
+ 524:	5e                   	pop    %esi
+ 525:	5f                   	pop    %edi
+ 526:	5d                   	pop    %ebp
+ 527:	c3                   	ret
+ 528:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 52f:	90                   	nop
+  write(fd, &c, 1);
+ 530:	83 ec 04             	sub    $0x4,%esp
+ 533:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 536:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 53a:	6a 01                	push   $0x1
+ 53c:	52                   	push   %edx
+ 53d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 540:	57                   	push   %edi
+ 541:	e8 c6 fd ff ff       	call   30c <write>
+ 546:	83 c4 0c             	add    $0xc,%esp
+ 549:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 54c:	6a 01                	push   $0x1
+ 54e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 551:	52                   	push   %edx
+ 552:	57                   	push   %edi
+ 553:	e8 b4 fd ff ff       	call   30c <write>
+        putc(fd, c);
+ 558:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 55b:	31 d2                	xor    %edx,%edx
+ 55d:	eb 8e                	jmp    4ed <printf+0x4d>
+ 55f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 560:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 563:	83 ec 0c             	sub    $0xc,%esp
+ 566:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 56b:	8b 13                	mov    (%ebx),%edx
+ 56d:	6a 00                	push   $0x0
+ 56f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 571:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 574:	e8 87 fe ff ff       	call   400 <printint>
+        ap++;
+ 579:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 57c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 57f:	31 d2                	xor    %edx,%edx
+ 581:	e9 67 ff ff ff       	jmp    4ed <printf+0x4d>
+ 586:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 58d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 590:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 593:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 595:	83 c0 04             	add    $0x4,%eax
+ 598:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 59b:	85 db                	test   %ebx,%ebx
+ 59d:	0f 84 9d 00 00 00    	je     640 <printf+0x1a0>
+        while(*s != 0){
+ 5a3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 5a6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 5a8:	84 c0                	test   %al,%al
+ 5aa:	0f 84 3d ff ff ff    	je     4ed <printf+0x4d>
+ 5b0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 5b3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 5b6:	89 de                	mov    %ebx,%esi
+ 5b8:	89 d3                	mov    %edx,%ebx
+ 5ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 5c0:	83 ec 04             	sub    $0x4,%esp
+ 5c3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 5c6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 5c9:	6a 01                	push   $0x1
+ 5cb:	53                   	push   %ebx
+ 5cc:	57                   	push   %edi
+ 5cd:	e8 3a fd ff ff       	call   30c <write>
+        while(*s != 0){
+ 5d2:	0f b6 06             	movzbl (%esi),%eax
+ 5d5:	83 c4 10             	add    $0x10,%esp
+ 5d8:	84 c0                	test   %al,%al
+ 5da:	75 e4                	jne    5c0 <printf+0x120>
+      state = 0;
+ 5dc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 5df:	31 d2                	xor    %edx,%edx
+ 5e1:	e9 07 ff ff ff       	jmp    4ed <printf+0x4d>
+ 5e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5ed:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 5f0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 5f3:	83 ec 0c             	sub    $0xc,%esp
+ 5f6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 5fb:	8b 13                	mov    (%ebx),%edx
+ 5fd:	6a 01                	push   $0x1
+ 5ff:	e9 6b ff ff ff       	jmp    56f <printf+0xcf>
+ 604:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 608:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 60b:	83 ec 04             	sub    $0x4,%esp
+ 60e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 611:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 613:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 616:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 619:	6a 01                	push   $0x1
+ 61b:	52                   	push   %edx
+ 61c:	57                   	push   %edi
+ 61d:	e8 ea fc ff ff       	call   30c <write>
+        ap++;
+ 622:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 625:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 628:	31 d2                	xor    %edx,%edx
+ 62a:	e9 be fe ff ff       	jmp    4ed <printf+0x4d>
+ 62f:	90                   	nop
+  write(fd, &c, 1);
+ 630:	83 ec 04             	sub    $0x4,%esp
+ 633:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 636:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 639:	6a 01                	push   $0x1
+ 63b:	e9 11 ff ff ff       	jmp    551 <printf+0xb1>
+ 640:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 645:	bb c8 07 00 00       	mov    $0x7c8,%ebx
+ 64a:	e9 61 ff ff ff       	jmp    5b0 <printf+0x110>
+ 64f:	90                   	nop
+
+00000650 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 650:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 651:	a1 00 0b 00 00       	mov    0xb00,%eax
+{
+ 656:	89 e5                	mov    %esp,%ebp
+ 658:	57                   	push   %edi
+ 659:	56                   	push   %esi
+ 65a:	53                   	push   %ebx
+ 65b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 65e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 661:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 668:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 66a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 66c:	39 ca                	cmp    %ecx,%edx
+ 66e:	73 30                	jae    6a0 <free+0x50>
+ 670:	39 c1                	cmp    %eax,%ecx
+ 672:	72 04                	jb     678 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 674:	39 c2                	cmp    %eax,%edx
+ 676:	72 f0                	jb     668 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 678:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 67b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 67e:	39 f8                	cmp    %edi,%eax
+ 680:	74 2e                	je     6b0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 682:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 685:	8b 42 04             	mov    0x4(%edx),%eax
+ 688:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 68b:	39 f1                	cmp    %esi,%ecx
+ 68d:	74 38                	je     6c7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 68f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 691:	5b                   	pop    %ebx
+  freep = p;
+ 692:	89 15 00 0b 00 00    	mov    %edx,0xb00
+}
+ 698:	5e                   	pop    %esi
+ 699:	5f                   	pop    %edi
+ 69a:	5d                   	pop    %ebp
+ 69b:	c3                   	ret
+ 69c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 6a0:	39 c1                	cmp    %eax,%ecx
+ 6a2:	72 d0                	jb     674 <free+0x24>
+ 6a4:	eb c2                	jmp    668 <free+0x18>
+ 6a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6ad:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 6b0:	03 70 04             	add    0x4(%eax),%esi
+ 6b3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 6b6:	8b 02                	mov    (%edx),%eax
+ 6b8:	8b 00                	mov    (%eax),%eax
+ 6ba:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 6bd:	8b 42 04             	mov    0x4(%edx),%eax
+ 6c0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 6c3:	39 f1                	cmp    %esi,%ecx
+ 6c5:	75 c8                	jne    68f <free+0x3f>
+    p->s.size += bp->s.size;
+ 6c7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 6ca:	89 15 00 0b 00 00    	mov    %edx,0xb00
+    p->s.size += bp->s.size;
+ 6d0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 6d3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 6d6:	89 0a                	mov    %ecx,(%edx)
+}
+ 6d8:	5b                   	pop    %ebx
+ 6d9:	5e                   	pop    %esi
+ 6da:	5f                   	pop    %edi
+ 6db:	5d                   	pop    %ebp
+ 6dc:	c3                   	ret
+ 6dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000006e0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 6e0:	55                   	push   %ebp
+ 6e1:	89 e5                	mov    %esp,%ebp
+ 6e3:	57                   	push   %edi
+ 6e4:	56                   	push   %esi
+ 6e5:	53                   	push   %ebx
+ 6e6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 6e9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 6ec:	8b 15 00 0b 00 00    	mov    0xb00,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 6f2:	8d 78 07             	lea    0x7(%eax),%edi
+ 6f5:	c1 ef 03             	shr    $0x3,%edi
+ 6f8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 6fb:	85 d2                	test   %edx,%edx
+ 6fd:	0f 84 8d 00 00 00    	je     790 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 703:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 705:	8b 48 04             	mov    0x4(%eax),%ecx
+ 708:	39 f9                	cmp    %edi,%ecx
+ 70a:	73 64                	jae    770 <malloc+0x90>
+  if(nu < 4096)
+ 70c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 711:	39 df                	cmp    %ebx,%edi
+ 713:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 716:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 71d:	eb 0a                	jmp    729 <malloc+0x49>
+ 71f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 720:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 722:	8b 48 04             	mov    0x4(%eax),%ecx
+ 725:	39 f9                	cmp    %edi,%ecx
+ 727:	73 47                	jae    770 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 729:	89 c2                	mov    %eax,%edx
+ 72b:	39 05 00 0b 00 00    	cmp    %eax,0xb00
+ 731:	75 ed                	jne    720 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 733:	83 ec 0c             	sub    $0xc,%esp
+ 736:	56                   	push   %esi
+ 737:	e8 38 fc ff ff       	call   374 <sbrk>
+  if(p == (char*)-1)
+ 73c:	83 c4 10             	add    $0x10,%esp
+ 73f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 742:	74 1c                	je     760 <malloc+0x80>
+  hp->s.size = nu;
+ 744:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 747:	83 ec 0c             	sub    $0xc,%esp
+ 74a:	83 c0 08             	add    $0x8,%eax
+ 74d:	50                   	push   %eax
+ 74e:	e8 fd fe ff ff       	call   650 <free>
+  return freep;
+ 753:	8b 15 00 0b 00 00    	mov    0xb00,%edx
+      if((p = morecore(nunits)) == 0)
+ 759:	83 c4 10             	add    $0x10,%esp
+ 75c:	85 d2                	test   %edx,%edx
+ 75e:	75 c0                	jne    720 <malloc+0x40>
+        return 0;
+  }
+}
+ 760:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 763:	31 c0                	xor    %eax,%eax
+}
+ 765:	5b                   	pop    %ebx
+ 766:	5e                   	pop    %esi
+ 767:	5f                   	pop    %edi
+ 768:	5d                   	pop    %ebp
+ 769:	c3                   	ret
+ 76a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 770:	39 cf                	cmp    %ecx,%edi
+ 772:	74 4c                	je     7c0 <malloc+0xe0>
+        p->s.size -= nunits;
+ 774:	29 f9                	sub    %edi,%ecx
+ 776:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 779:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 77c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 77f:	89 15 00 0b 00 00    	mov    %edx,0xb00
+}
+ 785:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 788:	83 c0 08             	add    $0x8,%eax
+}
+ 78b:	5b                   	pop    %ebx
+ 78c:	5e                   	pop    %esi
+ 78d:	5f                   	pop    %edi
+ 78e:	5d                   	pop    %ebp
+ 78f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 790:	c7 05 00 0b 00 00 04 	movl   $0xb04,0xb00
+ 797:	0b 00 00 
+    base.s.size = 0;
+ 79a:	b8 04 0b 00 00       	mov    $0xb04,%eax
+    base.s.ptr = freep = prevp = &base;
+ 79f:	c7 05 04 0b 00 00 04 	movl   $0xb04,0xb04
+ 7a6:	0b 00 00 
+    base.s.size = 0;
+ 7a9:	c7 05 08 0b 00 00 00 	movl   $0x0,0xb08
+ 7b0:	00 00 00 
+    if(p->s.size >= nunits){
+ 7b3:	e9 54 ff ff ff       	jmp    70c <malloc+0x2c>
+ 7b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7bf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 7c0:	8b 08                	mov    (%eax),%ecx
+ 7c2:	89 0a                	mov    %ecx,(%edx)
+ 7c4:	eb b9                	jmp    77f <malloc+0x9f>